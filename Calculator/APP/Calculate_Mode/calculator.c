@@ -13,16 +13,23 @@
 #define ARRAY_MAX_SIZE	10
 #define	VAR_MAX_VALUE	4294967295UL
 
-static uint32 first_op, second_op, result; 		// Variables to hold the value of our operands and result
-static uint8 operation;							// Variable to hold the operation sign (+,-,*,\)
-static uint8 user_input[ARRAY_MAX_SIZE]; 		// Array to use as a buffer for user input
-static uint8 user_input_index;					// Variable to hold the length of the array
+/* Working set of the mode, taken from the arena when the mode is entered */
+typedef struct{
+	uint32 first_op, second_op, result; 		// Variables to hold the value of our operands and result
+	uint8 operation;							// Variable to hold the operation sign (+,-,*,\)
+	uint8 user_input[ARRAY_MAX_SIZE]; 			// Array to use as a buffer for user input
+	uint8 user_input_index;						// Variable to hold the length of the array
+	uint8 result_string[ARRAY_MAX_SIZE + 1];	// Result and its terminating null
+}calculator_work_t;
+ARENA_CHECK(calculator_work_t);
+
+static calculator_work_t *Calc;					// NULL while the mode is not running
 static uint8 pressed_key;
-static calculator_states_t calculator_states_id;
-void (*pfCalculator_State_Handler)() = STATE_CALL(First_Operand);
+void (*pfCalculator_State_Handler)() = STATE_CALL(Calculator);
+static const hsm_machine_t Calculator_Machine;
+static hsm_t Calculator_HSM = {&Calculator_Machine, HSM_NO_STATE};
 uint8 USER_RESET_FLAG; 					// To be set to 1 if user wants to exit this mode
 static uint8 double_check_before_quitting;
-static uint8 result_string[ARRAY_MAX_SIZE];
 
 
 /**=============================================
@@ -61,8 +68,9 @@ static void Flush_Array(uint8 *arr, uint8 *length, uint32 *destination){
   * @retval 		- Result of the calculation
   * Note			- In minus operation, it will always return a positive integer which will be the absolute difference
   * 				- If no operation is specified, it will return the first operand op1
+  * 				- Also used by the serial console
   */
-static uint32 Calculate_Result(uint32 op1, uint32 op2, uint8 operator){
+uint32 Calculate_Result(uint32 op1, uint32 op2, uint8 operator){
 	uint32 final_result;
 	switch(operator){
 	case '+':
@@ -85,176 +93,272 @@ static uint32 Calculate_Result(uint32 op1, uint32 op2, uint8 operator){
 }
 
 /**=============================================
-  * @Fn				- ST_First_Operand
-  * @brief 			- In this state, the system will store user entry in first operand array
+  * @Fn				- Clear_Values
+  * @brief 			- This function will clear the operands, operation and result
   * @param [in] 	- None
-  * @param [out] 	- None
   * @retval 		- None
-  * Note			- This function will be called in First_Operand state
+  * Note			- None
   */
-STATE_DEF(First_Operand){
-	/* State Name */
-	calculator_states_id = First_Operand;
-
-	/* State Action */
-	pressed_key = keypad_Get_Pressed_Key();
+static void Clear_Values(void){
+	Calc->first_op = 0;
+	Calc->second_op = 0;
+	Calc->operation = 0;
+	Calc->result = 0;
+}
 
-	/* User entered a number */
-	if((0 <= pressed_key) && (10 > pressed_key)){
-		double_check_before_quitting = 0; // Clear flag
-		/* Validate that we are not writing outside array boundaries */
-		if(user_input_index < ARRAY_MAX_SIZE){
-			LCD_Send_Char(pressed_key+48);
-			user_input[user_input_index] = pressed_key;
-			user_input_index++;
-		}
-		else{ /* Do Nothing */ }
-	}
-	/* User entered a operation sign */
-	else if(('+' == pressed_key) || ('-' == pressed_key) || ('x' == pressed_key) || ('/' == pressed_key)){
-		double_check_before_quitting = 0; // Clear flag
-		operation = pressed_key;
-		LCD_Send_Char(pressed_key);
-		/* Save the buffer array in first_op variable */
-		Flush_Array(user_input, &user_input_index, &first_op);
-		pfCalculator_State_Handler = STATE_CALL(Second_Operand);
-	}
-	else if('=' == pressed_key){
-		double_check_before_quitting = 0; // Clear flag
-		Flush_Array(user_input, &user_input_index, &first_op);
-		pfCalculator_State_Handler = STATE_CALL(Result);
-	}
-	/* User pressed clear */
-	else if('C' == pressed_key){
-		/* Clear screen, or exit if pressed twice in a row */
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		first_op = 0;
-		second_op = 0;
-		operation = 0;
-		result = 0;
-		if(1 == double_check_before_quitting){
-			USER_RESET_FLAG = 1;
-		}
-		else{
-			double_check_before_quitting = 1;
-		}
+/**=============================================
+  * @Fn				- Act_Digit
+  * @brief 			- This function will add a typed digit to the operand buffer
+  * @param [in] 	- event: Digit event @ref hsm_key_event_t
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- The digit is ignored if the buffer is full
+  */
+static hsm_state_t Act_Digit(hsm_event_t event){
+	/* Validate that we are not writing outside array boundaries */
+	if(Calc->user_input_index < ARRAY_MAX_SIZE){
+		LCD_Send_Char(event+48);
+		Calc->user_input[Calc->user_input_index] = event;
+		Calc->user_input_index++;
 	}
 	else{ /* Do Nothing */ }
+	return HSM_TABLE_NEXT;
 }
 
 /**=============================================
-  * @Fn				- ST_Second_Operand
-  * @brief 			- In this state, the system will store user entry in second operand array
-  * @param [in] 	- None
-  * @param [out] 	- None
-  * @retval 		- None
-  * Note			- This function will be called in Second_Operand state
+  * @Fn				- Act_First_Operation
+  * @brief 			- This function will save the first operand and the operation sign
+  * @param [in] 	- event: Operation event @ref hsm_key_event_t
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- None
+  */
+static hsm_state_t Act_First_Operation(hsm_event_t event){
+	Calc->operation = HSM_Event_Key(event);
+	LCD_Send_Char(Calc->operation);
+	/* Save the buffer array in first_op variable */
+	Flush_Array(Calc->user_input, &Calc->user_input_index, &Calc->first_op);
+	return HSM_TABLE_NEXT;
+}
+
+/**=============================================
+  * @Fn				- Act_First_Equal
+  * @brief 			- This function will save the first operand before showing it as the result
+  * @param [in] 	- event: '=' event
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- None
   */
-STATE_DEF(Second_Operand){
-	/* State Name */
-	calculator_states_id = Second_Operand;
+static hsm_state_t Act_First_Equal(hsm_event_t event){
+	Flush_Array(Calc->user_input, &Calc->user_input_index, &Calc->first_op);
+	return HSM_TABLE_NEXT;
+}
 
-	/* State Action */
-	pressed_key = keypad_Get_Pressed_Key();
+/**=============================================
+  * @Fn				- Act_Chain_Operation
+  * @brief 			- This function will calculate the pending operation and use its result as the first operand
+  * @param [in] 	- event: Operation event @ref hsm_key_event_t
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- None
+  */
+static hsm_state_t Act_Chain_Operation(hsm_event_t event){
+	Flush_Array(Calc->user_input, &Calc->user_input_index, &Calc->second_op);
+	Calc->result = Calculate_Result(Calc->first_op, Calc->second_op, Calc->operation);
+	sprintf((char*)Calc->result_string, "%lu", (unsigned long)Calc->result);
+	Calc->operation = HSM_Event_Key(event);
+	Calc->first_op = Calc->result;
+	LCD_Send_string_Pos((uint8*)"ANS:            ", LCD_SECOND_ROW, 1);
+	LCD_Send_string_Pos(Calc->result_string, LCD_SECOND_ROW, 6);
+	LCD_Send_string_Pos((uint8*)"                ", LCD_FIRST_ROW, 1);
+	LCD_Send_string_Pos((uint8*)"ANS", LCD_FIRST_ROW, 1);
+	LCD_Send_Char(Calc->operation);
+	return HSM_TABLE_NEXT;
+}
 
-	/* User entered a number */
-	if((0 <= pressed_key) && (10 > pressed_key)){
-		/* Validate that we are not writing outside array boundaries */
-		if(user_input_index < ARRAY_MAX_SIZE){
-			LCD_Send_Char(pressed_key+48);
-			user_input[user_input_index] = pressed_key;
-			user_input_index++;
-		}
-		else{ /* Do Nothing */ }
+/**=============================================
+  * @Fn				- Act_Second_Equal
+  * @brief 			- This function will save the second operand before the result is calculated
+  * @param [in] 	- event: '=' event
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- None
+  */
+static hsm_state_t Act_Second_Equal(hsm_event_t event){
+	Flush_Array(Calc->user_input, &Calc->user_input_index, &Calc->second_op);
+	return HSM_TABLE_NEXT;
+}
+
+/**=============================================
+  * @Fn				- Act_Result_Digit
+  * @brief 			- This function will start a new calculation with a typed digit
+  * @param [in] 	- event: Digit event @ref hsm_key_event_t
+  * @retval 		- HSM_TABLE_NEXT, or HSM_INTERNAL if the buffer is full
+  * Note			- None
+  */
+static hsm_state_t Act_Result_Digit(hsm_event_t event){
+	/* Validate that we are not writing outside array boundaries */
+	if(Calc->user_input_index < ARRAY_MAX_SIZE){
+		LCD_Send_Command(LCD_CLEAR_DISPLAY);
+		return Act_Digit(event);
 	}
-	/* User entered a operation sign */
-	else if(('+' == pressed_key) || ('-' == pressed_key) || ('x' == pressed_key) || ('/' == pressed_key)){
-		Flush_Array(user_input, &user_input_index, &second_op);
-		result = Calculate_Result(first_op, second_op, operation);
-		sprintf((char*)result_string, "%lu", result);
-		operation = pressed_key;
-		first_op = result;
-		LCD_Send_string_Pos((uint8*)"ANS:            ", LCD_SECOND_ROW, 1);
-		LCD_Send_string_Pos(result_string, LCD_SECOND_ROW, 6);
-		LCD_Send_string_Pos((uint8*)"                ", LCD_FIRST_ROW, 1);
-		LCD_Send_string_Pos((uint8*)"ANS", LCD_FIRST_ROW, 1);
-		LCD_Send_Char(pressed_key);
+	else{
+		return HSM_INTERNAL;
 	}
-	/* User Pressed = */
-	else if('=' == pressed_key){
-		Flush_Array(user_input, &user_input_index, &second_op);
-		pfCalculator_State_Handler = STATE_CALL(Result);
+}
+
+/**=============================================
+  * @Fn				- Act_Result_Operation
+  * @brief 			- This function will use the result as the first operand of a new operation
+  * @param [in] 	- event: Operation event @ref hsm_key_event_t
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- None
+  */
+static hsm_state_t Act_Result_Operation(hsm_event_t event){
+	LCD_Send_string_Pos((uint8*)"                ", LCD_FIRST_ROW, 1);
+	Calc->operation = HSM_Event_Key(event);
+	LCD_Send_string_Pos((uint8*)"ANS", LCD_FIRST_ROW, 1);
+	Calc->first_op = Calc->result;
+	LCD_Send_Char(Calc->operation);
+	return HSM_TABLE_NEXT;
+}
+
+/**=============================================
+  * @Fn				- Act_Clear
+  * @brief 			- This function will clear the screen, or exit if 'C' is pressed twice in a row
+  * @param [in] 	- event: 'C' event
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- Shared by all states through Calculator_Common
+  */
+static hsm_state_t Act_Clear(hsm_event_t event){
+	LCD_Send_Command(LCD_CLEAR_DISPLAY);
+	Clear_Values();
+	if((First_Operand == Calculator_HSM.current) && (1 == double_check_before_quitting)){
+		/* The working set goes back to the arena when the mode exits */
+		Calc = NULL;
+		USER_RESET_FLAG = 1;
 	}
-	/* User pressed clear */
-	else if('C' == pressed_key){
-		/* Clear screen, or exit if pressed twice in a row */
+	else{
 		double_check_before_quitting = 1; // flag for first operand state that user pressed C
-		first_op = 0;
-		second_op = 0;
-		operation = 0;
-		result = 0;
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		pfCalculator_State_Handler = STATE_CALL(First_Operand);
 	}
-	else{ /* Do Nothing */ }
+	return HSM_TABLE_NEXT;
 }
 
 /**=============================================
-  * @Fn				- ST_Result
-  * @brief 			- In this state, the system will calculate the result and show it on LCD
+  * @Fn				- Enter_Result
+  * @brief 			- Entry hook of Result, calculates the result and shows it on LCD
   * @param [in] 	- None
-  * @param [out] 	- None
   * @retval 		- None
-  * Note			- This function will be called in Result state
+  * Note			- None
   */
-STATE_DEF(Result){
-	/* State Name */
-	calculator_states_id = Result;
-
-	/* State Action */
-	result = Calculate_Result(first_op, second_op, operation);
-	sprintf((char*)result_string, "%lu", result);
+static void Enter_Result(void){
+	Calc->result = Calculate_Result(Calc->first_op, Calc->second_op, Calc->operation);
+	sprintf((char*)Calc->result_string, "%lu", (unsigned long)Calc->result);
 	LCD_Send_string_Pos((uint8*)"ANS:            ", LCD_SECOND_ROW, 1);
-	LCD_Send_string_Pos(result_string, LCD_SECOND_ROW, 6);
+	LCD_Send_string_Pos(Calc->result_string, LCD_SECOND_ROW, 6);
+}
+
+/* Parent and hooks of every state, indexed by @ref calculator_states_t */
+static const hsm_state_info_t Calculator_States[calculator_states_max] = {
+		[First_Operand]		= {Calculator_Common, NULL, NULL},
+		[Second_Operand]	= {Calculator_Common, NULL, NULL},
+		[Result]			= {Calculator_Common, Enter_Result, NULL},
+		[Calculator_Common]	= {HSM_NO_STATE, NULL, NULL}
+};
 
-	do{
-		pressed_key = keypad_Get_Pressed_Key();
-	}while('F' == pressed_key);
+/* Transitions, unlisted events are left to the parent state */
+#define CALC_DIGITS(_ACTION_, _NEXT_)	[EV_KEY_0] = {_ACTION_, _NEXT_}, [EV_KEY_1] = {_ACTION_, _NEXT_}, \
+										[EV_KEY_2] = {_ACTION_, _NEXT_}, [EV_KEY_3] = {_ACTION_, _NEXT_}, \
+										[EV_KEY_4] = {_ACTION_, _NEXT_}, [EV_KEY_5] = {_ACTION_, _NEXT_}, \
+										[EV_KEY_6] = {_ACTION_, _NEXT_}, [EV_KEY_7] = {_ACTION_, _NEXT_}, \
+										[EV_KEY_8] = {_ACTION_, _NEXT_}, [EV_KEY_9] = {_ACTION_, _NEXT_}
+#define CALC_OPERATIONS(_ACTION_, _NEXT_)	[EV_KEY_PLUS] = {_ACTION_, _NEXT_}, [EV_KEY_MINUS] = {_ACTION_, _NEXT_}, \
+											[EV_KEY_MULTIPLY] = {_ACTION_, _NEXT_}, [EV_KEY_DIVIDE] = {_ACTION_, _NEXT_}
 
-	if((0 <= pressed_key) && (10 > pressed_key)){
-		/* Validate that we are not writing outside array boundaries */
-		if(user_input_index < ARRAY_MAX_SIZE){
-			LCD_Send_Command(LCD_CLEAR_DISPLAY);
-			LCD_Send_Char(pressed_key+48);
-			user_input[user_input_index] = pressed_key;
-			user_input_index++;
-			pfCalculator_State_Handler = STATE_CALL(First_Operand);
+static const hsm_transition_t Calculator_Table[calculator_states_max][hsm_key_events_max] = {
+		[First_Operand] = {
+				CALC_DIGITS(Act_Digit, HSM_INTERNAL),
+				CALC_OPERATIONS(Act_First_Operation, Second_Operand),
+				[EV_KEY_EQUAL] = {Act_First_Equal, Result}
+		},
+		[Second_Operand] = {
+				CALC_DIGITS(Act_Digit, HSM_INTERNAL),
+				CALC_OPERATIONS(Act_Chain_Operation, HSM_INTERNAL),
+				[EV_KEY_EQUAL] = {Act_Second_Equal, Result}
+		},
+		[Result] = {
+				CALC_DIGITS(Act_Result_Digit, First_Operand),
+				CALC_OPERATIONS(Act_Result_Operation, Second_Operand),
+				[EV_KEY_EQUAL] = {HSM_Transit, Result}
+		},
+		[Calculator_Common] = {
+				[EV_KEY_CLEAR] = {Act_Clear, First_Operand}
 		}
-		else{ /* Do Nothing */ }
-	}
-	/* User entered a operation sign */
-	else if(('+' == pressed_key) || ('-' == pressed_key) || ('x' == pressed_key) || ('/' == pressed_key)){
-		LCD_Send_string_Pos((uint8*)"                ", LCD_FIRST_ROW, 1);
-		operation = pressed_key;
-		LCD_Send_string_Pos((uint8*)"ANS", LCD_FIRST_ROW, 1);
-		first_op = result;
-		LCD_Send_Char(operation);
-		pfCalculator_State_Handler = STATE_CALL(Second_Operand);
+};
+
+static const hsm_machine_t Calculator_Machine = {
+		&Calculator_Table[0][0], Calculator_States, calculator_states_max, hsm_key_events_max, First_Operand, TRACE_SRC_CALCULATOR
+};
+
+/**=============================================
+  * @Fn				- ST_Calculator
+  * @brief 			- In this state, the system will pass the pressed key to the calculator state machine
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The first call takes the working set from the arena, any key but 'C' cancels a pending exit
+  */
+STATE_DEF(Calculator){
+	hsm_event_t event;
+	if(NULL == Calc){
+		Calc = Arena_Alloc(sizeof(calculator_work_t));
 	}
-	/* User Pressed = */
-	else if('=' == pressed_key){
-		pfCalculator_State_Handler = STATE_CALL(Result);
+	else{ /* Do Nothing */ }
+	pressed_key = Events_Key();
+	event = HSM_Key_Event(pressed_key);
+	if(hsm_key_events_max != event){
+		if(EV_KEY_CLEAR != event){
+			double_check_before_quitting = 0; // Clear flag
+		}
+		else{ /* Do Nothing */ }
+		HSM_Dispatch(&Calculator_HSM, event);
 	}
-	/* User pressed clear */
-	else if('C' == pressed_key){
-		/* Clear screen, or exit if pressed twice in a row */
-		double_check_before_quitting = 1; // flag for first operand state that user pressed C
-		first_op = 0;
-		second_op = 0;
-		operation = 0;
-		result = 0;
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		pfCalculator_State_Handler = STATE_CALL(First_Operand);
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Calculator_Get_State
+  * @brief 			- Returns the state of the calculator machine
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Current state, HSM_NO_STATE if the mode is not running
+  * Note			- Kept over a warm restart together with the arena
+  */
+hsm_state_t Calculator_Get_State(void){
+	return (NULL == Calc) ? HSM_NO_STATE : Calculator_HSM.current;
+}
+
+/**=============================================
+  * @Fn				- Calculator_Resume
+  * @brief 			- Runs the mode again in the state it had before a warm restart
+  * @param [in] 	- state: State returned by Calculator_Get_State before the restart
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The working set is taken back from the arena as it was, the LCD must be restored by the caller
+  */
+void Calculator_Resume(hsm_state_t state){
+	Calc = Arena_Resume(sizeof(calculator_work_t));
+	HSM_Resume(&Calculator_HSM, state);
+}
+
+/**=============================================
+  * @Fn				- Calculator_Stop
+  * @brief 			- Leaves the mode as if 'C' was pressed twice, the next key starts it again
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The LCD and the arena are left to the caller
+  */
+void Calculator_Stop(void){
+	Calc = NULL;
+	double_check_before_quitting = 0;
+	if(HSM_NO_STATE != Calculator_HSM.current){
+		HSM_Resume(&Calculator_HSM, HSM_NO_STATE);
 	}
 	else{ /* Do Nothing */ }
 }
@@ -17,6 +17,8 @@
 #include "lcd_driver.h"
 #include "keypad_driver.h"
 #include "states.h"
+#include "arena.h"
+#include "events.h"
 
 //----------------------------------------------
 // Section: User type definitions
@@ -25,6 +27,7 @@ typedef enum{
 	First_Operand,
 	Second_Operand,
 	Result,
+	Calculator_Common,		// Parent of all states, handles 'C'
 	calculator_states_max
 }calculator_states_t;
 
@@ -38,33 +41,57 @@ extern uint8 USER_RESET_FLAG; // if 1, then user wants to restart the app
  */
 
 /**=============================================
-  * @Fn				- ST_First_Operand
-  * @brief 			- In this state, the system will store user entry in first operand array
+  * @Fn				- Calculate_Result
+  * @brief 			- This function shall do the calculation and return the result
+  * @param [in] 	- op1: First operand
+  * @param [in] 	- op2: Second operand
+  * @param [in] 	- operator: Operation sign (+,-,x,/)
+  * @param [out] 	- None
+  * @retval 		- Result of the calculation
+  * Note			- In minus operation, it will always return a positive integer which will be the absolute difference
+  * 				- If no operation is specified, it will return the first operand op1
+  * 				- Also used by the serial console
+  */
+uint32 Calculate_Result(uint32 op1, uint32 op2, uint8 operator);
+
+/**=============================================
+  * @Fn				- ST_Calculator
+  * @brief 			- In this state, the system will pass the pressed key to the calculator state machine
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- This function will be called in First_Operand state
+  * Note			- States and transitions are in a table, @ref calculator_states_t
   */
-STATE_DEF(First_Operand);
+STATE_DEF(Calculator);
 
 /**=============================================
-  * @Fn				- ST_Second_Operand
-  * @brief 			- In this state, the system will store user entry in second operand array
+  * @Fn				- Calculator_Get_State
+  * @brief 			- Returns the state of the calculator machine
   * @param [in] 	- None
   * @param [out] 	- None
+  * @retval 		- Current state, HSM_NO_STATE if the mode is not running
+  * Note			- Kept over a warm restart together with the arena
+  */
+hsm_state_t Calculator_Get_State(void);
+
+/**=============================================
+  * @Fn				- Calculator_Resume
+  * @brief 			- Runs the mode again in the state it had before a warm restart
+  * @param [in] 	- state: State returned by Calculator_Get_State before the restart
+  * @param [out] 	- None
   * @retval 		- None
-  * Note			- This function will be called in Second_Operand state
+  * Note			- The working set is taken back from the arena as it was, the LCD must be restored by the caller
   */
-STATE_DEF(Second_Operand);
+void Calculator_Resume(hsm_state_t state);
 
 /**=============================================
-  * @Fn				- ST_Result
-  * @brief 			- In this state, the system will calculate the result and show it on LCD
+  * @Fn				- Calculator_Stop
+  * @brief 			- Leaves the mode as if 'C' was pressed twice, the next key starts it again
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- This function will be called in Result state
+  * Note			- The LCD and the arena are left to the caller
   */
-STATE_DEF(Result);
+void Calculator_Stop(void);
 
 #endif /* CALCULATE_MODE_CALCULATOR_H_ */
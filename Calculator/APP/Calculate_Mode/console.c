@@ -0,0 +1,645 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : console.c 			                                 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "console.h"
+#include "app.h"
+
+#define CONSOLE_DIGITS_MAX	10				// Digits of 4294967295
+#define CONSOLE_VALUE_MAX	4294967295UL
+
+static uint8 Console_RX[CONSOLE_RX_SIZE];
+static uint16 Console_Read;						// Next received byte to be parsed
+static volatile uint8 Console_Pending;			// EVENT_SERIAL is in the queue
+
+/* Replies are added to Console_TX[Console_TX_Active] while the other batch is being sent */
+static uint8 Console_TX[2][CONSOLE_TX_BATCH];
+static uint8 Console_TX_Active;
+static uint8 Console_TX_Fill;
+static volatile uint8 Console_TX_Sending;
+
+/* Line being parsed */
+static uint32 Console_Result;
+static uint32 Console_Value;
+static uint8 Console_Operation;					// Operation before Console_Value, 0 for the first operand
+static uint8 Console_Digits;
+static uint8 Console_Line_Used;					// Line has something besides spaces
+static uint8 Console_Line_Error;
+static uint8 Console_Line_Report;				// Letter of the report the line asks for, 0 for an expression
+
+/* Report being sent */
+static uint8 Console_Report;					// @ref CONSOLE_REPORT_define
+static uint8 Console_Dump_Left;					// Lines not dumped yet
+
+#if LATENCY_ENABLE == 1
+/* Names of the classes of keys, indexed by @ref LATENCY_CLASS_define */
+static const char *const Console_Latency_Names[LATENCY_CLASSES] = {"Dig", "Op", "=", "C"};
+#endif
+#if LCD_TIMING_ENABLE == 1
+/* Names of the driver paths, indexed by @ref LCD_TIMING_SITE_define */
+static const char *const Console_LCD_Site_Names[LCD_TIMING_SITES] = {"Init", "Cmd", "Char"};
+#endif
+
+/**=============================================
+  * @Fn				- Console_Notify
+  * @brief 			- Posts EVENT_SERIAL unless it is already in the queue
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called from the UART interrupts
+  */
+static void Console_Notify(void){
+	if(0 == Console_Pending){
+		Console_Pending = 1;
+		Events_Post(EVENT_SERIAL, 0);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Console_Received
+  * @brief 			- Receive callback of the UART
+  * @param [in] 	- position: Write position of the DMA
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called from the UART interrupts, the requests are parsed by Console_Process
+  */
+static void Console_Received(uint16 position){
+	(void)position;
+	Console_Notify();
+}
+
+/**=============================================
+  * @Fn				- Console_Sent
+  * @brief 			- Frees the sent batch and lets Console_Process send the next one
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called from the UART interrupt
+  */
+static void Console_Sent(void){
+	Console_TX_Sending = 0;
+	Console_Notify();
+}
+
+/**=============================================
+  * @Fn				- Console_Flush
+  * @brief 			- Sends the active batch if the UART is free
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The other batch becomes the active one
+  */
+static void Console_Flush(void){
+	if((0 == Console_TX_Sending) && (0 != Console_TX_Fill)){
+		Console_TX_Sending = 1;
+		if(UART_OK == MCAL_UART_Send_Async(Console_TX[Console_TX_Active], Console_TX_Fill, Console_Sent)){
+			Console_TX_Active ^= 1;
+			Console_TX_Fill = 0;
+		}
+		else{
+			Console_TX_Sending = 0;
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Console_Put_Number
+  * @brief 			- Writes a number in decimal
+  * @param [in] 	- value: Number to be written
+  * @param [out] 	- pOut: Where the digits are written
+  * @retval 		- Pointer past the last digit
+  * Note			- None
+  */
+static uint8 *Console_Put_Number(uint32 value, uint8 *pOut){
+	uint8 digits[CONSOLE_DIGITS_MAX];
+	uint8 count = 0;
+
+	/* Digits come out from the lowest one */
+	do{
+		digits[count++] = (value % 10) + '0';
+		value /= 10;
+	}while(0 != value);
+	while(0 != count){
+		*pOut++ = digits[--count];
+	}
+	return pOut;
+}
+
+/**=============================================
+  * @Fn				- Console_Reply
+  * @brief 			- Adds the reply of the parsed line to the active batch
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The batch must have room for CONSOLE_REPLY_MAX bytes
+  */
+static void Console_Reply(void){
+	uint8 *pOut = &Console_TX[Console_TX_Active][Console_TX_Fill];
+	if(1 == Console_Line_Error){
+		*pOut++ = 'E';
+	}
+	else{
+		pOut = Console_Put_Number(Console_Result, pOut);
+	}
+	*pOut++ = '\n';
+	Console_TX_Fill = pOut - Console_TX[Console_TX_Active];
+}
+
+/**=============================================
+  * @Fn				- Console_Report_Lines
+  * @brief 			- Number of lines of a report
+  * @param [in] 	- report: Letter of the report @ref CONSOLE_REPORT_define
+  * @param [out] 	- None
+  * @retval 		- Lines, 0 if there is no such report
+  * Note			- None
+  */
+static uint8 Console_Report_Lines(uint8 report){
+	uint8 lines;
+	switch(report){
+#if LATENCY_ENABLE == 1
+	case CONSOLE_REPORT_LATENCY:
+		lines = LATENCY_CLASSES;
+		break;
+#endif
+#if LCD_TIMING_ENABLE == 1
+	case CONSOLE_REPORT_LCD_TIMING:
+		lines = 1 + LCD_TIMING_SITES;
+		break;
+#endif
+#if REPLAY_ENABLE == 1
+	case CONSOLE_REPORT_REPLAY:
+	case CONSOLE_REPORT_PLAY:
+#endif
+	case CONSOLE_REPORT_MEMORY:
+	case CONSOLE_REPORT_EVENTS:
+	case CONSOLE_REPORT_RETAIN:
+	case CONSOLE_REPORT_VECTORS:
+		lines = 1;
+		break;
+	default:
+		lines = 0;
+		break;
+	}
+	return lines;
+}
+
+#if LATENCY_ENABLE == 1
+/**=============================================
+  * @Fn				- Console_Latency_Line
+  * @brief 			- Writes the histogram of one class of keys
+  * @param [in] 	- class: Class of keys @ref LATENCY_CLASS_define
+  * @param [out] 	- pOut: Where the line is written
+  * @retval 		- Pointer past the '\n'
+  * Note			- None
+  */
+static uint8 *Console_Latency_Line(uint8 class, uint8 *pOut){
+	latency_histogram_t histogram;
+	uint8 bin;
+	Latency_Get_Histogram(class, &histogram);
+	memcpy(pOut, Console_Latency_Names[class], strlen(Console_Latency_Names[class]));
+	pOut += strlen(Console_Latency_Names[class]);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(histogram.count, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(histogram.no_update, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(histogram.max_us, pOut);
+	for(bin = 0; bin < LATENCY_BINS; bin++){
+		*pOut++ = ' ';
+		pOut = Console_Put_Number(histogram.bins[bin], pOut);
+	}
+	*pOut++ = '\n';
+	return pOut;
+}
+#endif
+
+#if LCD_TIMING_ENABLE == 1
+/**=============================================
+  * @Fn				- Console_LCD_Timing_Line
+  * @brief 			- Writes the hook cost, or the bus timings of one driver path
+  * @param [in] 	- line: 0 for the hook cost, else the driver path @ref LCD_TIMING_SITE_define plus 1
+  * @param [out] 	- pOut: Where the line is written
+  * @retval 		- Pointer past the '\n'
+  * Note			- Slacks are in cycles, negative ones are written with a '-'
+  */
+static uint8 *Console_LCD_Timing_Line(uint8 line, uint8 *pOut){
+	LCD_Timing_Report_t report;
+	LCD_Timing_Site_t *pSite;
+	uint32 violations = 0;
+	uint8 constraint;
+	LCD_Timing_Get_Report(&report);
+	if(0 == line){
+		*pOut++ = CONSOLE_REPORT_LCD_TIMING;
+		*pOut++ = ' ';
+		pOut = Console_Put_Number(report.hook_cycles, pOut);
+	}
+	else{
+		pSite = &report.site[line - 1];
+		for(constraint = 0; constraint < LCD_TIMING_CONSTRAINTS; constraint++){
+			violations += pSite->violations[constraint];
+		}
+		memcpy(pOut, Console_LCD_Site_Names[line - 1], strlen(Console_LCD_Site_Names[line - 1]));
+		pOut += strlen(Console_LCD_Site_Names[line - 1]);
+		*pOut++ = ' ';
+		pOut = Console_Put_Number(pSite->transactions, pOut);
+		*pOut++ = ' ';
+		pOut = Console_Put_Number(violations, pOut);
+		for(constraint = 0; constraint < LCD_TIMING_CONSTRAINTS; constraint++){
+			*pOut++ = ' ';
+			if(0 > pSite->min_slack[constraint]){
+				*pOut++ = '-';
+				pOut = Console_Put_Number(0UL - (uint32)pSite->min_slack[constraint], pOut);
+			}
+			else{
+				pOut = Console_Put_Number((uint32)pSite->min_slack[constraint], pOut);
+			}
+		}
+	}
+	*pOut++ = '\n';
+	return pOut;
+}
+#endif
+
+#if REPLAY_ENABLE == 1
+/**=============================================
+  * @Fn				- Console_Replay_Line
+  * @brief 			- Writes the results of the last replay session
+  * @param [out] 	- pOut: Where the line is written
+  * @retval 		- Pointer past the '\n'
+  * Note			- Fields in the order of @ref replay_report_t
+  */
+static uint8 *Console_Replay_Line(uint8 *pOut){
+	replay_report_t report;
+	uint32 fields[7];
+	uint8 field;
+	Replay_Get_Report(&report);
+	fields[0] = report.mode;
+	fields[1] = report.keys;
+	fields[2] = report.dropped;
+	fields[3] = report.handled;
+	fields[4] = report.latency_max_us;
+	fields[5] = report.latency_avg_us;
+	fields[6] = report.session_ms;
+	*pOut++ = CONSOLE_REPORT_REPLAY;
+	for(field = 0; field < 7; field++){
+		*pOut++ = ' ';
+		pOut = Console_Put_Number(fields[field], pOut);
+	}
+	*pOut++ = '\n';
+	return pOut;
+}
+
+/**=============================================
+  * @Fn				- Console_Play_Line
+  * @brief 			- Replays the last recording and writes how many keys it has
+  * @param [out] 	- pOut: Where the line is written
+  * @retval 		- Pointer past the '\n'
+  * Note			- The machine goes back to where the recording started first, @ref main_replay_play
+  */
+static uint8 *Console_Play_Line(uint8 *pOut){
+	uint16 length;
+	main_replay_play();
+	(void)Replay_Get_Recording(&length);
+	*pOut++ = CONSOLE_REPORT_PLAY;
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(length / REPLAY_KEY_BYTES, pOut);
+	*pOut++ = '\n';
+	return pOut;
+}
+#endif
+
+/**=============================================
+  * @Fn				- Console_Memory_Line
+  * @brief 			- Writes the stack, heap and arena usage
+  * @param [out] 	- pOut: Where the line is written
+  * @retval 		- Pointer past the '\n'
+  * Note			- Fields in the order of @ref mem_usage_t, then the peak of the arena
+  */
+static uint8 *Console_Memory_Line(uint8 *pOut){
+	mem_usage_t usage;
+	uint32 fields[9];
+	uint8 field;
+	Mem_Get_Usage(&usage);
+	fields[0] = usage.stack_limit;
+	fields[1] = usage.stack_peak;
+	fields[2] = usage.heap_used;
+	fields[3] = usage.heap_peak;
+	fields[4] = usage.never_used;
+	fields[5] = usage.sbrk_calls;
+	fields[6] = usage.sbrk_failures;
+	fields[7] = usage.stack_overflow;
+	fields[8] = Arena_Get_Peak();
+	*pOut++ = CONSOLE_REPORT_MEMORY;
+	for(field = 0; field < 9; field++){
+		*pOut++ = ' ';
+		pOut = Console_Put_Number(fields[field], pOut);
+	}
+	*pOut++ = '\n';
+	return pOut;
+}
+
+/**=============================================
+  * @Fn				- Console_Events_Line
+  * @brief 			- Writes the idle and wakeup statistics of the event queue
+  * @param [out] 	- pOut: Where the line is written
+  * @retval 		- Pointer past the '\n'
+  * Note			- Fields in the order of @ref events_stats_t
+  */
+static uint8 *Console_Events_Line(uint8 *pOut){
+	events_stats_t stats;
+	Events_Get_Stats(&stats);
+	*pOut++ = CONSOLE_REPORT_EVENTS;
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(stats.idle_percent, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(stats.wakeups_per_second, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(stats.events_per_second, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(stats.dropped, pOut);
+	*pOut++ = '\n';
+	return pOut;
+}
+
+/**=============================================
+  * @Fn				- Console_Retain_Line
+  * @brief 			- Writes how often and how long the retained record of main was saved
+  * @param [out] 	- pOut: Where the line is written
+  * @retval 		- Pointer past the '\n'
+  * Note			- Fields in the order of @ref main_retain_stats_t, then the resume time of @ref main_boot_time_t
+  */
+static uint8 *Console_Retain_Line(uint8 *pOut){
+	main_retain_stats_t stats;
+	main_boot_time_t boot;
+	main_get_retain_stats(&stats);
+	main_get_boot_time(&boot);
+	*pOut++ = CONSOLE_REPORT_RETAIN;
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(stats.saves, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(stats.skipped, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(stats.last_cycles, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(stats.max_cycles, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(stats.reset_flags >> 24, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(boot.resume_ms, pOut);
+	*pOut++ = '\n';
+	return pOut;
+}
+
+/**=============================================
+  * @Fn				- Console_Vectors_Line
+  * @brief 			- Measures and writes the interrupt entry latency with the handler in flash and in SRAM
+  * @param [out] 	- pOut: Where the line is written
+  * @retval 		- Pointer past the '\n'
+  * Note			- Runs from the main loop, VECT_TEST_IRQ must be able to preempt it
+  */
+static uint8 *Console_Vectors_Line(uint8 *pOut){
+	VECT_Latency_t latency;
+	MCAL_VECT_Measure_Latency(&latency);
+	*pOut++ = CONSOLE_REPORT_VECTORS;
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(latency.flash_cycles, pOut);
+	*pOut++ = ' ';
+	pOut = Console_Put_Number(latency.ram_cycles, pOut);
+	*pOut++ = '\n';
+	return pOut;
+}
+
+/**=============================================
+  * @Fn				- Console_Dump_Line
+  * @brief 			- Adds the next line of the report to the active batch
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The batch must have room for CONSOLE_DUMP_LINE_MAX bytes
+  */
+static void Console_Dump_Line(void){
+	uint8 line = Console_Report_Lines(Console_Report) - Console_Dump_Left;
+	uint8 *pOut = &Console_TX[Console_TX_Active][Console_TX_Fill];
+	switch(Console_Report){
+#if LATENCY_ENABLE == 1
+	case CONSOLE_REPORT_LATENCY:
+		pOut = Console_Latency_Line(line, pOut);
+		break;
+#endif
+#if LCD_TIMING_ENABLE == 1
+	case CONSOLE_REPORT_LCD_TIMING:
+		pOut = Console_LCD_Timing_Line(line, pOut);
+		break;
+#endif
+#if REPLAY_ENABLE == 1
+	case CONSOLE_REPORT_REPLAY:
+		pOut = Console_Replay_Line(pOut);
+		break;
+	case CONSOLE_REPORT_PLAY:
+		pOut = Console_Play_Line(pOut);
+		break;
+#endif
+	case CONSOLE_REPORT_MEMORY:
+		pOut = Console_Memory_Line(pOut);
+		break;
+	case CONSOLE_REPORT_EVENTS:
+		pOut = Console_Events_Line(pOut);
+		break;
+	case CONSOLE_REPORT_RETAIN:
+		pOut = Console_Retain_Line(pOut);
+		break;
+	case CONSOLE_REPORT_VECTORS:
+		pOut = Console_Vectors_Line(pOut);
+		break;
+	default:
+		break;
+	}
+	(void)line;			// Not used without LATENCY_ENABLE or LCD_TIMING_ENABLE
+	Console_TX_Fill = pOut - Console_TX[Console_TX_Active];
+	Console_Dump_Left--;
+}
+
+/**=============================================
+  * @Fn				- Console_Dump
+  * @brief 			- Adds the lines of the report that fit in the batches
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Number of lines left, 0 if the report is done
+  * Note			- If both batches are full Console_Sent brings us back for the rest
+  */
+static uint8 Console_Dump(void){
+	while(0 != Console_Dump_Left){
+		if((CONSOLE_TX_BATCH - CONSOLE_DUMP_LINE_MAX) < Console_TX_Fill){
+			Console_Flush();
+			if((CONSOLE_TX_BATCH - CONSOLE_DUMP_LINE_MAX) < Console_TX_Fill){
+				break;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+		Console_Dump_Line();
+	}
+	return Console_Dump_Left;
+}
+
+/**=============================================
+  * @Fn				- Console_New_Line
+  * @brief 			- Clears the line being parsed
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void Console_New_Line(void){
+	Console_Result = 0;
+	Console_Value = 0;
+	Console_Operation = 0;
+	Console_Digits = 0;
+	Console_Line_Used = 0;
+	Console_Line_Error = 0;
+	Console_Line_Report = 0;
+}
+
+/**=============================================
+  * @Fn				- Console_Operand_Done
+  * @brief 			- Does the pending operation with the operand just parsed
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The first operand of the line becomes the result as it is
+  */
+static void Console_Operand_Done(void){
+	if(0 == Console_Digits){
+		Console_Line_Error = 1;
+	}
+	else if(0 == Console_Operation){
+		Console_Result = Console_Value;
+	}
+	else{
+		Console_Result = Calculate_Result(Console_Result, Console_Value, Console_Operation);
+	}
+	Console_Value = 0;
+	Console_Digits = 0;
+}
+
+/**=============================================
+  * @Fn				- Console_Parse
+  * @brief 			- Parses one received byte
+  * @param [in] 	- byte: Received byte
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- A '\n' adds the reply to the active batch, which must have room for CONSOLE_REPLY_MAX bytes
+  */
+static void Console_Parse(uint8 byte){
+	uint8 digit;
+	if(('0' <= byte) && ('9' >= byte)){
+		digit = byte - '0';
+		Console_Line_Used = 1;
+		if((CONSOLE_DIGITS_MAX <= Console_Digits) || (((CONSOLE_VALUE_MAX - digit) / 10) < Console_Value)){
+			Console_Line_Error = 1;
+		}
+		else{
+			Console_Value = (Console_Value * 10) + digit;
+			Console_Digits++;
+		}
+	}
+	else if(('+' == byte) || ('-' == byte) || ('x' == byte) || ('*' == byte) || ('/' == byte)){
+		Console_Line_Used = 1;
+		/* Same chaining as the keypad, the pending operation is done before the next one */
+		Console_Operand_Done();
+		Console_Operation = ('*' == byte) ? 'x' : byte;
+	}
+	else if((0 == Console_Line_Used) && (0 != Console_Report_Lines(byte))){
+		Console_Line_Used = 1;
+		Console_Line_Report = byte;
+	}
+	else if(('\n' == byte) && (0 != Console_Line_Report) && (0 == Console_Line_Error)){
+		/* Console_Process sends the lines as the batches have room */
+		Console_Report = Console_Line_Report;
+		Console_Dump_Left = Console_Report_Lines(Console_Report);
+		Console_New_Line();
+	}
+	else if('\n' == byte){
+		if(1 == Console_Line_Used){
+			Console_Operand_Done();
+			Console_Reply();
+		}
+		else{ /* Do Nothing */ }
+		Console_New_Line();
+	}
+	else if((' ' == byte) || ('\r' == byte)){
+		/* Do Nothing */
+	}
+	else{
+		Console_Line_Used = 1;
+		Console_Line_Error = 1;
+	}
+}
+
+/**=============================================
+  * @Fn				- Console_Init
+  * @brief 			- Initializes the UART and starts receiving requests
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- New requests and sent replies post EVENT_SERIAL
+  */
+void Console_Init(void){
+	UART_config_t uart_cfg;
+	uart_cfg.baud_rate = CONSOLE_BAUD_RATE;
+	uart_cfg.stop_bits = UART_STOP_BITS_1;
+	/* Checked against UART_BAUD_MAX when built */
+	(void)MCAL_UART_Init(&uart_cfg);
+	Console_New_Line();
+	Console_Read = 0;
+	MCAL_UART_Receive_Start(Console_RX, CONSOLE_RX_SIZE, Console_Received);
+}
+
+/**=============================================
+  * @Fn				- Console_Process
+  * @brief 			- Answers the received requests and sends the replies
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called on EVENT_SERIAL, stops early if both reply batches are full and goes on once one is sent
+  */
+void Console_Process(void){
+	uint16 position;
+	uint8 byte;
+
+	/* Cleared first so bytes received from now on post a new event */
+	Console_Pending = 0;
+	position = MCAL_UART_Receive_Position();
+	while(Console_Read != position){
+		/* Lines of a report go out before the replies of the next requests */
+		if(0 != Console_Dump()){
+			break;
+		}
+		else{ /* Do Nothing */ }
+		byte = Console_RX[Console_Read];
+		if(('\n' == byte) && ((CONSOLE_TX_BATCH - CONSOLE_REPLY_MAX) < Console_TX_Fill)){
+			Console_Flush();
+			if((CONSOLE_TX_BATCH - CONSOLE_REPLY_MAX) < Console_TX_Fill){
+				/* Both batches are full, Console_Sent brings us back */
+				break;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+		Console_Parse(byte);
+		Console_Read = (Console_Read + 1) % CONSOLE_RX_SIZE;
+	}
+
+	/* Report asked by the last line */
+	(void)Console_Dump();
+
+	/* Caught up with the requests, send what was answered */
+	Console_Flush();
+}
@@ -0,0 +1,116 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : console.h 			                                 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef CALCULATE_MODE_CONSOLE_H_
+#define CALCULATE_MODE_CONSOLE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "uart_driver.h"
+#include "events.h"
+#include "trace.h"
+#include "calculator.h"
+#include "latency.h"
+#include "memory_usage.h"
+#include "vector_driver.h"
+#include "replay.h"
+#include "arena.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+/*
+ * Requests are lines like "12+34x5\n", evaluated from left to right by Calculate_Result like the keypad does.
+ * The reply is the result as a decimal number and '\n', or "E\n" if the line is not valid.
+ * A line with only the letter of a report @ref CONSOLE_REPORT_define is answered with the report, numbers in decimal:
+ * - "L", with LATENCY_ENABLE: one line per class of keys @ref LATENCY_CLASS_define,
+ *   "<name> <count> <no update> <max us> <bin 0> ... <bin LATENCY_BINS - 1>\n"
+ * - "T", with LCD_TIMING_ENABLE: "T <hook cycles>\n" then one line per driver path @ref LCD_TIMING_SITE_define,
+ *   "<name> <transactions> <violations> <min slack> ... <min slack>\n" with the smallest slack in cycles of every
+ *   constraint of LCD_Timing_Constraint_t, 2147483647 if it was never checked, see @ref LCD_Timing_Report_t
+ * - "M": "M <stack limit> <stack peak> <heap used> <heap peak> <never used> <sbrk calls> <sbrk failures> <overflow>
+ *   <arena peak>\n" in bytes, see @ref mem_usage_t, and the most bytes the modes took of ARENA_SIZE, see Arena_Get_Peak
+ * - "S": "S <idle percent> <wakeups/s> <events/s> <dropped>\n" of the last window, see @ref events_stats_t
+ * - "W": "W <saves> <skipped> <last save cycles> <max save cycles> <RCC->CSR bits 31...24> <resume ms>\n" of the
+ *   record main keeps over a warm restart, see main_retain_stats_t in app.h
+ * - "V": "V <flash cycles> <SRAM cycles>\n" from pending an interrupt to the first instruction of a handler in flash
+ *   and in SRAM, measured when asked by MCAL_VECT_Measure_Latency, see @ref VECT_Latency_t
+ * - "R", with REPLAY_ENABLE: "R <mode> <keys> <dropped> <handled> <max us> <average us> <session ms>\n" of the last
+ *   replay session, see @ref replay_report_t
+ * - "P", with REPLAY_ENABLE: stops the session and replays the last recording in place of the keypad, with the times
+ *   it was recorded with, answered with "P <keys>\n", the keys to be replayed
+ * Requests may be sent without waiting for the replies, as long as no more than CONSOLE_RX_SIZE bytes are unanswered.
+ *
+ * Throughput targets, for 10 byte requests, replies of at most 9 bytes and 10 bits per byte on the line:
+ * - 115200 baud: 1152 expressions/s, the line to the board (11520 bytes/s, 11594 with BRR 69)
+ * - 2 Mbit/s: 16000 expressions/s. The line carries 200000 bytes/s, 20000 requests/s, but needs a UART_PCLK of
+ *   16 x 2 MHz = 32 MHz or more (APB1 at 36 MHz from a 72 MHz clock), and the parser is estimated at about 500
+ *   cycles a request, 16000/s at 8 MHz. The line is the limit only if the core also runs faster than 10 MHz.
+ * The board configuration, UART_PCLK of 8 MHz, stops at UART_BAUD_MAX (500000 baud, 5000 expressions/s): the
+ * loopback of Host/unit/test_console gets 1158/s at 115200 baud and 4998/s at 500000 baud, both 100% of the line
+ * to the board. The simulator does not count the cycles of the parser, so the 500 cycles are not measured.
+ */
+#ifndef CONSOLE_ENABLE
+#define CONSOLE_ENABLE			0			// 1 to answer requests over the UART, needs TRACE_ENABLE 0
+#endif
+#define CONSOLE_BAUD_RATE		115200UL
+#define CONSOLE_RX_SIZE			256			// Circular receive buffer written by the DMA
+#define CONSOLE_TX_BATCH		128			// Replies are sent in batches of up to this many bytes
+
+#if CONSOLE_BAUD_RATE > UART_BAUD_MAX
+#error "CONSOLE_BAUD_RATE is above UART_BAUD_MAX, MCAL_UART_Init would refuse it"
+#endif
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define CONSOLE_REPLY_MAX		11			// 10 digits and '\n'
+#define CONSOLE_DUMP_LINE_MAX	(4 + (6 * (LATENCY_BINS + 2)) + 11)	// Longest line of a report: latency, name, 5 digit counts, 10 digit max and '\n'
+
+/* @ref CONSOLE_REPORT_define */
+#define CONSOLE_REPORT_LATENCY	'L'
+#define CONSOLE_REPORT_LCD_TIMING	'T'
+#define CONSOLE_REPORT_MEMORY	'M'
+#define CONSOLE_REPORT_EVENTS	'S'
+#define CONSOLE_REPORT_RETAIN	'W'
+#define CONSOLE_REPORT_VECTORS	'V'
+#define CONSOLE_REPORT_REPLAY	'R'
+#define CONSOLE_REPORT_PLAY		'P'
+
+#if (CONSOLE_ENABLE == 1) && (TRACE_ENABLE == 1)
+#error "Console and trace share the UART, set TRACE_ENABLE to 0"
+#endif
+
+/*
+ * =============================================
+ * APIs Supported by "console"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Console_Init
+  * @brief 			- Initializes the UART and starts receiving requests
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- New requests and sent replies post EVENT_SERIAL
+  */
+void Console_Init(void);
+
+/**=============================================
+  * @Fn				- Console_Process
+  * @brief 			- Answers the received requests and sends the replies
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called on EVENT_SERIAL, stops early if both reply batches are full and goes on once one is sent
+  */
+void Console_Process(void);
+
+#endif /* CALCULATE_MODE_CONSOLE_H_ */
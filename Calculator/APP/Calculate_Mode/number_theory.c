@@ -0,0 +1,945 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : number_theory.c 			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "number_theory.h"
+
+#define NT_OPERAND_MAX_DIGITS	16 // 9999999999999999 is the biggest operand that fits on one LCD row
+#define NT_STRING_SIZE			64 // Enough for the longest factorization string of a 64-bit number
+#define NT_MARQUEE_PERIOD_MS	400 // Milliseconds between two scroll steps of a result wider than the LCD
+#define NT_MR_BASES_NUM			12 // Testing the first 12 primes as witnesses is deterministic for all 64-bit numbers
+
+void (*pfNumber_Theory_State_Handler)(void) = STATE_CALL(NT_Operand_Entry);
+static number_theory_states_t nt_state_id = number_theory_states_max;
+static nt_job_t NT_Job;							// Job of the running operation
+static nt_operation_t NT_Operation;				// Operation selected by the user
+static uint64 NT_Operands[3];					// Operands A, B and M
+static uint8 NT_Operand_Index;					// Index of the operand being typed in "NT_Operands"
+static uint8 NT_Operand_Length;					// Number of digits typed in the current operand
+static uint64 NT_Answer;						// Last result, used as operand A when an operation key is pressed
+static uint8 NT_Answer_Valid;					// 1 if "NT_Answer" holds a finished result
+static uint8 pressed_key;
+static uint8 double_check_before_quitting;
+static uint8 NT_String[NT_STRING_SIZE];
+
+static const uint8 NT_MR_Bases[NT_MR_BASES_NUM] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+
+/* Labels of the operations, indexed by @ref nt_operation_t */
+static const char *const NT_Operation_Labels[] = {
+		"", "GCD", "LCM", "A^B MOD M", "PRIME TEST", "FACTOR"
+};
+
+/* Operand names, indexed by "NT_Operand_Index" */
+static const char NT_Operand_Names[3] = {'A', 'B', 'M'};
+
+/**=============================================
+  * @Fn				- NT_GCD
+  * @brief 			- Calculates the greatest common divisor of two numbers
+  * @param [in] 	- a: First number
+  * @param [in] 	- b: Second number
+  * @retval 		- GCD of a and b
+  * Note			- Stein's binary algorithm, uses only shifts and subtractions
+  */
+uint64 NT_GCD(uint64 a, uint64 b){
+	uint8 shift;
+	uint64 temp;
+	if(0 == a){
+		return b;
+	}
+	else if(0 == b){
+		return a;
+	}
+	else{ /* Do Nothing */ }
+
+	/* Common power of 2 */
+	shift = __builtin_ctzll(a | b);
+	a >>= __builtin_ctzll(a);
+	do{
+		b >>= __builtin_ctzll(b);
+		if(a > b){
+			temp = a;
+			a = b;
+			b = temp;
+		}
+		else{ /* Do Nothing */ }
+		b -= a;
+	}while(0 != b);
+	return (a << shift);
+}
+
+/**=============================================
+  * @Fn				- NT_LCM
+  * @brief 			- Calculates the least common multiple of two numbers
+  * @param [in] 	- a: First number
+  * @param [in] 	- b: Second number
+  * @retval 		- LCM of a and b, or 0 if any of them is 0 or the result does not fit in 64 bits
+  * Note			- None
+  */
+uint64 NT_LCM(uint64 a, uint64 b){
+	uint64 quotient;
+	if((0 == a) || (0 == b)){
+		return 0;
+	}
+	else{ /* Do Nothing */ }
+	quotient = a / NT_GCD(a, b);
+	if(quotient > (0xFFFFFFFFFFFFFFFFULL / b)){
+		return 0;
+	}
+	else{ /* Do Nothing */ }
+	return (quotient * b);
+}
+
+/**=============================================
+  * @Fn				- NT_AddMod
+  * @brief 			- Calculates (a + b) mod m without overflowing 64 bits
+  * @param [in] 	- a: First number, must be less than m
+  * @param [in] 	- b: Second number, must be less than m
+  * @param [in] 	- m: Modulus
+  * @retval 		- (a + b) mod m
+  * Note			- None
+  */
+static uint64 NT_AddMod(uint64 a, uint64 b, uint64 m){
+	return (a >= (m - b)) ? (a - (m - b)) : (a + b);
+}
+
+/**=============================================
+  * @Fn				- NT_MulMod
+  * @brief 			- Calculates (a * b) mod m without overflowing 64 bits
+  * @param [in] 	- a: First factor
+  * @param [in] 	- b: Second factor
+  * @param [in] 	- m: Modulus, must not be 0
+  * @retval 		- (a * b) mod m
+  * Note			- Moduli below 2^32 use a single 64-bit multiplication
+  */
+uint64 NT_MulMod(uint64 a, uint64 b, uint64 m){
+	uint64 result = 0;
+	a %= m;
+	b %= m;
+	if(0xFFFFFFFFULL >= m){
+		return ((a * b) % m);
+	}
+	else{ /* Do Nothing */ }
+
+	/* Double-and-add, every intermediate value stays below m */
+	while(0 != b){
+		if(b & 1){
+			result = NT_AddMod(result, a, m);
+		}
+		else{ /* Do Nothing */ }
+		a = NT_AddMod(a, a, m);
+		b >>= 1;
+	}
+	return result;
+}
+
+/**=============================================
+  * @Fn				- NT_PowMod
+  * @brief 			- Calculates (base ^ exp) mod m
+  * @param [in] 	- base: Base number
+  * @param [in] 	- exp: Exponent
+  * @param [in] 	- m: Modulus
+  * @retval 		- (base ^ exp) mod m, or 0 if m is 0
+  * Note			- Square-and-multiply, not time-sliced
+  */
+uint64 NT_PowMod(uint64 base, uint64 exp, uint64 m){
+	uint64 result;
+	if(0 == m){
+		return 0;
+	}
+	else{ /* Do Nothing */ }
+	result = (1 % m);
+	base %= m;
+	while(0 != exp){
+		if(exp & 1){
+			result = NT_MulMod(result, base, m);
+		}
+		else{ /* Do Nothing */ }
+		base = NT_MulMod(base, base, m);
+		exp >>= 1;
+	}
+	return result;
+}
+
+/**=============================================
+  * @Fn				- NT_MR_Witness
+  * @brief 			- Checks whether n passes the Miller-Rabin test for one witness
+  * @param [in] 	- n: Odd number to be tested
+  * @param [in] 	- d: Odd part of n-1
+  * @param [in] 	- s: Power of 2 in n-1, so n-1 = d * 2^s
+  * @param [in] 	- a: Witness
+  * @retval 		- 1 if n is a strong probable prime to base a, 0 if n is composite
+  * Note			- None
+  */
+static uint8 NT_MR_Witness(uint64 n, uint64 d, uint8 s, uint64 a){
+	uint64 x = NT_PowMod(a, d, n);
+	uint8 index;
+	if((1 == x) || ((n - 1) == x)){
+		return 1;
+	}
+	else{ /* Do Nothing */ }
+	for(index = 1; index < s; index++){
+		x = NT_MulMod(x, x, n);
+		if((n - 1) == x){
+			return 1;
+		}
+		else{ /* Do Nothing */ }
+	}
+	return 0;
+}
+
+/**=============================================
+  * @Fn				- NT_Add_Factor
+  * @brief 			- Adds a prime factor to the factor list of a job
+  * @param 		 	- job: Pointer to the job
+  * @param [in] 	- prime: Prime factor to be added
+  * @param [in] 	- exponent: Number of times it divides the number
+  * @retval 		- None
+  * Note			- The exponent is accumulated if the prime is already in the list
+  */
+static void NT_Add_Factor(nt_job_t *job, uint64 prime, uint8 exponent){
+	uint8 index;
+	for(index = 0; index < job->factors_count; index++){
+		if(prime == job->factors[index].prime){
+			job->factors[index].exponent += exponent;
+			return;
+		}
+		else{ /* Do Nothing */ }
+	}
+	if(NT_MAX_FACTORS > job->factors_count){
+		job->factors[job->factors_count].prime = prime;
+		job->factors[job->factors_count].exponent = exponent;
+		job->factors_count++;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- NT_Push_Composite
+  * @brief 			- Adds a cofactor to the list of cofactors still to be split
+  * @param 		 	- job: Pointer to the job
+  * @param [in] 	- composite: Cofactor to be added
+  * @retval 		- None
+  * Note			- None
+  */
+static void NT_Push_Composite(nt_job_t *job, uint64 composite){
+	if(NT_MAX_COMPOSITES > job->composites_count){
+		job->composites[job->composites_count] = composite;
+		job->composites_count++;
+	}
+	else{
+		job->incomplete = 1;
+		job->result = composite;
+	}
+}
+
+/**=============================================
+  * @Fn				- NT_Sort_Factors
+  * @brief 			- Sorts the factor list of a job in ascending order
+  * @param 		 	- job: Pointer to the job
+  * @retval 		- None
+  * Note			- Insertion sort, the list has at most NT_MAX_FACTORS entries
+  */
+static void NT_Sort_Factors(nt_job_t *job){
+	nt_factor_t temp;
+	sint8 index, inner;
+	for(index = 1; index < job->factors_count; index++){
+		temp = job->factors[index];
+		inner = index - 1;
+		while((0 <= inner) && (job->factors[inner].prime > temp.prime)){
+			job->factors[inner + 1] = job->factors[inner];
+			inner--;
+		}
+		job->factors[inner + 1] = temp;
+	}
+}
+
+/**=============================================
+  * @Fn				- NT_Start_Prime_Test
+  * @brief 			- Prepares the Miller-Rabin state for the current cofactor of a job
+  * @param 		 	- job: Pointer to the job
+  * @retval 		- None
+  * Note			- None
+  */
+static void NT_Start_Prime_Test(nt_job_t *job){
+	job->mr_d = job->current - 1;
+	job->mr_s = 0;
+	while(0 == (job->mr_d & 1)){
+		job->mr_d >>= 1;
+		job->mr_s++;
+	}
+	job->mr_base_index = 0;
+	job->phase = NT_PHASE_PRIME_TEST;
+}
+
+/**=============================================
+  * @Fn				- NT_Start_Rho
+  * @brief 			- Prepares the Pollard-rho state for the current cofactor of a job
+  * @param 		 	- job: Pointer to the job
+  * @param [in] 	- c: Constant of the polynomial x^2 + c
+  * @retval 		- None
+  * Note			- None
+  */
+static void NT_Start_Rho(nt_job_t *job, uint64 c){
+	job->rho_x = 2;
+	job->rho_y = 2;
+	job->rho_c = c;
+	job->rho_q = 1;
+	job->phase = NT_PHASE_RHO;
+}
+
+/**=============================================
+  * @Fn				- NT_Trial_Division
+  * @brief 			- Runs the trial division slice of a PRIME or FACTOR job
+  * @param 		 	- job: Pointer to the job
+  * @retval 		- None
+  * Note			- Numbers below NT_TRIAL_LIMIT^2 are finished here
+  */
+static void NT_Trial_Division(nt_job_t *job){
+	uint64 n = job->current;
+	uint64 divisor;
+	uint8 exponent;
+
+	if(NT_OP_PRIME == job->operation){
+		if(2 > n){
+			job->result = 0;
+			job->phase = NT_PHASE_DONE;
+			return;
+		}
+		else{ /* Do Nothing */ }
+		for(divisor = 2; divisor < NT_TRIAL_LIMIT; divisor = (2 == divisor) ? 3 : (divisor + 2)){
+			if((divisor * divisor) > n){
+				job->result = 1;
+				job->phase = NT_PHASE_DONE;
+				return;
+			}
+			else if(0 == (n % divisor)){
+				job->result = 0;
+				job->phase = NT_PHASE_DONE;
+				return;
+			}
+			else{ /* Do Nothing */ }
+		}
+		NT_Start_Prime_Test(job);
+	}
+	else{
+		if(2 > n){
+			job->phase = NT_PHASE_DONE;
+			return;
+		}
+		else{ /* Do Nothing */ }
+		for(divisor = 2; (divisor < NT_TRIAL_LIMIT) && ((divisor * divisor) <= n); divisor = (2 == divisor) ? 3 : (divisor + 2)){
+			exponent = 0;
+			while(0 == (n % divisor)){
+				n /= divisor;
+				exponent++;
+			}
+			if(0 != exponent){
+				NT_Add_Factor(job, divisor, exponent);
+			}
+			else{ /* Do Nothing */ }
+		}
+		if((NT_TRIAL_LIMIT * NT_TRIAL_LIMIT) > n){
+			/* No factor below NT_TRIAL_LIMIT is left, so n is 1 or a prime */
+			if(1 != n){
+				NT_Add_Factor(job, n, 1);
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{
+			NT_Push_Composite(job, n);
+		}
+		job->phase = NT_PHASE_NEXT_COMPOSITE;
+	}
+}
+
+/**=============================================
+  * @Fn				- NT_Rho_Slice
+  * @brief 			- Runs NT_RHO_SLICE_STEPS Pollard-rho iterations on the current cofactor of a job
+  * @param 		 	- job: Pointer to the job
+  * @retval 		- None
+  * Note			- Differences are multiplied together and one GCD is taken every NT_RHO_GCD_BATCH iterations
+  */
+static void NT_Rho_Slice(nt_job_t *job){
+	uint64 n = job->current;
+	uint64 difference, divisor;
+	uint8 index;
+	for(index = 0; index < NT_RHO_SLICE_STEPS; index++){
+		/* Tortoise moves one step, hare moves two steps on x^2 + c */
+		job->rho_x = NT_AddMod(NT_MulMod(job->rho_x, job->rho_x, n), job->rho_c, n);
+		job->rho_y = NT_AddMod(NT_MulMod(job->rho_y, job->rho_y, n), job->rho_c, n);
+		job->rho_y = NT_AddMod(NT_MulMod(job->rho_y, job->rho_y, n), job->rho_c, n);
+		difference = (job->rho_x > job->rho_y) ? (job->rho_x - job->rho_y) : (job->rho_y - job->rho_x);
+		job->rho_q = NT_MulMod(job->rho_q, difference, n);
+		job->rho_steps++;
+
+		if(0 == (job->rho_steps % NT_RHO_GCD_BATCH)){
+			divisor = NT_GCD(job->rho_q, n);
+			if(n == divisor){
+				/* Cycle closed without splitting n, retry with another polynomial */
+				NT_Start_Rho(job, job->rho_c + 1);
+				return;
+			}
+			else if(1 != divisor){
+				NT_Push_Composite(job, divisor);
+				NT_Push_Composite(job, n / divisor);
+				job->phase = NT_PHASE_NEXT_COMPOSITE;
+				return;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+
+		if(NT_RHO_STEP_BUDGET <= job->rho_steps){
+			/* Give up on this cofactor, it is reported unfactored */
+			job->incomplete = 1;
+			job->result = n;
+			job->phase = NT_PHASE_NEXT_COMPOSITE;
+			return;
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/**=============================================
+  * @Fn				- NT_Job_Start
+  * @brief 			- Prepares a time-sliced number theory job
+  * @param [out] 	- job: Pointer to the job to be prepared
+  * @param [in] 	- operation: Operation to be done @ref nt_operation_t
+  * @param [in] 	- a: First operand
+  * @param [in] 	- b: Second operand (GCD, LCM, POWMOD exponent)
+  * @param [in] 	- m: Modulus (POWMOD only)
+  * @retval 		- None
+  * Note			- Call NT_Job_Step until it stops returning NT_JOB_BUSY
+  */
+void NT_Job_Start(nt_job_t *job, nt_operation_t operation, uint64 a, uint64 b, uint64 m){
+	memset(job, 0, sizeof(nt_job_t));
+	job->operation = operation;
+	job->status = NT_JOB_BUSY;
+	switch(operation){
+	case NT_OP_GCD:
+		job->result = NT_GCD(a, b);
+		job->phase = NT_PHASE_DONE;
+		break;
+	case NT_OP_LCM:
+		job->result = NT_LCM(a, b);
+		job->phase = NT_PHASE_DONE;
+		break;
+	case NT_OP_POWMOD:
+		if(0 == m){
+			job->result = 0;
+			job->phase = NT_PHASE_DONE;
+		}
+		else{
+			job->pow_base = a % m;
+			job->pow_exp = b;
+			job->pow_mod = m;
+			job->result = 1 % m;
+			job->phase = NT_PHASE_POWMOD;
+		}
+		break;
+	case NT_OP_PRIME:
+	case NT_OP_FACTOR:
+		job->current = a;
+		job->phase = NT_PHASE_TRIAL;
+		break;
+	default:
+		job->status = NT_JOB_IDLE;
+		break;
+	}
+}
+
+/**=============================================
+  * @Fn				- NT_Job_Step
+  * @brief 			- Runs one bounded time slice of a number theory job
+  * @param 		 	- job: Pointer to the job
+  * @retval 		- Status of the job @ref nt_job_status_t
+  * Note			- A slice is one Miller-Rabin witness, NT_RHO_SLICE_STEPS rho iterations
+  * 				  or NT_POW_SLICE_BITS exponent bits, so key events are handled in between
+  */
+nt_job_status_t NT_Job_Step(nt_job_t *job){
+	uint8 index;
+	if(NT_JOB_BUSY != job->status){
+		return job->status;
+	}
+	else{ /* Do Nothing */ }
+
+	switch(job->phase){
+	case NT_PHASE_POWMOD:
+		for(index = 0; (index < NT_POW_SLICE_BITS) && (0 != job->pow_exp); index++){
+			if(job->pow_exp & 1){
+				job->result = NT_MulMod(job->result, job->pow_base, job->pow_mod);
+			}
+			else{ /* Do Nothing */ }
+			job->pow_base = NT_MulMod(job->pow_base, job->pow_base, job->pow_mod);
+			job->pow_exp >>= 1;
+		}
+		if(0 == job->pow_exp){
+			job->phase = NT_PHASE_DONE;
+		}
+		else{ /* Do Nothing */ }
+		break;
+	case NT_PHASE_TRIAL:
+		NT_Trial_Division(job);
+		break;
+	case NT_PHASE_NEXT_COMPOSITE:
+		if(0 == job->composites_count){
+			NT_Sort_Factors(job);
+			job->phase = NT_PHASE_DONE;
+		}
+		else{
+			job->composites_count--;
+			job->current = job->composites[job->composites_count];
+			if((NT_TRIAL_LIMIT * NT_TRIAL_LIMIT) > job->current){
+				/* Cofactors have no factor below NT_TRIAL_LIMIT, so small ones are prime */
+				NT_Add_Factor(job, job->current, 1);
+			}
+			else{
+				NT_Start_Prime_Test(job);
+			}
+		}
+		break;
+	case NT_PHASE_PRIME_TEST:
+		if(NT_MR_Witness(job->current, job->mr_d, job->mr_s, NT_MR_Bases[job->mr_base_index])){
+			job->mr_base_index++;
+			if(NT_MR_BASES_NUM == job->mr_base_index){
+				/* Passed all witnesses, so it is prime */
+				if(NT_OP_PRIME == job->operation){
+					job->result = 1;
+					job->phase = NT_PHASE_DONE;
+				}
+				else{
+					NT_Add_Factor(job, job->current, 1);
+					job->phase = NT_PHASE_NEXT_COMPOSITE;
+				}
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{
+			/* Composite */
+			if(NT_OP_PRIME == job->operation){
+				job->result = 0;
+				job->phase = NT_PHASE_DONE;
+			}
+			else{
+				job->rho_steps = 0;
+				NT_Start_Rho(job, 1);
+			}
+		}
+		break;
+	case NT_PHASE_RHO:
+		NT_Rho_Slice(job);
+		break;
+	default:
+		break;
+	}
+
+	if(NT_PHASE_DONE == job->phase){
+		job->status = (job->incomplete) ? NT_JOB_BUDGET_EXCEEDED : NT_JOB_DONE;
+	}
+	else{ /* Do Nothing */ }
+	return job->status;
+}
+
+/**=============================================
+  * @Fn				- U64_To_String
+  * @brief 			- This function will save the decimal digits of a number in a string
+  * @param [in] 	- value: Number to be converted
+  * @param [out] 	- string: Pointer to the destination string
+  * @retval 		- Length of the string
+  * Note			- The string is null terminated
+  */
+static uint8 U64_To_String(uint64 value, uint8 *string){
+	uint8 reversed[20];
+	uint8 length = 0, index;
+	do{
+		reversed[length] = (value % 10) + '0';
+		value /= 10;
+		length++;
+	}while(0 != value);
+	for(index = 0; index < length; index++){
+		string[index] = reversed[length - index - 1];
+	}
+	string[length] = '\0';
+	return length;
+}
+
+/**=============================================
+  * @Fn				- NT_Format_Factors
+  * @brief 			- This function will save the factorization of a finished job in "NT_String"
+  * @param [in] 	- job: Pointer to the finished FACTOR job
+  * @retval 		- None
+  * Note			- Format is "2^3*5*7", an unfactored cofactor is appended with a '?'
+  */
+static void NT_Format_Factors(const nt_job_t *job){
+	uint8 length = 0, index;
+	uint8 number[21];
+	if((0 == job->factors_count) && (0 == job->incomplete)){
+		/* 0 and 1 have no prime factors */
+		U64_To_String(NT_Operands[0], NT_String);
+		return;
+	}
+	else{ /* Do Nothing */ }
+	NT_String[0] = '\0';
+	for(index = 0; index < job->factors_count; index++){
+		if(0 != index){
+			NT_String[length++] = '*';
+		}
+		else{ /* Do Nothing */ }
+		U64_To_String(job->factors[index].prime, number);
+		if((length + strlen((char*)number) + 5) >= NT_STRING_SIZE){
+			break;
+		}
+		else{ /* Do Nothing */ }
+		strcpy((char*)&NT_String[length], (char*)number);
+		length += strlen((char*)number);
+		if(1 < job->factors[index].exponent){
+			NT_String[length++] = '^';
+			length += U64_To_String(job->factors[index].exponent, &NT_String[length]);
+		}
+		else{ /* Do Nothing */ }
+	}
+	NT_String[length] = '\0';
+	if(job->incomplete){
+		U64_To_String(job->result, number);
+		if((length + strlen((char*)number) + 3) < NT_STRING_SIZE){
+			if(0 != length){
+				NT_String[length++] = '*';
+			}
+			else{ /* Do Nothing */ }
+			strcpy((char*)&NT_String[length], (char*)number);
+			length += strlen((char*)number);
+			NT_String[length++] = '?';
+			NT_String[length] = '\0';
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- NT_Show_Prompt
+  * @brief 			- This function will clear the screen and ask the user for the current operand
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The cursor is left at the start of the first row
+  */
+static void NT_Show_Prompt(void){
+	LCD_Send_Command(LCD_CLEAR_DISPLAY);
+	if(0 == NT_Operand_Index){
+		LCD_Send_string_Pos((uint8*)"A +G -L xP /F =?", LCD_SECOND_ROW, 1);
+	}
+	else{
+		LCD_Send_string_Pos((uint8*)NT_Operation_Labels[NT_Operation], LCD_SECOND_ROW, 1);
+		LCD_Send_Char(' ');
+		LCD_Send_Char(NT_Operand_Names[NT_Operand_Index]);
+		LCD_Send_Char('?');
+	}
+	LCD_Set_Cursor(LCD_FIRST_ROW, 1);
+}
+
+/**=============================================
+  * @Fn				- NT_Clear_Entry
+  * @brief 			- This function will clear all operands and go back to the first operand
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void NT_Clear_Entry(void){
+	memset(NT_Operands, 0, sizeof(NT_Operands));
+	NT_Operand_Index = 0;
+	NT_Operand_Length = 0;
+	NT_Operation = NT_OP_NONE;
+}
+
+/**=============================================
+  * @Fn				- NT_Operands_Needed
+  * @brief 			- Returns the number of operands needed by the selected operation
+  * @param [in] 	- None
+  * @retval 		- Number of operands (1...3)
+  * Note			- None
+  */
+static uint8 NT_Operands_Needed(void){
+	uint8 needed;
+	switch(NT_Operation){
+	case NT_OP_GCD:
+	case NT_OP_LCM:
+		needed = 2;
+		break;
+	case NT_OP_POWMOD:
+		needed = 3;
+		break;
+	default:
+		needed = 1;
+		break;
+	}
+	return needed;
+}
+
+/**=============================================
+  * @Fn				- NT_Start_Operation
+  * @brief 			- This function will start the job of the selected operation
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Moves to NT_Computing state
+  */
+static void NT_Start_Operation(void){
+	NT_Job_Start(&NT_Job, NT_Operation, NT_Operands[0], NT_Operands[1], NT_Operands[2]);
+	LCD_Send_string_Pos((uint8*)"WORKING.. C:STOP", LCD_SECOND_ROW, 1);
+	pfNumber_Theory_State_Handler = STATE_CALL(NT_Computing);
+	Events_Post(EVENT_CONTINUE, 0);
+}
+
+/**=============================================
+  * @Fn				- NT_Select_Operation
+  * @brief 			- This function handles an operation key or '=' while entering operands
+  * @param [in] 	- key: Pressed key ('+', '-', 'x', '/' or '=')
+  * @retval 		- None
+  * Note			- '+': GCD, '-': LCM, 'x': A^B mod M, '/': factorize, '=' on the first operand: primality test
+  */
+static void NT_Select_Operation(uint8 key){
+	if(0 == NT_Operand_Index){
+		switch(key){
+		case '+': NT_Operation = NT_OP_GCD;		break;
+		case '-': NT_Operation = NT_OP_LCM;		break;
+		case 'x': NT_Operation = NT_OP_POWMOD;	break;
+		case '/': NT_Operation = NT_OP_FACTOR;	break;
+		default:  NT_Operation = NT_OP_PRIME;	break;
+		}
+	}
+	else if('=' != key){
+		/* Operation is already selected, wait for '=' */
+		return;
+	}
+	else{ /* Do Nothing */ }
+
+	if((NT_Operand_Index + 1) < NT_Operands_Needed()){
+		/* Ask for the next operand */
+		NT_Operand_Index++;
+		NT_Operand_Length = 0;
+		NT_Show_Prompt();
+	}
+	else{
+		NT_Start_Operation();
+	}
+}
+
+/**=============================================
+  * @Fn				- NT_Set_State
+  * @brief 			- This function keeps the id of the running state and traces state changes
+  * @param [in] 	- state: Running state @ref number_theory_states_t
+  * @retval 		- None
+  * Note			- None
+  */
+static void NT_Set_State(number_theory_states_t state){
+	if(state != nt_state_id){
+		TRACE_STATE(TRACE_SRC_NUMBER_THEORY, state);
+	}
+	else{ /* Do Nothing */ }
+	nt_state_id = state;
+}
+
+/**=============================================
+  * @Fn				- ST_NT_Operand_Entry
+  * @brief 			- In this state, the system will store user entry in the current operand
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in NT_Operand_Entry state
+  */
+STATE_DEF(NT_Operand_Entry){
+	/* State Name */
+	if(number_theory_states_max == nt_state_id){
+		NT_Show_Prompt();
+	}
+	else{ /* Do Nothing */ }
+	NT_Set_State(NT_Operand_Entry);
+
+	/* State Action */
+	pressed_key = Events_Key();
+	if((0 <= pressed_key) && (10 > pressed_key)){
+		double_check_before_quitting = 0; // Clear flag
+		/* Validate that the operand fits on one row */
+		if(NT_OPERAND_MAX_DIGITS > NT_Operand_Length){
+			LCD_Send_Char(pressed_key+48);
+			NT_Operands[NT_Operand_Index] = (NT_Operands[NT_Operand_Index] * 10) + pressed_key;
+			NT_Operand_Length++;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(('+' == pressed_key) || ('-' == pressed_key) || ('x' == pressed_key) || ('/' == pressed_key) || ('=' == pressed_key)){
+		double_check_before_quitting = 0; // Clear flag
+		NT_Select_Operation(pressed_key);
+	}
+	else if('C' == pressed_key){
+		/* Clear screen, or exit if pressed twice in a row */
+		NT_Clear_Entry();
+		NT_Answer_Valid = 0;
+		NT_Show_Prompt();
+		if(1 == double_check_before_quitting){
+			double_check_before_quitting = 0;
+			nt_state_id = number_theory_states_max;
+			TRACE_STATE(TRACE_SRC_NUMBER_THEORY, HSM_NO_STATE);
+			USER_RESET_FLAG = 1;
+		}
+		else{
+			double_check_before_quitting = 1;
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- ST_NT_Computing
+  * @brief 			- In this state, the system runs the selected operation one time slice per call
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in NT_Computing state, pressing C cancels the operation
+  */
+STATE_DEF(NT_Computing){
+	nt_job_status_t status;
+
+	/* State Name */
+	NT_Set_State(NT_Computing);
+
+	/* Event Check */
+	/* Key events are handled between slices so a long operation can be cancelled */
+	pressed_key = Events_Key();
+	if('C' == pressed_key){
+		NT_Job.status = NT_JOB_IDLE;
+		NT_Answer_Valid = 0;
+		LCD_Send_Command(LCD_CLEAR_DISPLAY);
+		LCD_Send_string_Pos((uint8*)"CANCELLED", LCD_FIRST_ROW, 1);
+		pfNumber_Theory_State_Handler = STATE_CALL(NT_Result);
+		return;
+	}
+	else{ /* Do Nothing */ }
+
+	/* State Action */
+	status = NT_Job_Step(&NT_Job);
+	if(NT_JOB_BUSY == status){
+		/* Run the next slice after the events already waiting */
+		Events_Post(EVENT_CONTINUE, 0);
+		return;
+	}
+	else{ /* Do Nothing */ }
+
+	LCD_Send_Command(LCD_CLEAR_DISPLAY);
+	switch(NT_Operation){
+	case NT_OP_GCD:
+	case NT_OP_POWMOD:
+		U64_To_String(NT_Job.result, NT_String);
+		NT_Answer = NT_Job.result;
+		break;
+	case NT_OP_LCM:
+		if((0 == NT_Job.result) && (0 != NT_Operands[0]) && (0 != NT_Operands[1])){
+			strcpy((char*)NT_String, "OVERFLOW");
+		}
+		else{
+			U64_To_String(NT_Job.result, NT_String);
+		}
+		NT_Answer = NT_Job.result;
+		break;
+	case NT_OP_PRIME:
+		strcpy((char*)NT_String, (1 == NT_Job.result) ? "PRIME" : "NOT PRIME");
+		NT_Answer = NT_Operands[0];
+		break;
+	default:
+		NT_Format_Factors(&NT_Job);
+		NT_Answer = NT_Operands[0];
+		break;
+	}
+	NT_Answer_Valid = 1;
+
+	/* Results wider than the LCD scroll, '>' marks a result cut at the end of display data RAM */
+	if(LCD_DDRAM_ROW_SIZE < strlen((char*)NT_String)){
+		NT_String[LCD_DDRAM_ROW_SIZE - 1] = '>';
+		NT_String[LCD_DDRAM_ROW_SIZE] = '\0';
+	}
+	else{ /* Do Nothing */ }
+	LCD_Marquee_Start(NT_String, LCD_FIRST_ROW, NT_MARQUEE_PERIOD_MS);
+	if(LCD_DISPLAY_COLS < strlen((char*)NT_String)){
+		/* Wake up to scroll the result */
+		Events_Timer_Start(NT_MARQUEE_PERIOD_MS);
+	}
+	else{ /* Do Nothing */ }
+	LCD_Send_string_Pos((uint8*)NT_Operation_Labels[NT_Operation], LCD_SECOND_ROW, 1);
+	if(NT_JOB_BUDGET_EXCEEDED == status){
+		LCD_Send_string_Pos((uint8*)"BUDGET", LCD_SECOND_ROW, 11);
+	}
+	else{ /* Do Nothing */ }
+	pfNumber_Theory_State_Handler = STATE_CALL(NT_Result);
+}
+
+/**=============================================
+  * @Fn				- ST_NT_Result
+  * @brief 			- In this state, the system shows the result of the operation
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in NT_Result state
+  */
+STATE_DEF(NT_Result){
+	/* State Name */
+	NT_Set_State(NT_Result);
+
+	/* State Action */
+	LCD_Marquee_Update();
+	pressed_key = Events_Key();
+	if((0 <= pressed_key) && (10 > pressed_key)){
+		/* Start a new operation with this digit */
+		NT_Clear_Entry();
+		NT_Show_Prompt();
+		LCD_Send_Char(pressed_key+48);
+		NT_Operands[0] = pressed_key;
+		NT_Operand_Length = 1;
+		pfNumber_Theory_State_Handler = STATE_CALL(NT_Operand_Entry);
+		Events_Timer_Stop();
+	}
+	else if(('+' == pressed_key) || ('-' == pressed_key) || ('x' == pressed_key) || ('/' == pressed_key) || ('=' == pressed_key)){
+		/* Use the last result as operand A */
+		if(1 == NT_Answer_Valid){
+			NT_Clear_Entry();
+			NT_Operands[0] = NT_Answer;
+			pfNumber_Theory_State_Handler = STATE_CALL(NT_Operand_Entry);
+			Events_Timer_Stop();
+			NT_Select_Operation(pressed_key);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if('C' == pressed_key){
+		/* Clear screen, exit if pressed again in operand entry */
+		double_check_before_quitting = 1; // flag for operand entry state that user pressed C
+		NT_Clear_Entry();
+		NT_Show_Prompt();
+		pfNumber_Theory_State_Handler = STATE_CALL(NT_Operand_Entry);
+		Events_Timer_Stop();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Number_Theory_Stop
+  * @brief 			- Leaves the mode as if 'C' was pressed twice, a running operation is cancelled
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The LCD and the event timer are left to the caller, the next call of NT_Operand_Entry shows the mode again
+  */
+void Number_Theory_Stop(void){
+	if(number_theory_states_max != nt_state_id){
+		nt_state_id = number_theory_states_max;
+		TRACE_STATE(TRACE_SRC_NUMBER_THEORY, HSM_NO_STATE);
+	}
+	else{ /* Do Nothing */ }
+	NT_Job.status = NT_JOB_IDLE;
+	NT_Clear_Entry();
+	NT_Answer_Valid = 0;
+	double_check_before_quitting = 0;
+	pfNumber_Theory_State_Handler = STATE_CALL(NT_Operand_Entry);
+}
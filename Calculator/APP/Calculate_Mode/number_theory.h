@@ -0,0 +1,212 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : number_theory.h 			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef CALCULATE_MODE_NUMBER_THEORY_H_
+#define CALCULATE_MODE_NUMBER_THEORY_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "lcd_driver.h"
+#include "keypad_driver.h"
+#include "states.h"
+#include "events.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref NT_JOB_LIMITS_define
+#define NT_MAX_FACTORS			16			// A 64-bit number has at most 15 distinct prime factors
+#define NT_MAX_COMPOSITES		8			// Cofactors left after trial division have no factor below NT_TRIAL_LIMIT
+#define NT_TRIAL_LIMIT			256UL		// Trial division is done by every odd number below this limit
+#define NT_POW_SLICE_BITS		8			// Exponent bits processed in one time slice of modular exponentiation
+#define NT_RHO_SLICE_STEPS		64			// Pollard-rho iterations done in one time slice
+#define NT_RHO_GCD_BATCH		16			// Pollard-rho iterations multiplied together before taking one GCD
+#define NT_RHO_STEP_BUDGET		300000UL	// Pollard-rho iterations allowed for one cofactor before giving up, 3 times the most
+											// needed by 200 semiprimes of two 32-bit primes, about 5 minutes (Host/README.md)
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	NT_Operand_Entry,
+	NT_Computing,
+	NT_Result,
+	number_theory_states_max
+}number_theory_states_t;
+
+typedef enum{
+	NT_OP_NONE,
+	NT_OP_GCD,
+	NT_OP_LCM,
+	NT_OP_POWMOD,
+	NT_OP_PRIME,
+	NT_OP_FACTOR
+}nt_operation_t;
+
+typedef enum{
+	NT_JOB_IDLE,
+	NT_JOB_BUSY,
+	NT_JOB_DONE,
+	NT_JOB_BUDGET_EXCEEDED
+}nt_job_status_t;
+
+typedef enum{
+	NT_PHASE_POWMOD,
+	NT_PHASE_TRIAL,
+	NT_PHASE_NEXT_COMPOSITE,
+	NT_PHASE_PRIME_TEST,
+	NT_PHASE_RHO,
+	NT_PHASE_DONE
+}nt_phase_t;
+
+typedef struct{
+	uint64 prime;
+	uint8  exponent;
+}nt_factor_t;
+
+typedef struct{
+	nt_operation_t	operation;
+	nt_job_status_t	status;
+	nt_phase_t		phase;
+	uint64			result;							// Result of GCD, LCM, POWMOD, or 1 if PRIME test passed
+	/* Modular exponentiation state */
+	uint64			pow_base, pow_exp, pow_mod;
+	/* Factorization state */
+	nt_factor_t		factors[NT_MAX_FACTORS];		// Prime factors found so far
+	uint8			factors_count;
+	uint64			composites[NT_MAX_COMPOSITES];	// Cofactors still to be split
+	uint8			composites_count;
+	uint64			current;						// Cofactor being tested or split
+	uint8			incomplete;						// 1 if a cofactor could not be split within NT_RHO_STEP_BUDGET
+	/* Miller-Rabin state */
+	uint64			mr_d;
+	uint8			mr_s;
+	uint8			mr_base_index;
+	/* Pollard-rho state */
+	uint64			rho_x, rho_y, rho_c, rho_q;
+	uint32			rho_steps;
+}nt_job_t;
+
+extern void (*pfNumber_Theory_State_Handler)(void);
+extern uint8 USER_RESET_FLAG; // if 1, then user wants to restart the app
+
+/*
+ * =============================================
+ * APIs Supported by "number_theory"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- NT_GCD
+  * @brief 			- Calculates the greatest common divisor of two numbers
+  * @param [in] 	- a: First number
+  * @param [in] 	- b: Second number
+  * @retval 		- GCD of a and b
+  * Note			- Stein's binary algorithm, uses only shifts and subtractions
+  */
+uint64 NT_GCD(uint64 a, uint64 b);
+
+/**=============================================
+  * @Fn				- NT_LCM
+  * @brief 			- Calculates the least common multiple of two numbers
+  * @param [in] 	- a: First number
+  * @param [in] 	- b: Second number
+  * @retval 		- LCM of a and b, or 0 if any of them is 0 or the result does not fit in 64 bits
+  * Note			- None
+  */
+uint64 NT_LCM(uint64 a, uint64 b);
+
+/**=============================================
+  * @Fn				- NT_MulMod
+  * @brief 			- Calculates (a * b) mod m without overflowing 64 bits
+  * @param [in] 	- a: First factor
+  * @param [in] 	- b: Second factor
+  * @param [in] 	- m: Modulus, must not be 0
+  * @retval 		- (a * b) mod m
+  * Note			- Moduli below 2^32 use a single 64-bit multiplication
+  */
+uint64 NT_MulMod(uint64 a, uint64 b, uint64 m);
+
+/**=============================================
+  * @Fn				- NT_PowMod
+  * @brief 			- Calculates (base ^ exp) mod m
+  * @param [in] 	- base: Base number
+  * @param [in] 	- exp: Exponent
+  * @param [in] 	- m: Modulus
+  * @retval 		- (base ^ exp) mod m, or 0 if m is 0
+  * Note			- Square-and-multiply, not time-sliced
+  */
+uint64 NT_PowMod(uint64 base, uint64 exp, uint64 m);
+
+/**=============================================
+  * @Fn				- NT_Job_Start
+  * @brief 			- Prepares a time-sliced number theory job
+  * @param [out] 	- job: Pointer to the job to be prepared
+  * @param [in] 	- operation: Operation to be done @ref nt_operation_t
+  * @param [in] 	- a: First operand
+  * @param [in] 	- b: Second operand (GCD, LCM, POWMOD exponent)
+  * @param [in] 	- m: Modulus (POWMOD only)
+  * @retval 		- None
+  * Note			- Call NT_Job_Step until it stops returning NT_JOB_BUSY
+  */
+void NT_Job_Start(nt_job_t *job, nt_operation_t operation, uint64 a, uint64 b, uint64 m);
+
+/**=============================================
+  * @Fn				- NT_Job_Step
+  * @brief 			- Runs one bounded time slice of a number theory job
+  * @param 		 	- job: Pointer to the job
+  * @retval 		- Status of the job @ref nt_job_status_t
+  * Note			- A slice is one Miller-Rabin witness, NT_RHO_SLICE_STEPS rho iterations
+  * 				  or NT_POW_SLICE_BITS exponent bits, so key events are handled in between
+  */
+nt_job_status_t NT_Job_Step(nt_job_t *job);
+
+/**=============================================
+  * @Fn				- ST_NT_Operand_Entry
+  * @brief 			- In this state, the system will store user entry in the current operand
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in NT_Operand_Entry state
+  */
+STATE_DEF(NT_Operand_Entry);
+
+/**=============================================
+  * @Fn				- ST_NT_Computing
+  * @brief 			- In this state, the system runs the selected operation one time slice per call
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in NT_Computing state, pressing C cancels the operation
+  */
+STATE_DEF(NT_Computing);
+
+/**=============================================
+  * @Fn				- ST_NT_Result
+  * @brief 			- In this state, the system shows the result of the operation
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in NT_Result state
+  */
+STATE_DEF(NT_Result);
+
+/**=============================================
+  * @Fn				- Number_Theory_Stop
+  * @brief 			- Leaves the mode as if 'C' was pressed twice, a running operation is cancelled
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The LCD and the event timer are left to the caller, the next call of NT_Operand_Entry shows the mode again
+  */
+void Number_Theory_Stop(void);
+
+#endif /* CALCULATE_MODE_NUMBER_THEORY_H_ */
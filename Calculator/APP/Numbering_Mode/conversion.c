@@ -0,0 +1,303 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : conversion.c 			                           	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "conversion.h"
+
+#define CONV_U32_MAX				0xFFFFFFFFULL
+#define CONV_DECIMAL_CHUNK			100000000ULL	// 10^8, largest power of 100 that fits in 32 bits
+#define CONV_DECIMAL_CHUNK_DIGITS	8
+
+/* Table generators for the 8 ASCII binary digits of every byte value */
+#define BIN_ROW(n)		{ '0'+(((n)>>7)&1), '0'+(((n)>>6)&1), '0'+(((n)>>5)&1), '0'+(((n)>>4)&1), \
+						  '0'+(((n)>>3)&1), '0'+(((n)>>2)&1), '0'+(((n)>>1)&1), '0'+((n)&1) }
+#define BIN_ROWS_4(n)	BIN_ROW(n), BIN_ROW((n)+1), BIN_ROW((n)+2), BIN_ROW((n)+3)
+#define BIN_ROWS_16(n)	BIN_ROWS_4(n), BIN_ROWS_4((n)+4), BIN_ROWS_4((n)+8), BIN_ROWS_4((n)+12)
+#define BIN_ROWS_64(n)	BIN_ROWS_16(n), BIN_ROWS_16((n)+16), BIN_ROWS_16((n)+32), BIN_ROWS_16((n)+48)
+
+/* ASCII digit of every value up to the largest radix, the first 16 serve hexadecimal */
+static const uint8 Conv_Digit_Chars[CONV_RADIX_MAX] = {
+		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+		'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V',
+		'W', 'X', 'Y', 'Z'
+};
+
+/* Largest power of every radix that fits in 32 bits and its number of digits, indexed by radix - CONV_RADIX_MIN */
+static const conv_chunk_t Conv_Radix_Chunks[CONV_RADIX_MAX - CONV_RADIX_MIN + 1] = {
+		{2147483648UL, 31}, {3486784401UL, 20}, {1073741824UL, 15}, {1220703125UL, 13}, // 2...5
+		{2176782336UL, 12}, {1977326743UL, 11}, {1073741824UL, 10}, {3486784401UL, 10}, // 6...9
+		{1000000000UL,  9}, {2357947691UL,  9}, { 429981696UL,  8}, { 815730721UL,  8}, // 10...13
+		{1475789056UL,  8}, {2562890625UL,  8}, { 268435456UL,  7}, { 410338673UL,  7}, // 14...17
+		{ 612220032UL,  7}, { 893871739UL,  7}, {1280000000UL,  7}, {1801088541UL,  7}, // 18...21
+		{2494357888UL,  7}, {3404825447UL,  7}, { 191102976UL,  6}, { 244140625UL,  6}, // 22...25
+		{ 308915776UL,  6}, { 387420489UL,  6}, { 481890304UL,  6}, { 594823321UL,  6}, // 26...29
+		{ 729000000UL,  6}, { 887503681UL,  6}, {1073741824UL,  6}, {1291467969UL,  6}, // 30...33
+		{1544804416UL,  6}, {1838265625UL,  6}, {2176782336UL,  6}                      // 34...36
+};
+
+/* ASCII binary expansion of every byte, MSB first */
+static const uint8 Conv_Byte_Bits[256][8] = {
+		BIN_ROWS_64(0), BIN_ROWS_64(64), BIN_ROWS_64(128), BIN_ROWS_64(192)
+};
+
+/* ASCII digits of 00...99 */
+static const uint8 Conv_Digit_Pairs[200] = {
+		'0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+		'1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+		'2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+		'3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+		'4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+		'5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+		'6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+		'7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+		'8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+		'9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+/**=============================================
+  * @Fn				- Conv_Render_Decimal_Chunk
+  * @brief 			- Renders exactly 8 decimal digits of a value backwards, with leading zeros
+  * @param [in] 	- value: Value to be rendered (0...99999999)
+  * @param [in] 	- pEnd: Pointer after the last digit to be written
+  * @retval 		- Pointer to the first digit in the buffer
+  * Note			- None
+  */
+static uint8 *Conv_Render_Decimal_Chunk(uint32 value, uint8 *pEnd){
+	uint8 *pDigit = pEnd;
+	const uint8 *pPair;
+	uint32 quotient;
+	uint8 index;
+	for(index = 0; index < (CONV_DECIMAL_CHUNK_DIGITS / 2); index++){
+		quotient = (uint32)(((uint64)value * 0x51EB851FULL) >> 37);
+		pPair = &Conv_Digit_Pairs[(value - (quotient * 100)) * 2];
+		pDigit -= 2;
+		pDigit[0] = pPair[0];
+		pDigit[1] = pPair[1];
+		value = quotient;
+	}
+	return pDigit;
+}
+
+/**=============================================
+  * @Fn				- Conv_Render_Decimal_U32
+  * @brief 			- Renders a 32-bit value in base 10 backwards, without leading zeros
+  * @param [in] 	- value: Value to be rendered
+  * @param [in] 	- pEnd: Pointer after the last digit to be written
+  * @retval 		- Pointer to the first digit in the buffer
+  * Note			- Two digits per step from a digit-pair table, division by 100 is a reciprocal multiply
+  */
+static uint8 *Conv_Render_Decimal_U32(uint32 value, uint8 *pEnd){
+	uint8 *pDigit = pEnd;
+	const uint8 *pPair;
+	uint32 quotient;
+	while(100 <= value){
+		/* value / 100 == (value * 0x51EB851F) >> 37 for every 32-bit value */
+		quotient = (uint32)(((uint64)value * 0x51EB851FULL) >> 37);
+		pPair = &Conv_Digit_Pairs[(value - (quotient * 100)) * 2];
+		pDigit -= 2;
+		pDigit[0] = pPair[0];
+		pDigit[1] = pPair[1];
+		value = quotient;
+	}
+	if(10 <= value){
+		pPair = &Conv_Digit_Pairs[value * 2];
+		pDigit -= 2;
+		pDigit[0] = pPair[0];
+		pDigit[1] = pPair[1];
+	}
+	else{
+		pDigit--;
+		*pDigit = (uint8)value + '0';
+	}
+	return pDigit;
+}
+
+/**=============================================
+  * @Fn				- Conv_Render_Binary
+  * @brief 			- Renders a value in base 2 backwards from the end of a buffer
+  * @param [in] 	- value: Value to be rendered
+  * @param [in] 	- pEnd: Pointer to the null terminator at the end of the buffer
+  * @retval 		- Pointer to the first digit in the buffer
+  * Note			- Expands 8 bits per step from a table, so the buffer must have room for the
+  * 				  number of digits rounded up to a multiple of 8
+  */
+uint8 *Conv_Render_Binary(uint64 value, uint8 *pEnd){
+	uint8 *pDigit = pEnd;
+	const uint8 *pBits;
+	uint8 digits = (0 == value) ? 1 : (64 - __builtin_clzll(value));
+	*pEnd = '\0';
+	do{
+		pBits = Conv_Byte_Bits[value & 0xFF];
+		pDigit -= 8;
+		pDigit[0] = pBits[0];
+		pDigit[1] = pBits[1];
+		pDigit[2] = pBits[2];
+		pDigit[3] = pBits[3];
+		pDigit[4] = pBits[4];
+		pDigit[5] = pBits[5];
+		pDigit[6] = pBits[6];
+		pDigit[7] = pBits[7];
+		value >>= 8;
+	}while(0 != value);
+
+	/* Skip the leading zeros of the last byte */
+	return (pEnd - digits);
+}
+
+/**=============================================
+  * @Fn				- Conv_Render_Power_Of_Two
+  * @brief 			- Renders a value in base 2, 8 or 16 backwards from the end of a buffer
+  * @param [in] 	- value: Value to be rendered
+  * @param [in] 	- shift: Number of bits per digit (1, 3 or 4)
+  * @param [in] 	- pEnd: Pointer to the null terminator at the end of the buffer
+  * @retval 		- Pointer to the first digit in the buffer
+  * Note			- Digits are extracted with shift and mask and looked up in a 16-entry table
+  */
+uint8 *Conv_Render_Power_Of_Two(uint64 value, uint8 shift, uint8 *pEnd){
+	uint8 *pDigit = pEnd;
+	uint32 mask = ((1UL << shift) - 1);
+	if(1 == shift){
+		return Conv_Render_Binary(value, pEnd);
+	}
+	else{ /* Do Nothing */ }
+	*pEnd = '\0';
+	do{
+		pDigit--;
+		*pDigit = Conv_Digit_Chars[(uint32)value & mask];
+		value >>= shift;
+	}while(0 != value);
+	return pDigit;
+}
+
+/**=============================================
+  * @Fn				- Conv_Render_Decimal
+  * @brief 			- Renders a value in base 10 backwards from the end of a buffer
+  * @param [in] 	- value: Value to be rendered
+  * @param [in] 	- pEnd: Pointer to the null terminator at the end of the buffer
+  * @retval 		- Pointer to the first digit in the buffer
+  * Note			- Two digits per step from a digit-pair table, division by 100 is a reciprocal multiply
+  * 				  Values above 32 bits are first split into chunks of 8 digits
+  */
+uint8 *Conv_Render_Decimal(uint64 value, uint8 *pEnd){
+	uint8 *pDigit = pEnd;
+	uint32 low;
+	*pEnd = '\0';
+	/* Only the chunking needs 64-bit division, the digits are produced with 32-bit arithmetic */
+	while(CONV_U32_MAX < value){
+		low = (uint32)(value % CONV_DECIMAL_CHUNK);
+		value /= CONV_DECIMAL_CHUNK;
+		pDigit = Conv_Render_Decimal_Chunk(low, pDigit);
+	}
+	return Conv_Render_Decimal_U32((uint32)value, pDigit);
+}
+
+/**=============================================
+  * @Fn				- Conv_Render_Bases
+  * @brief 			- Renders a value in base 10, 8, 2 and 16 at once
+  * @param [in] 	- value: Value to be rendered
+  * @param [out] 	- pBases: Buffers of all bases, digits are written at their ends
+  * @retval 		- None
+  * Note			- Octal, binary and hexadecimal digits are produced in one pass over the bytes of the value
+  */
+void Conv_Render_Bases(uint64 value, conv_bases_t *pBases){
+	uint8 *pOctal = &pBases->octal[CONV_OCTAL_SIZE - 1];
+	uint8 *pBinary = &pBases->binary[CONV_BINARY_SIZE - 1];
+	uint8 *pHexadecimal = &pBases->hexadecimal[CONV_HEXADECIMAL_SIZE - 1];
+	uint8 bits = (0 == value) ? 1 : (64 - __builtin_clzll(value));
+	uint64 rest = value;
+	uint32 octal_bits = 0;
+	uint8 octal_count = 0;
+	const uint8 *pBits;
+	uint8 byte;
+
+	*pOctal = '\0';
+	*pBinary = '\0';
+	*pHexadecimal = '\0';
+	do{
+		byte = (uint8)rest;
+		rest >>= 8;
+
+		pBits = Conv_Byte_Bits[byte];
+		pBinary -= 8;
+		pBinary[0] = pBits[0];
+		pBinary[1] = pBits[1];
+		pBinary[2] = pBits[2];
+		pBinary[3] = pBits[3];
+		pBinary[4] = pBits[4];
+		pBinary[5] = pBits[5];
+		pBinary[6] = pBits[6];
+		pBinary[7] = pBits[7];
+
+		pHexadecimal -= 2;
+		pHexadecimal[0] = Conv_Digit_Chars[byte >> 4];
+		pHexadecimal[1] = Conv_Digit_Chars[byte & 0x0F];
+
+		/* Octal digits do not line up with bytes, the left over bits are kept for the next byte */
+		octal_bits |= ((uint32)byte << octal_count);
+		octal_count += 8;
+		while(3 <= octal_count){
+			pOctal--;
+			*pOctal = Conv_Digit_Chars[octal_bits & 7];
+			octal_bits >>= 3;
+			octal_count -= 3;
+		}
+	}while(0 != rest);
+	if(0 != octal_count){
+		pOctal--;
+		*pOctal = Conv_Digit_Chars[octal_bits];
+	}
+	else{ /* Do Nothing */ }
+
+	/* Skip the leading zeros of the last byte */
+	pBases->pDigits[CONV_BINARY] = &pBases->binary[CONV_BINARY_SIZE - 1 - bits];
+	pBases->pDigits[CONV_OCTAL] = &pBases->octal[CONV_OCTAL_SIZE - 1 - ((bits + 2) / 3)];
+	pBases->pDigits[CONV_HEXADECIMAL] = &pBases->hexadecimal[CONV_HEXADECIMAL_SIZE - 1 - ((bits + 3) / 4)];
+	pBases->pDigits[CONV_DECIMAL] = Conv_Render_Decimal(value, &pBases->decimal[CONV_DECIMAL_SIZE - 1]);
+}
+
+/**=============================================
+  * @Fn				- Conv_Render_Radix
+  * @brief 			- Renders a value in any base from 2 to 36 backwards from the end of a buffer
+  * @param [in] 	- value: Value to be rendered
+  * @param [in] 	- radix: Base of the digits @ref CONV_RADIX_define
+  * @param [in] 	- pEnd: Pointer to the null terminator at the end of the buffer
+  * @retval 		- Pointer to the first digit in the buffer, an empty string if the radix is not supported
+  * Note			- Values above 32 bits are first split into chunks of the largest power of the radix that
+  * 				  fits in 32 bits, so only one 64-bit division is made per chunk instead of per digit
+  */
+uint8 *Conv_Render_Radix(uint64 value, uint8 radix, uint8 *pEnd){
+	uint8 *pDigit = pEnd;
+	const conv_chunk_t *pChunk;
+	uint32 low, quotient;
+	uint8 count;
+	*pEnd = '\0';
+	if((CONV_RADIX_MIN > radix) || (CONV_RADIX_MAX < radix)){
+		return pEnd;
+	}
+	else{ /* Do Nothing */ }
+	pChunk = &Conv_Radix_Chunks[radix - CONV_RADIX_MIN];
+	while(CONV_U32_MAX < value){
+		low = (uint32)(value % pChunk->divisor);
+		value /= pChunk->divisor;
+		/* Inner chunks keep their leading zeros */
+		for(count = pChunk->digits; count > 0; count--){
+			quotient = low / radix;
+			pDigit--;
+			*pDigit = Conv_Digit_Chars[low - (quotient * radix)];
+			low = quotient;
+		}
+	}
+	low = (uint32)value;
+	do{
+		quotient = low / radix;
+		pDigit--;
+		*pDigit = Conv_Digit_Chars[low - (quotient * radix)];
+		low = quotient;
+	}while(0 != low);
+	return pDigit;
+}
@@ -0,0 +1,117 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : conversion.h 			                           	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef NUMBERING_MODE_CONVERSION_H_
+#define NUMBERING_MODE_CONVERSION_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Platform_Types.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref CONV_BUFFER_SIZES_define
+#define CONV_DECIMAL_SIZE		22	// 20 digits of a 64-bit number, room for a sign and null
+#define CONV_OCTAL_SIZE			23	// 22 digits of a 64-bit number and null
+#define CONV_BINARY_SIZE		65	// 64 digits of a 64-bit number and null
+#define CONV_HEXADECIMAL_SIZE	19	// 16 digits of a 64-bit number, room for "0x" and null
+#define CONV_RADIX_SIZE			65	// 64 digits of a 64-bit number in the smallest radix and null
+
+// @ref CONV_RADIX_define
+#define CONV_RADIX_MIN			2
+#define CONV_RADIX_MAX			36	// Digits are 0...9 and A...Z
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	CONV_DECIMAL,
+	CONV_OCTAL,
+	CONV_BINARY,
+	CONV_HEXADECIMAL,
+	conv_bases_max
+}conv_base_t;
+
+typedef struct{
+	uint8 decimal[CONV_DECIMAL_SIZE];
+	uint8 octal[CONV_OCTAL_SIZE];
+	uint8 binary[CONV_BINARY_SIZE];
+	uint8 hexadecimal[CONV_HEXADECIMAL_SIZE];
+	uint8 *pDigits[conv_bases_max];		// First digit of every base, indexed by @ref conv_base_t
+}conv_bases_t;
+
+typedef struct{
+	uint32 divisor;		// Largest power of the radix that fits in 32 bits
+	uint8 digits;		// Number of digits of a chunk, the exponent of the divisor
+}conv_chunk_t;
+
+/*
+ * =============================================
+ * APIs Supported by "conversion"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Conv_Render_Binary
+  * @brief 			- Renders a value in base 2 backwards from the end of a buffer
+  * @param [in] 	- value: Value to be rendered
+  * @param [in] 	- pEnd: Pointer to the null terminator at the end of the buffer
+  * @retval 		- Pointer to the first digit in the buffer
+  * Note			- Expands 8 bits per step from a table, so the buffer must have room for the
+  * 				  number of digits rounded up to a multiple of 8
+  */
+uint8 *Conv_Render_Binary(uint64 value, uint8 *pEnd);
+
+/**=============================================
+  * @Fn				- Conv_Render_Power_Of_Two
+  * @brief 			- Renders a value in base 2, 8 or 16 backwards from the end of a buffer
+  * @param [in] 	- value: Value to be rendered
+  * @param [in] 	- shift: Number of bits per digit (1, 3 or 4)
+  * @param [in] 	- pEnd: Pointer to the null terminator at the end of the buffer
+  * @retval 		- Pointer to the first digit in the buffer
+  * Note			- Digits are extracted with shift and mask and looked up in a 16-entry table
+  */
+uint8 *Conv_Render_Power_Of_Two(uint64 value, uint8 shift, uint8 *pEnd);
+
+/**=============================================
+  * @Fn				- Conv_Render_Decimal
+  * @brief 			- Renders a value in base 10 backwards from the end of a buffer
+  * @param [in] 	- value: Value to be rendered
+  * @param [in] 	- pEnd: Pointer to the null terminator at the end of the buffer
+  * @retval 		- Pointer to the first digit in the buffer
+  * Note			- Two digits per step from a digit-pair table, division by 100 is a reciprocal multiply
+  * 				  Values above 32 bits are first split into chunks of 8 digits
+  */
+uint8 *Conv_Render_Decimal(uint64 value, uint8 *pEnd);
+
+/**=============================================
+  * @Fn				- Conv_Render_Bases
+  * @brief 			- Renders a value in base 10, 8, 2 and 16 at once
+  * @param [in] 	- value: Value to be rendered
+  * @param [out] 	- pBases: Buffers of all bases, digits are written at their ends
+  * @retval 		- None
+  * Note			- Octal, binary and hexadecimal digits are produced in one pass over the bytes of the value
+  */
+void Conv_Render_Bases(uint64 value, conv_bases_t *pBases);
+
+/**=============================================
+  * @Fn				- Conv_Render_Radix
+  * @brief 			- Renders a value in any base from 2 to 36 backwards from the end of a buffer
+  * @param [in] 	- value: Value to be rendered
+  * @param [in] 	- radix: Base of the digits @ref CONV_RADIX_define
+  * @param [in] 	- pEnd: Pointer to the null terminator at the end of the buffer
+  * @retval 		- Pointer to the first digit in the buffer, an empty string if the radix is not supported
+  * Note			- Values above 32 bits are first split into chunks of the largest power of the radix that
+  * 				  fits in 32 bits, so only one 64-bit division is made per chunk instead of per digit
+  */
+uint8 *Conv_Render_Radix(uint64 value, uint8 radix, uint8 *pEnd);
+
+#endif /* NUMBERING_MODE_CONVERSION_H_ */
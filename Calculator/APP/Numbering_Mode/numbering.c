@@ -9,668 +9,747 @@
 
 #include "numbering.h"
 
-// since our operands are 32 bits, max value is 10 digit long -> 4294967295
-#define ARRAY_MAX_SIZE		16 // Max is 16 binary bits
-#define DECIMAL_MAX_SIZE	5  // Max is 65535 which is 5 decimal digits
-#define OCTAL_MAX_SIZE		6  // Max is 177777 which is 6 octal digits
-#define BINARY_MAX_SIZE		16 // Max is 1111 1111 1111 1111 which is 16 binary bits
-#define HEXA_MAX_SIZE		4  // Max is 0xFFFF which is 4 hexadecimal bits
-#define LCD_MAX_COL			17 // Max number of columns of my 16x2 LCD to decrement from when writing from right side
-
-void (*pf_Numbering_State_Handler)(void) = STATE_CALL(Decimal_Mode);
-static numbering_states_t numbering_state_id = numbering_states_max;
-static uint8 Decimal_Number[DECIMAL_MAX_SIZE];  // Array to hold any decimal number
-static uint8 Decimal_Length;					// Contains length of number in "Decimal_Number" array
-static uint8 Octal_Number[OCTAL_MAX_SIZE];  	// Array to hold any octal number
-static uint8 Octal_Length;						// Contains length of number in "Octal_Number" array
-static uint8 Hexa_Number[HEXA_MAX_SIZE];  		// Array to hold any hexadecimal number
-static uint8 Hexadecimal_Length;				// Contains length of number in "Hexa_Number" array
-static uint8 Binary_Number[BINARY_MAX_SIZE];  	// Array to hold any binary number
-static uint8 Binary_Length;						// Contains length of number in "Binary_Number" array
+#define LCD_VISIBLE_COLS	16 // Number of columns of my 16x2 LCD visible at once
+#define LCD_DDRAM_COLS		40 // Number of columns of display data RAM behind each row, the display shifts over them
+#define VIEW_END			0xFF // Offset that shows the end of the first row
+#define STATUS_BASE_COL		5  // Column of the second base letter in the status line
+#define STATUS_DIGITS		10 // Columns left for the digits of the second base in the status line
+
+void (*pf_Numbering_State_Handler)(void) = STATE_CALL(Numbering);
+static const hsm_machine_t Numbering_Machine;
+static hsm_t Numbering_HSM = {&Numbering_Machine, HSM_NO_STATE};
+/* Working set of the mode, taken from the arena when the mode is entered */
+typedef struct{
+	uint64 value;							// Canonical value of the number, shared by all bases and packed in one word
+	uint64 operand;							// First operand of the pending operation
+	const char *indicator;					// Shown at the left of the second row, at most 4 characters
+	numbering_states_t view;				// Last view entered, the shift layer works on it
+	numbering_word_t word;					// Selected word size
+	numbering_operation_t operation;		// Pending operation, waiting for the second operand
+	uint8 length;							// Number of typed digits, 0 if nothing is entered
+	uint8 secondary;						// Radix shown on the second row, never the radix of the current view
+	uint8 text_length;						// Number of characters of the first row, including "0x"
+	uint8 offset;							// First character of the first row visible on the LCD
+	uint8 segment;							// First character of the first row loaded in display data RAM
+	uint8 entry_offset;						// Offset shown when a view is entered
+	uint8 is_signed;						// 1 to show decimal numbers as two's complement of the word size
+	uint8 new_entry;						// 1 if the next digit starts a new number instead of extending a result
+}numbering_work_t;
+ARENA_CHECK(numbering_work_t);
+
+static numbering_work_t *Num;				// NULL while the mode is not running
 static uint8 pressed_key;
+static hsm_event_t pressed_event;
 static uint8 double_check_before_quitting;
 
+/* Bits per digit (0 for decimal), radix and letter of every view, indexed by @ref numbering_states_t
+ * The views are in the same order as @ref conv_base_t, so a view indexes the rendered bases directly */
+static const uint8 Numbering_Digit_Shifts[numbering_views_max] = {0, 3, 1, 4};
+static const uint8 Numbering_Radixes[numbering_views_max] = {10, 8, 2, 16};
+static const uint8 Numbering_Base_Letters[numbering_views_max] = {'D', 'O', 'B', 'H'};
+
+/* Bits of every word size, indexed by @ref numbering_word_t */
+static const uint8 Numbering_Word_Bits[numbering_words_max] = {8, 16, 32, 64};
+
+/* Custom characters of two binary digits, indexed by their value, a tall bar is a 1 and a low bar is a 0 */
+static const uint8 Numbering_Bit_Pair_Glyphs[4][LCD_GLYPH_ROWS] = {
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00},
+		{0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1B, 0x00},
+		{0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1B, 0x00},
+		{0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x00}
+};
+
+/* Names of the operations, indexed by @ref numbering_operation_t */
+static const char *const Numbering_Op_Names[numbering_operations_max] = {
+		"", "AND", "OR", "XOR", "SHL", "SHR", "SAR", "ROL", "ROR", "SET", "CLR", "TST"
+};
+
+/* Operation of every shifted number key, '0' toggles signed display, '4' is NOT and '7' jumps along the first row */
+static const numbering_operation_t Numbering_Shift_Digit_Ops[10] = {
+		NUMBERING_OP_NONE, NUMBERING_OP_AND, NUMBERING_OP_OR, NUMBERING_OP_XOR, NUMBERING_OP_NONE,
+		NUMBERING_OP_SHL, NUMBERING_OP_SHR, NUMBERING_OP_NONE, NUMBERING_OP_ROL, NUMBERING_OP_ROR
+};
+
 /**=============================================
-  * @Fn				- PowerOf
-  * @brief 			- This function calculates the result of "base" power of "power"
-  * @param [in] 	- base: Base number
-  * @param [in] 	- power: Exponend number
-  * @retval 		- Result of "base" power of "power"
+  * @Fn				- Word_Mask
+  * @brief 			- This function will return the mask of the selected word size
+  * @param [in] 	- None
+  * @retval 		- Mask with the lowest "Numbering_Word_Bits" bits set
   * Note			- None
   */
-static uint32 PowerOf(uint8 base, uint8 power){
-	uint32 result = 1;
-	uint8 index;
-	for(index = 0; index < power; index++){
-		result *= base;
-	}
-	return result;
+static uint64 Word_Mask(void){
+	return (~0ULL >> (64 - Numbering_Word_Bits[Num->word]));
 }
 
 /**=============================================
-  * @Fn				- Print_Array_LCD
-  * @brief 			- This function will print an array on the LCD
-  * @param [in] 	- Array: Pointer to the array containing digits
-  * @param [in] 	- Length: Length of valid digits in the array
-  * @retval 		- None
-  * Note			- Supports arrays containing hexadecimal digits (>=10)
+  * @Fn				- Is_Negative
+  * @brief 			- This function will check if the value is shown with a minus sign in decimal
+  * @param [in] 	- None
+  * @retval 		- 1 if the value is negative, 0 otherwise
+  * Note			- Only decimal shows a sign, the other bases show the two's complement bits
   */
-static void Print_Array_LCD(uint8 *Array, uint8 Length){
-	uint8 index;
-	for(index = 0; index < Length; index++){
-		if((0 <= Array[index]) && (10 > Array[index])){
-			LCD_Send_Char(Array[index]+48);
-		}
-		else{
-			switch(Array[index]){
-			case 10:
-				LCD_Send_Char('A');
-				break;
-			case 11:
-				LCD_Send_Char('B');
-				break;
-			case 12:
-				LCD_Send_Char('C');
-				break;
-			case 13:
-				LCD_Send_Char('D');
-				break;
-			case 14:
-				LCD_Send_Char('E');
-				break;
-			case 15:
-				LCD_Send_Char('F');
-				break;
-			}
-		}
-	}
+static uint8 Is_Negative(void){
+	return ((1 == Num->is_signed) && (0 != Num->length) &&
+			(0 != ((Num->value >> (Numbering_Word_Bits[Num->word] - 1)) & 1)));
 }
 
 /**=============================================
-  * @Fn				- Flush_Array
-  * @brief 			- This function will save array elements into a variable
-  * @param [in] 	- arr: Pointer to the array containing digits
-  * @param [in] 	- length: Length of valid digits in the array
-  * @retval 		- Extracted number out of the array
-  * Note			- Can't be used if array elements can contain 2 digit number (>=10) EX: Hexadecimal numbers
+  * @Fn				- Radix_View
+  * @brief 			- This function will find the view of a radix
+  * @param [in] 	- radix: Radix to look for
+  * @retval 		- View with this radix @ref numbering_states_t, numbering_views_max if it has none
+  * Note			- None
   */
-static uint32 Flush_Array(uint8 *arr, uint8 length){
-	uint32 result = 0;
-	uint8 index;
-	for(index = 0; index < length; index++){
-		result += arr[index];
-		result *= 10;
+static numbering_states_t Radix_View(uint8 radix){
+	numbering_states_t view = Decimal_Mode;
+	while((numbering_views_max != view) && (radix != Numbering_Radixes[view])){
+		view++;
 	}
-	result /= 10;
-	return result;
+	return view;
+}
+
+/* Operation kernels, "a" is the first operand, "b" the second operand or the bit count, the caller masks the result */
+static uint64 Op_None(uint64 a, uint64 b, uint8 bits){
+	return b;
+}
+
+static uint64 Op_And(uint64 a, uint64 b, uint8 bits){
+	return (a & b);
+}
+
+static uint64 Op_Or(uint64 a, uint64 b, uint8 bits){
+	return (a | b);
+}
+
+static uint64 Op_Xor(uint64 a, uint64 b, uint8 bits){
+	return (a ^ b);
+}
+
+static uint64 Op_Shl(uint64 a, uint64 b, uint8 bits){
+	return (b < bits) ? (a << b) : 0;
+}
+
+static uint64 Op_Shr(uint64 a, uint64 b, uint8 bits){
+	return (b < bits) ? (a >> b) : 0;
+}
+
+static uint64 Op_Sar(uint64 a, uint64 b, uint8 bits){
+	/* Sign extend the word to 64 bits, then let the signed shift copy the sign bit */
+	return (uint64)(((sint64)(a << (64 - bits)) >> (64 - bits)) >> ((b < bits) ? (uint8)b : (uint8)(bits - 1)));
 }
 
+static uint64 Op_Rol(uint64 a, uint64 b, uint8 bits){
+	b %= bits;
+	return (0 == b) ? a : ((a << b) | (a >> (bits - b)));
+}
+
+static uint64 Op_Ror(uint64 a, uint64 b, uint8 bits){
+	b %= bits;
+	return (0 == b) ? a : ((a >> b) | (a << (bits - b)));
+}
+
+static uint64 Op_Set(uint64 a, uint64 b, uint8 bits){
+	return (b < bits) ? (a | (1ULL << b)) : a;
+}
+
+static uint64 Op_Clear(uint64 a, uint64 b, uint8 bits){
+	return (b < bits) ? (a & ~(1ULL << b)) : a;
+}
+
+static uint64 Op_Test(uint64 a, uint64 b, uint8 bits){
+	return (b < bits) ? ((a >> b) & 1) : 0;
+}
+
+/* Kernel of every operation, indexed by @ref numbering_operation_t */
+static uint64 (*const Numbering_Op_Kernels[numbering_operations_max])(uint64 a, uint64 b, uint8 bits) = {
+		Op_None, Op_And, Op_Or, Op_Xor, Op_Shl, Op_Shr, Op_Sar, Op_Rol, Op_Ror, Op_Set, Op_Clear, Op_Test
+};
+
 /**=============================================
-  * @Fn				- Integer_To_Array_Reversed
-  * @brief 			- This function will save an array to an array in reversed order
-  * @param [in] 	- source_int: Integer variable that contains the decimal value
-  * @param [out] 	- Dest_Array: Pointer to the destination array to save digits into
-  * @retval 		- Length of valid elements in array
-  * Note			- You must use function Reverse_Array after this if you want the values to be normal not reversed
+  * @Fn				- Render_Bases
+  * @brief 			- This function will render the canonical value in every base
+  * @param [in] 	- view: Current view @ref numbering_states_t, gets the "0x" prefix if hexadecimal
+  * @param [out] 	- pBases: Rendered bases, all empty if nothing is entered
+  * @retval 		- None
+  * Note			- One conversion pass serves both rows of the LCD
   */
-static uint8 Integer_To_Array_Reversed(uint32 source_int, uint8 *Dest_Array){
-	uint8 index = 0;
-	while(0 != source_int){
-		Dest_Array[index] = source_int % 10;
-		source_int /= 10;
-		index++;
+static void Render_Bases(numbering_states_t view, conv_bases_t *pBases){
+	uint8 base;
+	Conv_Render_Bases(Num->value, pBases);
+	if(0 == Num->length){
+		for(base = 0; base < conv_bases_max; base++){
+			pBases->pDigits[base] += strlen((char*)pBases->pDigits[base]);
+		}
+	}
+	else if(1 == Is_Negative()){
+		pBases->pDigits[CONV_DECIMAL] = Conv_Render_Decimal(((~Num->value) + 1) & Word_Mask(), &pBases->decimal[CONV_DECIMAL_SIZE - 1]);
+		pBases->pDigits[CONV_DECIMAL]--;
+		*pBases->pDigits[CONV_DECIMAL] = '-';
 	}
-	return index;
+	else{ /* Do Nothing */ }
+	if(Hexadecimal_Mode == view){
+		pBases->pDigits[CONV_HEXADECIMAL] -= 2;
+		pBases->pDigits[CONV_HEXADECIMAL][0] = '0';
+		pBases->pDigits[CONV_HEXADECIMAL][1] = 'x';
+	}
+	else{ /* Do Nothing */ }
 }
 
 /**=============================================
-  * @Fn				- Reverse_Array
-  * @brief 			- This function will reverse elements in an array of given size
-  * @param 	 		- arr: Pointer to the array to be reversed
-  * @param [in] 	- length: Length of valid array elements
-  * @param [out] 	- None
+  * @Fn				- Pack_Binary
+  * @brief 			- This function will pack binary digits two per character cell
+  * @param [in] 	- pDigits: Binary digits
+  * @param [out] 	- pCells: Character codes of the custom characters, null terminated
   * @retval 		- None
-  * Note			- None
+  * Note			- An odd number of digits gets a leading 0, so every cell holds an aligned pair of bits
+  * 				  The four characters are uploaded once, later calls find them cached by the LCD driver
   */
-static void Reverse_Array(uint8 *arr, uint8 length){
-	uint8 temp, index;
-	uint8 *pStart = arr;
-	uint8 *pEnd = (arr + length);
-	for(index = 0; index <= length/2; index++){
-		temp = *pStart;
-		*pStart = *pEnd;
-		*pEnd = temp;
-		pStart++;
-		pEnd--;
+static void Pack_Binary(const uint8 *pDigits, uint8 *pCells){
+	uint8 glyphs[4];
+	uint8 pair;
+	for(pair = 0; pair < 4; pair++){
+		glyphs[pair] = LCD_Create_Char(Numbering_Bit_Pair_Glyphs[pair]);
+	}
+	if(0 != (strlen((char*)pDigits) & 1)){
+		*pCells = glyphs[pDigits[0] - '0'];
+		pCells++;
+		pDigits++;
+	}
+	else{ /* Do Nothing */ }
+	while('\0' != pDigits[0]){
+		*pCells = glyphs[((pDigits[0] - '0') << 1) | (pDigits[1] - '0')];
+		pCells++;
+		pDigits += 2;
 	}
+	*pCells = '\0';
 }
 
 /**=============================================
-  * @Fn				- DecToBin
-  * @brief 			- This function shall convert decimal number from "Decimal_Number" array to octal number and save it in "Octal_Number" array
-  * @param [in] 	- None
-  * @param [out] 	- None
+  * @Fn				- Compose_Status
+  * @brief 			- This function will compose the status line shown on the second row
+  * @param [in] 	- view: Current view @ref numbering_states_t
+  * @param [in] 	- pBases: Rendered bases
+  * @param [out] 	- pLine: LCD_VISIBLE_COLS characters filled with spaces, not null terminated
   * @retval 		- None
-  * Note			- None
+  * Note			- Columns 1...4 show the indicator, or the letter of the view with the word size ('i' if signed)
+  * 				  Columns 6...16 show the second base, its least significant digits if it is too long
+  * 				  Bases without a view are shown with their radix in columns 5...6 instead of a letter
   */
-static void DecToOct(){
-	uint32 decimal_value = 0;
-
-	/* If Decimal_Number array contains no valid numbers */
-	if(0 == Decimal_Length){
-		memset(Octal_Number, 0, OCTAL_MAX_SIZE);
-		Octal_Length = 0;
+static void Compose_Status(numbering_states_t view, const conv_bases_t *pBases, uint8 *pLine){
+	uint8 radix_digits[CONV_RADIX_SIZE];
+	numbering_states_t base = Radix_View(Num->secondary);
+	const uint8 *pDigits;
+	uint8 length;
+	uint8 bits = Numbering_Word_Bits[Num->word];
+	uint8 index = 1;
+	if(numbering_views_max != base){
+		pDigits = pBases->pDigits[base];
+		pLine[STATUS_BASE_COL] = Numbering_Base_Letters[base];
 	}
 	else{
-		/* Save elements of "Decimal_Number" array to "decimal_value" variable */
-		decimal_value = Flush_Array(Decimal_Number, Decimal_Length);
-
-		/* Clear "Decimal_Number" array and its counter */
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
-
-		/* Clear "Octal_Number" array and its counter */
-		memset(Octal_Number, 0, OCTAL_MAX_SIZE);
-		Octal_Length = 0;
-
-		/* Convert "decimal_value" variable to octal and save result in "Octal_Number" array */
-		while(0 != decimal_value){
-			Octal_Number[Octal_Length] += decimal_value % 8;
-			decimal_value /= 8;
-			Octal_Length++;
+		pDigits = Conv_Render_Radix(Num->value, Num->secondary, &radix_digits[CONV_RADIX_SIZE - 1]);
+		pDigits = (0 == Num->length) ? &radix_digits[CONV_RADIX_SIZE - 1] : pDigits;
+		if(10 <= Num->secondary){
+			pLine[STATUS_BASE_COL - 1] = (Num->secondary / 10) + '0';
 		}
-
-		/* Check if there is a number in "Octal_Number" array */
-		if(0 != Octal_Length){
-			/* Reverse "Octal_Number" array */
-			Reverse_Array(Octal_Number, (Octal_Length-1));
+		else{ /* Do Nothing */ }
+		pLine[STATUS_BASE_COL] = (Num->secondary % 10) + '0';
+	}
+	length = (uint8)strlen((char*)pDigits);
+	if('\0' != Num->indicator[0]){
+		memcpy(pLine, Num->indicator, strlen(Num->indicator));
+	}
+	else{
+		pLine[0] = Numbering_Base_Letters[view];
+		if(10 <= bits){
+			pLine[index] = (bits / 10) + '0';
+			index++;
 		}
 		else{ /* Do Nothing */ }
+		pLine[index] = (bits % 10) + '0';
+		index++;
+		if(1 == Num->is_signed){
+			pLine[index] = 'i';
+		}
+		else{ /* Do Nothing */ }
+	}
+	if(STATUS_DIGITS < length){
+		pDigits += (length - (STATUS_DIGITS - 1));
+		length = STATUS_DIGITS - 1;
+		pLine[STATUS_BASE_COL + 1] = '<';
 	}
+	else{ /* Do Nothing */ }
+	memcpy(&pLine[LCD_VISIBLE_COLS - length], pDigits, length);
 }
 
 /**=============================================
-  * @Fn				- OctToDec
-  * @brief 			- This function shall convert octal number from "Octal_Number" array to decimal number and save it in "Decimal_Number" array
-  * @param [in] 	- None
-  * @param [out] 	- None
+  * @Fn				- Refresh
+  * @brief 			- This function will bring both rows of the LCD up to date with the canonical value
+  * @param [in] 	- view: Current view @ref numbering_states_t
+  * @param [in] 	- offset: First character of the first row to be visible, VIEW_END to show its end
   * @retval 		- None
-  * Note			- None
+  * Note			- Rows are written through the shadow display data RAM of the LCD driver, so only changed cells
+  * 				  are sent. A first row wider than the LCD is scrolled with the display shift commands and
+  * 				  loaded in segments when it is wider than display data RAM, the status line follows the shift
+  * 				  Binary is shown two digits per character, so 32 bits fit on the LCD at once
   */
-static void OctToDec(){
-	uint32 octal_value = 0;
-	uint32 decimal_value = 0;
-	uint8 index = 0;
-	/* If Octal_Number array contains no valid numbers */
-	if(0 == Octal_Length){
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
+static void Refresh(numbering_states_t view, uint8 offset){
+	conv_bases_t bases;
+	uint8 line[LCD_DDRAM_COLS + 1];
+	uint8 cells[(CONV_BINARY_SIZE / 2) + 1];
+	uint8 *pRow;
+	uint8 segment = Num->segment;
+	uint8 shift = Num->offset - Num->segment;
+	uint8 count, target, max_offset;
+
+	Render_Bases(view, &bases);
+	pRow = bases.pDigits[view];
+	if(Binary_Mode == view){
+		Pack_Binary(pRow, cells);
+		pRow = cells;
 	}
-	else{
-		/* Save elements of "Octal_Number" array to "octal_value" variable */
-		octal_value = Flush_Array(Octal_Number, Octal_Length);
-
-		/* Clear "Octal_Number" array and its counter */
-		memset(Octal_Number, 0, OCTAL_MAX_SIZE);
-		Octal_Length = 0;
-
-		/* Clear "Decimal_Number" array and its counter */
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
-
-		/* Convert "octal_value" variable to decimal and save result in "Decimal_Number" array */
-		while(0 != octal_value){
-			decimal_value += ((octal_value % 10) * PowerOf(8, index));
-			index++;
-			octal_value /= 10;
-		}
-
-		/* Save "decimal_value" in "Decimal_Number" Array */
-		Decimal_Length = Integer_To_Array_Reversed(decimal_value, Decimal_Number);
+	else{ /* Do Nothing */ }
+	Num->text_length = (uint8)strlen((char*)pRow);
+	max_offset = (LCD_VISIBLE_COLS < Num->text_length) ? (Num->text_length - LCD_VISIBLE_COLS) : 0;
+	if(max_offset < offset){
+		offset = max_offset;
+	}
+	else{ /* Do Nothing */ }
 
-		/* Check if there is a number in "Decimal_Number" array */
-		if(0 != Decimal_Length){
-			/* Reverse "Decimal_Number" array */
-			Reverse_Array(Decimal_Number, (Decimal_Length-1));
-		}
-		else{ /* Do Nothing */ }
+	/* Select the part of the first row held in display data RAM, with the window at its far end */
+	if(LCD_DDRAM_COLS >= Num->text_length){
+		segment = 0;
+	}
+	else if(offset < segment){
+		segment = ((offset + LCD_VISIBLE_COLS) > LCD_DDRAM_COLS) ? (offset + LCD_VISIBLE_COLS - LCD_DDRAM_COLS) : 0;
+	}
+	else if((offset + LCD_VISIBLE_COLS) > (segment + LCD_DDRAM_COLS)){
+		segment = offset;
 	}
+	else{ /* Do Nothing */ }
+
+	/* First row */
+	memset(line, ' ', LCD_DDRAM_COLS);
+	line[LCD_DDRAM_COLS] = '\0';
+	count = Num->text_length - segment;
+	memcpy(line, &pRow[segment], (LCD_DDRAM_COLS < count) ? LCD_DDRAM_COLS : count);
+	LCD_Update_String_Pos(line, LCD_FIRST_ROW, 1);
+
+	/* Display shift */
+	target = offset - segment;
+	while(shift < target){
+		LCD_Send_Command(LCD_DISPLAY_SHIFT_LEFT);
+		shift++;
+	}
+	while(shift > target){
+		LCD_Send_Command(LCD_DISPLAY_SHIFT_RIGHT);
+		shift--;
+	}
+	Num->segment = segment;
+	Num->offset = offset;
+
+	/* Second row */
+	memset(line, ' ', LCD_DDRAM_COLS);
+	Compose_Status(view, &bases, &line[shift]);
+	LCD_Update_String_Pos(line, LCD_SECOND_ROW, 1);
+
+	/* Return the cursor to the end of the first row */
+	count = (Num->text_length - segment) + 1;
+	LCD_Set_Cursor(LCD_FIRST_ROW, (LCD_DDRAM_COLS < count) ? LCD_DDRAM_COLS : count);
 }
 
 /**=============================================
-  * @Fn				- DecToBin
-  * @brief 			- This function shall convert decimal number from "Decimal_Number" array to binary number and save it in "Binary_Number" array
-  * @param [in] 	- None
-  * @param [out] 	- None
+  * @Fn				- Enter_Digit
+  * @brief 			- This function will add a digit typed in a view to the canonical value
+  * @param [in] 	- view: View the digit was typed in @ref numbering_states_t
+  * @param [in] 	- digit: Typed digit, must be less than the base of the view
   * @retval 		- None
-  * Note			- None
+  * Note			- The digit is ignored if the number would not fit in the selected word size,
+  * 				  a shown result is replaced by a new number
   */
-static void DecToBin(){
-	uint32 decimal_value = 0;
-
-	/* If Decimal_Number array contains no valid numbers */
-	if(0 == Decimal_Length){
-		memset(Binary_Number, 0, BINARY_MAX_SIZE);
-		Binary_Length = 0;
+static void Enter_Digit(numbering_states_t view, uint8 digit){
+	uint64 mask = Word_Mask();
+	uint8 shift = Numbering_Digit_Shifts[view];
+	uint8 fits;
+	if((1 == Num->new_entry) || ((Decimal_Mode == view) && (1 == Is_Negative()))){
+		/* A result is shown, the digit starts a new number */
+		Num->new_entry = 0;
+		Num->value = 0;
+		Num->length = 0;
+		Num->indicator = Numbering_Op_Names[Num->operation];
+	}
+	else{ /* Do Nothing */ }
+	if(Decimal_Mode == view){
+		/* Signed numbers are typed positive, so the sign bit is kept clear */
+		mask = (1 == Num->is_signed) ? (mask >> 1) : mask;
+		fits = (Num->value <= ((mask - digit) / 10));
 	}
 	else{
-		/* Save elements of "Decimal_Number" array to "decimal_value" variable */
-		decimal_value = Flush_Array(Decimal_Number, Decimal_Length);
-
-		/* Clear "Decimal_Number" array and its counter */
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
-
-		/* Clear "Binary_Number" array and its counter */
-		memset(Binary_Number, 0, BINARY_MAX_SIZE);
-		Binary_Length = 0;
-
-		/* Convert "decimal_value" variable to binary and save result in "Binary_Number" array */
-		while(0 != decimal_value){
-			Binary_Number[Binary_Length] += decimal_value % 2;
-			decimal_value /= 2;
-			Binary_Length++;
-		}
+		fits = (Num->value <= (mask >> shift));
+	}
 
-		/* Check if there is a number in "Binary_Number" array */
-		if(0 != Binary_Length){
-			/* Reverse "Binary_Number" array */
-			Reverse_Array(Binary_Number, (Binary_Length-1));
-		}
-		else{ /* Do Nothing */ }
+	if(1 == fits){
+		Num->value = (Decimal_Mode == view) ? ((Num->value * 10) + digit) : ((Num->value << shift) | digit);
+		Num->length++;
 	}
+	else{ /* Do Nothing */ }
+	Refresh(view, VIEW_END);
 }
 
 /**=============================================
-  * @Fn				- BinToDec
-  * @brief 			- This function shall convert binary number from "Binary_Number" array to decimal number and save it in "Decimal_Number" array
+  * @Fn				- Next_Word_Size
+  * @brief 			- This function will select the next word size and truncate the operands to it
   * @param [in] 	- None
-  * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- Word sizes are 8, 16, 32 and 64 bits, the caller shows the value again
   */
-static void BinToDec(){
-	uint32 decimal_value = 0;
-	uint8 index = 0;
-	uint8 *pArrIndex = NULL;
-	/* If Binary_Number array contains no valid numbers */
-	if(0 == Binary_Length){
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
-	}
-	else{
-		/* Clear "Decimal_Number" array and its counter */
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
-
-		/* Pointer to the last digit in "Hexa_Number" array */
-		pArrIndex = (Binary_Number + (Binary_Length - 1));
+static void Next_Word_Size(void){
+	Num->word = (NUMBERING_WORD_64 == Num->word) ? NUMBERING_WORD_8 : (Num->word + 1);
+	Num->value &= Word_Mask();
+	Num->operand &= Word_Mask();
+}
 
-		/* Convert "Binary_Number" array to decimal and save result in "decimal_value" variable */
-		while(pArrIndex >= Binary_Number){
-			decimal_value += (*pArrIndex * PowerOf(2, index));
-			index++;
-			pArrIndex--;
+/**=============================================
+  * @Fn				- Evaluate
+  * @brief 			- This function will apply the pending operation to the first operand and the typed value
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- A bit test keeps the first operand and shows the bit in the indicator instead
+  */
+static void Evaluate(void){
+	uint64 result;
+	if(NUMBERING_OP_NONE != Num->operation){
+		result = Numbering_Op_Kernels[Num->operation](Num->operand, Num->value, Numbering_Word_Bits[Num->word]) & Word_Mask();
+		if(NUMBERING_OP_TEST == Num->operation){
+			Num->indicator = (0 != result) ? "B=1" : "B=0";
+			Num->value = Num->operand;
 		}
-
-		/* Clear "Hexa_Number" array and its counter */
-		memset(Binary_Number, 0, BINARY_MAX_SIZE);
-		Binary_Length = 0;
-
-		/* Save "decimal_value" in "Decimal_Number" Array */
-		Decimal_Length = Integer_To_Array_Reversed(decimal_value, Decimal_Number);
-
-		/* Check if there is a number in "Decimal_Number" array */
-		if(0 != Decimal_Length){
-			/* Reverse "Decimal_Number" array */
-			Reverse_Array(Decimal_Number, (Decimal_Length-1));
+		else{
+			Num->indicator = "";
+			Num->value = result;
 		}
-		else{ /* Do Nothing */ }
+		Num->operation = NUMBERING_OP_NONE;
+		Num->length = 1;
+		Num->new_entry = 1;
 	}
+	else{ /* Do Nothing */ }
 }
 
 /**=============================================
-  * @Fn				- DecToHex
-  * @brief 			- This function shall convert decimal number from "Decimal_Number" array to hexadecimal number and save it in "Hexa_Number" array
-  * @param [in] 	- None
-  * @param [out] 	- None
-  * @retval 		- None
-  * Note			- None
+  * @Fn				- Act_Shift_Key
+  * @brief 			- This function will handle the key pressed after '='
+  * @param [in] 	- event: Pressed key @ref hsm_key_event_t
+  * @retval 		- The view the shift layer was entered from
+  * Note			- '1' AND, '2' OR, '3' XOR, '4' NOT, '5' shift left, '6' shift right (arithmetic if signed),
+  * 				  '8' rotate left, '9' rotate right, '+' set bit, '-' clear bit, 'x' test bit,
+  * 				  '0' signed display, '/' next word size, '7' jump between the start and end of a long number,
+  * 				  '=' evaluate, 'C' cancel the pending operation
+  * 				  Binary operations take the shown value as first operand and the next typed number as second operand
   */
-static void DecToHex(){
-	uint32 decimal_value = 0;
-
-	/* If Decimal_Number array contains no valid numbers */
-	if(0 == Decimal_Length){
-		memset(Hexa_Number, 0, HEXA_MAX_SIZE);
-		Hexadecimal_Length = 0;
+static hsm_state_t Act_Shift_Key(hsm_event_t event){
+	numbering_operation_t operation = NUMBERING_OP_NONE;
+	uint8 key = HSM_Event_Key(event);
+	double_check_before_quitting = 0; // Clear flag
+	Num->indicator = Numbering_Op_Names[Num->operation];
+	if((0 <= key) && (10 > key)){
+		operation = Numbering_Shift_Digit_Ops[key];
 	}
-	else{
-		/* Save elements of "Decimal_Number" array to "decimal_value" variable */
-		decimal_value = Flush_Array(Decimal_Number, Decimal_Length);
-
-		/* Clear "Decimal_Number" array and its counter */
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
-
-		/* Clear "Hexa_Number" array and its counter */
-		memset(Hexa_Number, 0, HEXA_MAX_SIZE);
-		Hexadecimal_Length = 0;
-
-		/* Convert "decimal_value" variable to hexadecimal and save result in "Hexa_Number" array */
-		while(0 != decimal_value){
-			Hexa_Number[Hexadecimal_Length] += decimal_value % 16;
-			decimal_value /= 16;
-			Hexadecimal_Length++;
-		}
+	else if('+' == key){
+		operation = NUMBERING_OP_SET;
+	}
+	else if('-' == key){
+		operation = NUMBERING_OP_CLEAR;
+	}
+	else if('x' == key){
+		operation = NUMBERING_OP_TEST;
+	}
+	else{ /* Do Nothing */ }
 
-		/* Check if there is a number in "Hexa_Number" array */
-		if(0 != Hexadecimal_Length){
-			/* Reverse "Hexa_Number" array */
-			Reverse_Array(Hexa_Number, (Hexadecimal_Length-1));
+	if(NUMBERING_OP_NONE != operation){
+		if((NUMBERING_OP_SHR == operation) && (1 == Num->is_signed)){
+			operation = NUMBERING_OP_SAR;
 		}
 		else{ /* Do Nothing */ }
+		/* Chained operations use the result of the pending one */
+		Evaluate();
+		Num->operand = Num->value;
+		Num->operation = operation;
+		Num->indicator = Numbering_Op_Names[operation];
+		Num->value = 0;
+		Num->length = 0;
+		Num->new_entry = 0;
+	}
+	else if(4 == key){
+		Evaluate();
+		Num->value = (~Num->value) & Word_Mask();
+		Num->length = 1;
+		Num->new_entry = 1;
+	}
+	else if(0 == key){
+		Num->is_signed ^= 1;
+		Num->new_entry = 1;
+	}
+	else if(7 == key){
+		Num->entry_offset = (0 == Num->offset) ? VIEW_END : 0;
+	}
+	else if('/' == key){
+		Next_Word_Size();
+		Num->new_entry = 1;
+	}
+	else if('=' == key){
+		Evaluate();
+	}
+	else if('C' == key){
+		Num->operation = NUMBERING_OP_NONE;
+		Num->indicator = "";
 	}
+	else{ /* Do Nothing */ }
+	return Num->view;
 }
 
 /**=============================================
-  * @Fn				- HexToDec
-  * @brief 			- This function shall convert hexadecimal number from "Hexa_Number" array to decimal number and save it in "Decimal_Number" array
+  * @Fn				- Enter_Shift_Layer
+  * @brief 			- Entry hook of the shift layer, shows that the next key selects a shifted function
   * @param [in] 	- None
-  * @param [out] 	- None
   * @retval 		- None
   * Note			- None
   */
-static void HexToDec(){
-	uint32 decimal_value = 0;
-	uint8 index = 0;
-	uint8 *pArrIndex = NULL;
-	/* If Hexa_Number array contains no valid numbers */
-	if(0 == Hexadecimal_Length){
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
-	}
-	else{
-		/* Clear "Decimal_Number" array and its counter */
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
-
-		/* Pointer to the last digit in "Hexa_Number" array */
-		pArrIndex = (Hexa_Number + (Hexadecimal_Length - 1));
+static void Enter_Shift_Layer(void){
+	Num->indicator = "SHFT";
+	Refresh(Num->view, Num->offset);
+}
 
-		/* Convert "Hexa_Number" array to decimal and save result in "decimal_value" variable */
-		while(pArrIndex >= Hexa_Number){
-			decimal_value += (*pArrIndex * PowerOf(16, index));
-			index++;
-			pArrIndex--;
-		}
+/**=============================================
+  * @Fn				- Enter_View
+  * @brief 			- Entry hook of the views, shows the value in the entered view
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- If the new view was on the second row, the old view takes its place
+  */
+static void Enter_View(void){
+	numbering_states_t view = Numbering_HSM.current;
+	if(Numbering_Radixes[view] == Num->secondary){
+		Num->secondary = Numbering_Radixes[Num->view];
+	}
+	else{ /* Do Nothing */ }
+	Num->view = view;
+	Refresh(view, Num->entry_offset);
+	Num->entry_offset = VIEW_END;
+}
 
-		/* Clear "Hexa_Number" array and its counter */
-		memset(Hexa_Number, 0, HEXA_MAX_SIZE);
-		Hexadecimal_Length = 0;
+/**=============================================
+  * @Fn				- Act_Digit
+  * @brief 			- This function will add a digit to the value if the current view has it
+  * @param [in] 	- event: Digit event @ref hsm_key_event_t
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- None
+  */
+static hsm_state_t Act_Digit(hsm_event_t event){
+	if(Numbering_Radixes[Num->view] > event){
+		/* Validate that the number fits in the selected word size */
+		Enter_Digit(Num->view, event);
+	}
+	else{ /* Do Nothing */ }
+	return HSM_TABLE_NEXT;
+}
 
-		/* Save "decimal_value" in "Decimal_Number" Array */
-		Decimal_Length = Integer_To_Array_Reversed(decimal_value, Decimal_Number);
+/**=============================================
+  * @Fn				- Act_Next_Secondary
+  * @brief 			- This function will show the next radix on the second row
+  * @param [in] 	- event: Key of the current view
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- Radixes go from 2 to 36, the radix of the current view is skipped
+  */
+static hsm_state_t Act_Next_Secondary(hsm_event_t event){
+	do{
+		Num->secondary = (CONV_RADIX_MAX == Num->secondary) ? CONV_RADIX_MIN : (Num->secondary + 1);
+	}while(Numbering_Radixes[Num->view] == Num->secondary);
+	Refresh(Num->view, Num->offset);
+	return HSM_TABLE_NEXT;
+}
 
-		/* Check if there is a number in "Decimal_Number" array */
-		if(0 != Decimal_Length){
-			/* Reverse "Decimal_Number" array */
-			Reverse_Array(Decimal_Number, (Decimal_Length-1));
-		}
-		else{ /* Do Nothing */ }
+/**=============================================
+  * @Fn				- Act_Scroll
+  * @brief 			- This function will scroll the first row by one character
+  * @param [in] 	- event: '4' towards the most significant digit, '6' towards the least significant digit
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- None
+  */
+static hsm_state_t Act_Scroll(hsm_event_t event){
+	if(EV_KEY_6 == event){
+		Refresh(Num->view, Num->offset + 1);
 	}
+	else if(0 != Num->offset){
+		Refresh(Num->view, Num->offset - 1);
+	}
+	else{ /* Do Nothing */ }
+	return HSM_TABLE_NEXT;
 }
 
-
 /**=============================================
-  * @Fn				- ST_Decimal_Mode
-  * @brief 			- In this state, the number on the screen is displayed in decimal format
+  * @Fn				- Clear_Value
+  * @brief 			- This function will clear the canonical value and the pending operation
   * @param [in] 	- None
-  * @param [out] 	- None
   * @retval 		- None
-  * Note			- Initial state
+  * Note			- Word size, signed display and the second row radix are kept
   */
-STATE_DEF(Decimal_Mode){
-	/* State Name */
-	if(Decimal_Mode != numbering_state_id){
-		numbering_state_id = Decimal_Mode;
-		LCD_Send_string_Pos((uint8*)"DECIMAL", LCD_SECOND_ROW, (LCD_MAX_COL-7));
-		LCD_Set_Cursor(LCD_FIRST_ROW, Decimal_Length + 1);
-	}
-
-	/* State Action */
-	pressed_key = keypad_Get_Pressed_Key();
-	if((0 <= pressed_key) && (10 > pressed_key)){
-		double_check_before_quitting = 0; // Clear flag
-		/* Validate that user is inputting a 5 digit decimal */
-		if(DECIMAL_MAX_SIZE > Decimal_Length){
-			LCD_Send_Char(pressed_key+48);
-			Decimal_Number[Decimal_Length] = pressed_key;
-			Decimal_Length++;
-		}
-		else{ /* Do Nothing */ }
+static void Clear_Value(void){
+	Num->value = 0;
+	Num->length = 0;
+	Num->operation = NUMBERING_OP_NONE;
+	Num->new_entry = 0;
+	Num->indicator = "";
+}
+
+/**=============================================
+  * @Fn				- Act_Clear
+  * @brief 			- This function will clear the number and go to decimal, or exit if 'C' is pressed twice in decimal
+  * @param [in] 	- event: 'C' event
+  * @retval 		- HSM_TABLE_NEXT, or HSM_NO_STATE to exit
+  * Note			- Shared by all views through Numbering_Common
+  */
+static hsm_state_t Act_Clear(hsm_event_t event){
+	Clear_Value();
+	if((Decimal_Mode == Num->view) && (1 == double_check_before_quitting)){
+		/* The working set goes back to the arena when the mode exits */
+		Num = NULL;
+		USER_RESET_FLAG = 1;
+		return HSM_NO_STATE;
 	}
-	else if('x' == pressed_key){
-		double_check_before_quitting = 0; // Clear flag
-		/* Go to octal mode */
-		DecToOct();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		Print_Array_LCD(Octal_Number, Octal_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Octal_Mode);
-	}
-	else if('-' == pressed_key){
-		double_check_before_quitting = 0; // Clear flag
-		/* Go to binary mode */
-		DecToBin();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		Print_Array_LCD(Binary_Number, Binary_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Binary_Mode);
-	}
-	else if('+' == pressed_key){
-		double_check_before_quitting = 0; // Clear flag
-		/* Go to hexadecimal mode */
-		DecToHex();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		LCD_Send_String((uint8*)"0x");
-		Print_Array_LCD(Hexa_Number, Hexadecimal_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Hexadecimal_Mode);
-	}
-	else if('C' == pressed_key){
-		/* Clear screen, or exit if pressed twice in a row */
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
-		Decimal_Length = 0;
-		if(1 == double_check_before_quitting){
-			USER_RESET_FLAG = 1;
-		}
-		else{
-			double_check_before_quitting = 1;
-		}
+	else{
+		double_check_before_quitting = 1; // flag for decimal view that user pressed C
+		return HSM_TABLE_NEXT;
 	}
-	else{ /* Do Nothing */ }
 }
 
+/* Parent and hooks of every state, indexed by @ref numbering_states_t */
+static const hsm_state_info_t Numbering_States[numbering_states_max] = {
+		[Decimal_Mode]			= {Numbering_Common, Enter_View, NULL},
+		[Octal_Mode]			= {Numbering_Common, Enter_View, NULL},
+		[Binary_Mode]			= {Numbering_Common, Enter_View, NULL},
+		[Hexadecimal_Mode]		= {Numbering_Common, Enter_View, NULL},
+		[Numbering_Shift_Layer]	= {HSM_NO_STATE, Enter_Shift_Layer, NULL},
+		[Numbering_Common]		= {HSM_NO_STATE, NULL, NULL}
+};
+
+/* Transitions, unlisted events are left to the parent state */
+#define NUMBERING_ALL_KEYS(_ACTION_)	[EV_KEY_0] = {_ACTION_, HSM_TABLE_NEXT}, [EV_KEY_1] = {_ACTION_, HSM_TABLE_NEXT}, \
+										[EV_KEY_2] = {_ACTION_, HSM_TABLE_NEXT}, [EV_KEY_3] = {_ACTION_, HSM_TABLE_NEXT}, \
+										[EV_KEY_4] = {_ACTION_, HSM_TABLE_NEXT}, [EV_KEY_5] = {_ACTION_, HSM_TABLE_NEXT}, \
+										[EV_KEY_6] = {_ACTION_, HSM_TABLE_NEXT}, [EV_KEY_7] = {_ACTION_, HSM_TABLE_NEXT}, \
+										[EV_KEY_8] = {_ACTION_, HSM_TABLE_NEXT}, [EV_KEY_9] = {_ACTION_, HSM_TABLE_NEXT}, \
+										[EV_KEY_PLUS] = {_ACTION_, HSM_TABLE_NEXT}, [EV_KEY_MINUS] = {_ACTION_, HSM_TABLE_NEXT}, \
+										[EV_KEY_MULTIPLY] = {_ACTION_, HSM_TABLE_NEXT}, [EV_KEY_DIVIDE] = {_ACTION_, HSM_TABLE_NEXT}, \
+										[EV_KEY_EQUAL] = {_ACTION_, HSM_TABLE_NEXT}, [EV_KEY_CLEAR] = {_ACTION_, HSM_TABLE_NEXT}
+
+static const hsm_transition_t Numbering_Table[numbering_states_max][hsm_key_events_max] = {
+		[Decimal_Mode] = {
+				[EV_KEY_DIVIDE] = {Act_Next_Secondary, HSM_INTERNAL}
+		},
+		[Octal_Mode] = {
+				[EV_KEY_MULTIPLY] = {Act_Next_Secondary, HSM_INTERNAL}
+		},
+		[Binary_Mode] = {
+				[EV_KEY_4] = {Act_Scroll, HSM_INTERNAL},
+				[EV_KEY_6] = {Act_Scroll, HSM_INTERNAL},
+				[EV_KEY_MINUS] = {Act_Next_Secondary, HSM_INTERNAL}
+		},
+		[Hexadecimal_Mode] = {
+				[EV_KEY_PLUS] = {Act_Next_Secondary, HSM_INTERNAL}
+		},
+		[Numbering_Shift_Layer] = {
+				/* Every key returns to the view the action selects */
+				NUMBERING_ALL_KEYS(Act_Shift_Key)
+		},
+		[Numbering_Common] = {
+				[EV_KEY_0] = {Act_Digit, HSM_INTERNAL}, [EV_KEY_1] = {Act_Digit, HSM_INTERNAL},
+				[EV_KEY_2] = {Act_Digit, HSM_INTERNAL}, [EV_KEY_3] = {Act_Digit, HSM_INTERNAL},
+				[EV_KEY_4] = {Act_Digit, HSM_INTERNAL}, [EV_KEY_5] = {Act_Digit, HSM_INTERNAL},
+				[EV_KEY_6] = {Act_Digit, HSM_INTERNAL}, [EV_KEY_7] = {Act_Digit, HSM_INTERNAL},
+				[EV_KEY_8] = {Act_Digit, HSM_INTERNAL}, [EV_KEY_9] = {Act_Digit, HSM_INTERNAL},
+				[EV_KEY_PLUS] = {HSM_Transit, Hexadecimal_Mode},
+				[EV_KEY_MINUS] = {HSM_Transit, Binary_Mode},
+				[EV_KEY_MULTIPLY] = {HSM_Transit, Octal_Mode},
+				[EV_KEY_DIVIDE] = {HSM_Transit, Decimal_Mode},
+				[EV_KEY_EQUAL] = {HSM_Transit, Numbering_Shift_Layer},
+				[EV_KEY_CLEAR] = {Act_Clear, Decimal_Mode}
+		}
+};
+
+static const hsm_machine_t Numbering_Machine = {
+		&Numbering_Table[0][0], Numbering_States, numbering_states_max, hsm_key_events_max, Decimal_Mode, TRACE_SRC_NUMBERING
+};
+
 /**=============================================
-  * @Fn				- ST_Octal_Mode
-  * @brief 			- In this state, the number on the screen is displayed in octal format
+  * @Fn				- ST_Numbering
+  * @brief 			- In this state, the system will pass the pressed key to the numbering state machine
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- The first call takes the working set from the arena and enters decimal view,
+  * 				  any key but 'C' cancels a pending exit
   */
-STATE_DEF(Octal_Mode){
-	/* State Name */
-	if(Octal_Mode != numbering_state_id){
-		numbering_state_id = Octal_Mode;
-		LCD_Send_string_Pos((uint8*)"OCTAL", LCD_SECOND_ROW, (LCD_MAX_COL-5));
-		LCD_Set_Cursor(LCD_FIRST_ROW, Octal_Length + 1);
-	}
-
-	/* State Action */
-	pressed_key = keypad_Get_Pressed_Key();
-	if((0 <= pressed_key) && (8 > pressed_key)){
-		/* Validate that user is inputting a 6 digit octal */
-		if(OCTAL_MAX_SIZE > Octal_Length){
-			LCD_Send_Char(pressed_key+48);
-			Octal_Number[Octal_Length] = pressed_key;
-			Octal_Length++;
+STATE_DEF(Numbering){
+	if(NULL == Num){
+		Num = Arena_Alloc(sizeof(numbering_work_t));
+		Num->view = Decimal_Mode;
+		Num->word = NUMBERING_WORD_16;
+		Num->secondary = 16;
+		Num->entry_offset = VIEW_END;
+		Num->indicator = "";
+	}
+	else{ /* Do Nothing */ }
+	HSM_Start(&Numbering_HSM);
+	pressed_key = Events_Key();
+	pressed_event = HSM_Key_Event(pressed_key);
+	if(hsm_key_events_max != pressed_event){
+		if(EV_KEY_CLEAR != pressed_event){
+			double_check_before_quitting = 0; // Clear flag
 		}
 		else{ /* Do Nothing */ }
-	}
-	else if('/' == pressed_key){
-		/* Go to decimal mode */
-		OctToDec();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		Print_Array_LCD(Decimal_Number, Decimal_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Decimal_Mode);
-	}
-	else if('-' == pressed_key){
-		/* Go to binary mode */
-		OctToDec();
-		DecToBin();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		Print_Array_LCD(Binary_Number, Binary_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Binary_Mode);
-	}
-	else if('+' == pressed_key){
-		/* Go to hexadecimal mode */
-		OctToDec();
-		DecToHex();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		LCD_Send_String((uint8*)"0x");
-		Print_Array_LCD(Hexa_Number, Hexadecimal_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Hexadecimal_Mode);
-	}
-	else if('C' == pressed_key){
-		/* Clear screen, or exit if pressed twice in a row */
-		double_check_before_quitting = 1; // flag for decimal state that user pressed C
-		memset(Octal_Number, 0, OCTAL_MAX_SIZE);
-		Octal_Length = 0;
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		pf_Numbering_State_Handler = STATE_CALL(Decimal_Mode);
+		HSM_Dispatch(&Numbering_HSM, pressed_event);
 	}
 	else{ /* Do Nothing */ }
 }
 
 /**=============================================
-  * @Fn				- ST_Binary_Mode
-  * @brief 			- In this state, the number on the screen is displayed in binary format
+  * @Fn				- Numbering_Get_State
+  * @brief 			- Returns the state of the numbering machine
   * @param [in] 	- None
   * @param [out] 	- None
+  * @retval 		- Current state, HSM_NO_STATE if the mode is not running
+  * Note			- Kept over a warm restart together with the arena
+  */
+hsm_state_t Numbering_Get_State(void){
+	return (NULL == Num) ? HSM_NO_STATE : Numbering_HSM.current;
+}
+
+/**=============================================
+  * @Fn				- Numbering_Resume
+  * @brief 			- Runs the mode again in the state it had before a warm restart
+  * @param [in] 	- state: State returned by Numbering_Get_State before the restart
+  * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- The working set is taken back from the arena as it was, the LCD must be restored by the caller
   */
-STATE_DEF(Binary_Mode){
-	/* State Name */
-	if(Binary_Mode != numbering_state_id){
-		numbering_state_id = Binary_Mode;
-		LCD_Send_string_Pos((uint8*)"BINARY", LCD_SECOND_ROW, (LCD_MAX_COL-6));
-		LCD_Set_Cursor(LCD_FIRST_ROW, Binary_Length + 1);
-	}
-
-	/* State Action */
-	pressed_key = keypad_Get_Pressed_Key();
-	if((0 <= pressed_key) && (2 > pressed_key)){
-		/* Validate that user is inputting a 16 digit binary */
-		if(BINARY_MAX_SIZE > Binary_Length){
-			LCD_Send_Char(pressed_key+48);
-			Binary_Number[Binary_Length] = pressed_key;
-			Binary_Length++;
-		}
-		else{ /* Do Nothing */ }
-	}
-	else if('x' == pressed_key){
-		/* Go to octal mode */
-		BinToDec();
-		DecToOct();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		Print_Array_LCD(Octal_Number, Octal_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Octal_Mode);
-	}
-	else if('/' == pressed_key){
-		/* Go to decimal mode */
-		BinToDec();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		Print_Array_LCD(Decimal_Number, Decimal_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Decimal_Mode);
-	}
-	else if('+' == pressed_key){
-		/* Go to hexadecimal mode */
-		BinToDec();
-		DecToHex();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		LCD_Send_String((uint8*)"0x");
-		Print_Array_LCD(Hexa_Number, Hexadecimal_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Hexadecimal_Mode);
-	}
-	else if('C' == pressed_key){
-		/* Clear screen, or exit if pressed twice in a row */
-		double_check_before_quitting = 1; // flag for decimal state that user pressed C
-		memset(Binary_Number, 0, BINARY_MAX_SIZE);
-		Binary_Length = 0;
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		pf_Numbering_State_Handler = STATE_CALL(Decimal_Mode);
-	}
-	else{ /* Do Nothing */ }
+void Numbering_Resume(hsm_state_t state){
+	Num = Arena_Resume(sizeof(numbering_work_t));
+	HSM_Resume(&Numbering_HSM, state);
 }
 
 /**=============================================
-  * @Fn				- ST_Hexadecimal_Mode
-  * @brief 			- In this state, the number on the screen is displayed in hexadecimal format
+  * @Fn				- Numbering_Stop
+  * @brief 			- Leaves the mode as if 'C' was pressed twice, the next call starts it again in decimal view
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- The LCD and the arena are left to the caller
   */
-STATE_DEF(Hexadecimal_Mode){
-	/* State Name */
-	if(Hexadecimal_Mode != numbering_state_id){
-		numbering_state_id = Hexadecimal_Mode;
-		LCD_Send_string_Pos((uint8*)"HEXA", LCD_SECOND_ROW, (LCD_MAX_COL-4));
-		LCD_Set_Cursor(LCD_FIRST_ROW, Hexadecimal_Length + 3);
-	}
-
-	/* State Action */
-	pressed_key = keypad_Get_Pressed_Key();
-	if((0 <= pressed_key) && (10 > pressed_key)){
-		/* Validate that user is inputting a 4 digit hexadecimal */
-		if(HEXA_MAX_SIZE > Hexadecimal_Length){
-			LCD_Send_Char(pressed_key+48);
-			Hexa_Number[Hexadecimal_Length] = pressed_key;
-			Hexadecimal_Length++;
-		}
-		else{ /* Do Nothing */ }
-	}
-	else if('x' == pressed_key){
-		/* Go to octal mode */
-		HexToDec();
-		DecToOct();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		Print_Array_LCD(Octal_Number, Octal_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Octal_Mode);
-	}
-	else if('-' == pressed_key){
-		/* Go to binary mode */
-		HexToDec();
-		DecToBin();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		Print_Array_LCD(Binary_Number, Binary_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Binary_Mode);
-	}
-	else if('/' == pressed_key){
-		/* Go to decimal mode */
-		HexToDec();
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		Print_Array_LCD(Decimal_Number, Decimal_Length);
-		pf_Numbering_State_Handler = STATE_CALL(Decimal_Mode);
-	}
-	else if('C' == pressed_key){
-		/* Clear screen, or exit if pressed twice in a row */
-		double_check_before_quitting = 1; // flag for decimal state that user pressed C
-		memset(Hexa_Number, 0, HEXA_MAX_SIZE);
-		Hexadecimal_Length = 0;
-		LCD_Send_Command(LCD_CLEAR_DISPLAY);
-		pf_Numbering_State_Handler = STATE_CALL(Decimal_Mode);
+void Numbering_Stop(void){
+	Num = NULL;
+	double_check_before_quitting = 0;
+	if(HSM_NO_STATE != Numbering_HSM.current){
+		HSM_Resume(&Numbering_HSM, HSM_NO_STATE);
 	}
 	else{ /* Do Nothing */ }
 }
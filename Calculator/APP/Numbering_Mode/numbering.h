@@ -15,6 +15,9 @@
 #include "lcd_driver.h"
 #include "keypad_driver.h"
 #include "states.h"
+#include "arena.h"
+#include "events.h"
+#include "conversion.h"
 #include <string.h>
 
 //----------------------------------------------
@@ -25,9 +28,37 @@ typedef enum{
 	Octal_Mode,
 	Binary_Mode,
 	Hexadecimal_Mode,
+	Numbering_Shift_Layer,	// Next key selects a shifted function of the last view
+	Numbering_Common,		// Parent of the views, handles digits, view keys, '=' and 'C'
 	numbering_states_max
 }numbering_states_t;
 
+#define numbering_views_max		Numbering_Shift_Layer	// Views are the states before the shift layer
+
+typedef enum{
+	NUMBERING_WORD_8,
+	NUMBERING_WORD_16,
+	NUMBERING_WORD_32,
+	NUMBERING_WORD_64,
+	numbering_words_max
+}numbering_word_t;
+
+typedef enum{
+	NUMBERING_OP_NONE,
+	NUMBERING_OP_AND,
+	NUMBERING_OP_OR,
+	NUMBERING_OP_XOR,
+	NUMBERING_OP_SHL,		// Logical shift left
+	NUMBERING_OP_SHR,		// Logical shift right
+	NUMBERING_OP_SAR,		// Arithmetic shift right, used instead of SHR while signed display is on
+	NUMBERING_OP_ROL,		// Rotate left inside the word size
+	NUMBERING_OP_ROR,		// Rotate right inside the word size
+	NUMBERING_OP_SET,		// Set bit number n
+	NUMBERING_OP_CLEAR,		// Clear bit number n
+	NUMBERING_OP_TEST,		// Show bit number n without changing the value
+	numbering_operations_max
+}numbering_operation_t;
+
 extern void (*pf_Numbering_State_Handler)(void);
 extern uint8 USER_RESET_FLAG; // if 1, then user wants to restart the app
 
@@ -38,43 +69,46 @@ extern uint8 USER_RESET_FLAG; // if 1, then user wants to restart the app
  */
 
 /**=============================================
-  * @Fn				- ST_Decimal_Mode
-  * @brief 			- In this state, the number on the screen is displayed in decimal format
+  * @Fn				- ST_Numbering
+  * @brief 			- In this state, the number on the screen is displayed in the selected view
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- Initial state
+  * Note			- Views and transitions are in a table, @ref numbering_states_t, decimal view is the initial view
+  * 				- '/': decimal, 'x': octal, '-': binary, '+': hexadecimal, the key of the current view shows the next radix (2...36) on the second row
+  * 				- '=': shift layer for bitwise operations, signed display and word size (8/16/32/64 bits)
+  * 				- Binary view shows two binary digits per character, '4'/'6': scroll one character (two digits) left/right
   */
-STATE_DEF(Decimal_Mode);
+STATE_DEF(Numbering);
 
 /**=============================================
-  * @Fn				- ST_Octal_Mode
-  * @brief 			- In this state, the number on the screen is displayed in octal format
+  * @Fn				- Numbering_Get_State
+  * @brief 			- Returns the state of the numbering machine
   * @param [in] 	- None
   * @param [out] 	- None
-  * @retval 		- None
-  * Note			- None
+  * @retval 		- Current state, HSM_NO_STATE if the mode is not running
+  * Note			- Kept over a warm restart together with the arena
   */
-STATE_DEF(Octal_Mode);
+hsm_state_t Numbering_Get_State(void);
 
 /**=============================================
-  * @Fn				- ST_Binary_Mode
-  * @brief 			- In this state, the number on the screen is displayed in binary format
-  * @param [in] 	- None
+  * @Fn				- Numbering_Resume
+  * @brief 			- Runs the mode again in the state it had before a warm restart
+  * @param [in] 	- state: State returned by Numbering_Get_State before the restart
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- The working set is taken back from the arena as it was, the LCD must be restored by the caller
   */
-STATE_DEF(Binary_Mode);
+void Numbering_Resume(hsm_state_t state);
 
 /**=============================================
-  * @Fn				- ST_Hexadecimal_Mode
-  * @brief 			- In this state, the number on the screen is displayed in hexadecimal format
+  * @Fn				- Numbering_Stop
+  * @brief 			- Leaves the mode as if 'C' was pressed twice, the next call starts it again in decimal view
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- The LCD and the arena are left to the caller
   */
-STATE_DEF(Hexadecimal_Mode);
+void Numbering_Stop(void);
 
 #endif /* NUMBERING_MODE_NUMBERING_H_ */
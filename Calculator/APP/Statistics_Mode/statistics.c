@@ -0,0 +1,392 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : statistics.c 			                           	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "statistics.h"
+
+#define STAT_VALUE_COL		5  // Column where the statistic value starts on the second row
+#define STAT_VALUE_WIDTH	12 // Columns left for the statistic value (5...16)
+#define STAT_STRING_SIZE	21 // Enough for a 64-bit number, a decimal point, 2 decimals and null
+
+void (*pfStatistics_State_Handler)(void) = STATE_CALL(Sample_Entry);
+static statistics_states_t statistics_state_id = statistics_states_max;
+static stat_accumulator_t Stat_Accumulator;		// Running statistics of all entered samples
+static statistics_view_t Stat_View;				// Statistic currently shown on the second row
+static uint32 Sample_Value;						// Sample being typed by the user
+static uint8 Sample_Length;						// Number of digits typed in "Sample_Value"
+static uint8 pressed_key;
+static uint8 double_check_before_quitting;
+static uint8 Stat_String[STAT_STRING_SIZE];
+
+/* Labels of the statistics, indexed by @ref statistics_view_t */
+static const char *const Stat_View_Labels[STAT_VIEW_MAX_NUM] = {
+		"N:", "SUM:", "AVG:", "VAR:", "SD:", "MIN:", "MAX:"
+};
+
+/**=============================================
+  * @Fn				- Stat_Reset
+  * @brief 			- Clears all running statistics of an accumulator
+  * @param [out] 	- acc: Pointer to the accumulator to be cleared
+  * @retval 		- None
+  * Note			- None
+  */
+void Stat_Reset(stat_accumulator_t *acc){
+	acc->count = 0;
+	acc->sum = 0;
+	acc->min = 0;
+	acc->max = 0;
+	acc->mean_q = 0;
+	acc->variance_q = 0;
+	acc->m2_int = 0;
+	acc->m2_frac = 0;
+}
+
+/**=============================================
+  * @Fn				- Stat_Div_Round
+  * @brief 			- Divides a fixed-point number by the sample count, rounded to the nearest
+  * @param [in] 	- value: Dividend
+  * @param [in] 	- count: Divisor, more than 0
+  * @retval 		- Quotient
+  * Note			- Truncating would bias every update towards 0, over a long run of samples on the same side
+  * 				  of the mean the error adds up to whole units
+  */
+static sint64 Stat_Div_Round(sint64 value, uint32 count){
+	sint64 half = (sint64)(count / 2);
+	return (0 > value) ? ((value - half) / (sint64)count) : ((value + half) / (sint64)count);
+}
+
+/**=============================================
+  * @Fn				- Stat_Mul_Q16
+  * @brief 			- Multiplies two Q.16 numbers
+  * @param [in] 	- a: First factor, |a| < 2^36
+  * @param [in] 	- b: Second factor, |b| < 2^36
+  * @retval 		- Product in Q.16, rounded down
+  * Note			- a is split at the binary point so no partial product passes 2^56
+  */
+static sint64 Stat_Mul_Q16(sint64 a, sint64 b){
+	return ((a >> STAT_FRAC_BITS) * b) + (((a & ((1LL << STAT_FRAC_BITS) - 1)) * b) >> STAT_FRAC_BITS);
+}
+
+/**=============================================
+  * @Fn				- Stat_Add_Sample
+  * @brief 			- Updates count, sum, min, max, mean and variance with one new sample
+  * @param 		 	- acc: Pointer to the accumulator to be updated
+  * @param [in] 	- sample: New sample value (0...999999)
+  * @retval 		- STAT_OK, or STAT_FULL if STAT_COUNT_MAX samples were already added @ref STAT_ADD_RETURN_define
+  * Note			- Uses Welford's update, so each sample costs O(1) time and no sample is stored
+  */
+uint8 Stat_Add_Sample(stat_accumulator_t *acc, uint32 sample){
+	sint64 sample_q = ((sint64)sample << STAT_FRAC_BITS);
+	sint64 delta, delta_new;
+
+	/* Past STAT_COUNT_MAX the Q.16 sum and M2 could overflow, checked in statistics.h */
+	if(STAT_COUNT_MAX <= acc->count){
+		return STAT_FULL;
+	}
+	else{ /* Do Nothing */ }
+
+	acc->count++;
+	acc->sum += sample;
+
+	if((1 == acc->count) || (sample < acc->min)){
+		acc->min = sample;
+	}
+	else{ /* Do Nothing */ }
+	if((1 == acc->count) || (sample > acc->max)){
+		acc->max = sample;
+	}
+	else{ /* Do Nothing */ }
+
+	/* mean(n) = sum(n) / n, the sum is exact so the mean is never more than half a unit of Q.16 off,
+	 * the update mean(n-1) + (x - mean(n-1)) / n would add up the rounding of every sample */
+	delta = sample_q - acc->mean_q;
+	acc->mean_q = Stat_Div_Round((sint64)(acc->sum << STAT_FRAC_BITS), acc->count);
+	delta_new = sample_q - acc->mean_q;
+
+	/* M2(n) = M2(n-1) + (x - mean(n-1)) * (x - mean(n)), var(n) = M2(n) / n
+	 * M2 takes up to 74 bits in Q.16, so it is kept as an integer part and a fraction. Dividing M2 instead of
+	 * updating var(n-1) by (... - var(n-1)) / n keeps the rounding of every sample out of the variance */
+	delta = Stat_Mul_Q16(delta, delta_new);
+	acc->m2_frac += (uint32)(delta & ((1LL << STAT_FRAC_BITS) - 1));
+	acc->m2_int += (delta >> STAT_FRAC_BITS) + (sint64)(acc->m2_frac >> STAT_FRAC_BITS);
+	acc->m2_frac &= ((1UL << STAT_FRAC_BITS) - 1);
+	if(0 > acc->m2_int){
+		/* Rounded means may take M2 a little below 0 while all samples are equal */
+		acc->m2_int = 0;
+		acc->m2_frac = 0;
+	}
+	else{ /* Do Nothing */ }
+	acc->variance_q = ((acc->m2_int / acc->count) << STAT_FRAC_BITS) +
+			Stat_Div_Round(((acc->m2_int % acc->count) << STAT_FRAC_BITS) + acc->m2_frac, acc->count);
+	return STAT_OK;
+}
+
+/**=============================================
+  * @Fn				- Stat_Get_Std_Dev
+  * @brief 			- Calculates the population standard deviation of the accumulated samples
+  * @param [in] 	- acc: Pointer to the accumulator
+  * @retval 		- Standard deviation in Q.8 fixed-point
+  * Note			- Square root of the Q.16 variance, done with an integer square root rounded to the nearest
+  */
+uint32 Stat_Get_Std_Dev(const stat_accumulator_t *acc){
+	uint64 value = (uint64)acc->variance_q;
+	uint64 root = 0;
+	uint64 bit = (1ULL << 62);
+
+	/* Find the highest power of 4 that is less than or equal to the value */
+	while(bit > value){
+		bit >>= 2;
+	}
+
+	/* Calculate the square root digit by digit */
+	while(0 != bit){
+		if(value >= (root + bit)){
+			value -= (root + bit);
+			root = (root >> 1) + bit;
+		}
+		else{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	/* value is now the remainder of root^2, past root the square root is nearer to root + 1 */
+	if(value > root){
+		root++;
+	}
+	else{ /* Do Nothing */ }
+	return (uint32)root;
+}
+
+/**=============================================
+  * @Fn				- U64_To_String
+  * @brief 			- This function will save the decimal digits of a number in a string
+  * @param [in] 	- value: Number to be converted
+  * @param [out] 	- string: Pointer to the destination string
+  * @retval 		- Length of the string
+  * Note			- The string is null terminated
+  */
+static uint8 U64_To_String(uint64 value, uint8 *string){
+	uint8 reversed[STAT_STRING_SIZE];
+	uint8 length = 0, index;
+	do{
+		reversed[length] = (value % 10) + '0';
+		value /= 10;
+		length++;
+	}while(0 != value);
+	for(index = 0; index < length; index++){
+		string[index] = reversed[length - index - 1];
+	}
+	string[length] = '\0';
+	return length;
+}
+
+/**=============================================
+  * @Fn				- Fixed_To_String
+  * @brief 			- This function will save a fixed-point number with 2 decimals in a string
+  * @param [in] 	- value_q: Fixed-point number to be converted
+  * @param [in] 	- frac_bits: Number of fraction bits in "value_q"
+  * @param [out] 	- string: Pointer to the destination string
+  * @retval 		- None
+  * Note			- Decimals are dropped if the number does not fit in @ref STAT_VALUE_WIDTH columns
+  */
+static void Fixed_To_String(uint64 value_q, uint8 frac_bits, uint8 *string){
+	uint64 integer = (value_q >> frac_bits);
+	uint32 fraction = (uint32)((((value_q & ((1ULL << frac_bits) - 1)) * 100) + (1ULL << (frac_bits - 1))) >> frac_bits);
+	uint8 length;
+
+	/* Rounding to 2 decimals may carry into the integer part */
+	if(100 <= fraction){
+		fraction -= 100;
+		integer++;
+	}
+	else{ /* Do Nothing */ }
+
+	length = U64_To_String(integer, string);
+	if((length + 3) <= STAT_VALUE_WIDTH){
+		string[length] = '.';
+		string[length + 1] = (fraction / 10) + '0';
+		string[length + 2] = (fraction % 10) + '0';
+		string[length + 3] = '\0';
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Show_Statistic
+  * @brief 			- This function will print the selected statistic on the second row of the LCD
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Call Show_Entry_Prompt after it to return the cursor to the first row
+  */
+static void Show_Statistic(void){
+	switch(Stat_View){
+	case STAT_VIEW_COUNT:
+		U64_To_String(Stat_Accumulator.count, Stat_String);
+		break;
+	case STAT_VIEW_SUM:
+		U64_To_String(Stat_Accumulator.sum, Stat_String);
+		break;
+	case STAT_VIEW_MEAN:
+		Fixed_To_String((uint64)Stat_Accumulator.mean_q, STAT_FRAC_BITS, Stat_String);
+		break;
+	case STAT_VIEW_VARIANCE:
+		Fixed_To_String((uint64)Stat_Accumulator.variance_q, STAT_FRAC_BITS, Stat_String);
+		break;
+	case STAT_VIEW_STD_DEV:
+		Fixed_To_String(Stat_Get_Std_Dev(&Stat_Accumulator), (STAT_FRAC_BITS/2), Stat_String);
+		break;
+	case STAT_VIEW_MIN:
+		U64_To_String(Stat_Accumulator.min, Stat_String);
+		break;
+	case STAT_VIEW_MAX:
+		U64_To_String(Stat_Accumulator.max, Stat_String);
+		break;
+	default:
+		Stat_String[0] = '\0';
+		break;
+	}
+	if(STAT_VALUE_WIDTH < strlen((char*)Stat_String)){
+		strcpy((char*)Stat_String, "OVF");
+	}
+	else{ /* Do Nothing */ }
+	LCD_Send_string_Pos((uint8*)"                ", LCD_SECOND_ROW, 1);
+	LCD_Send_string_Pos((uint8*)Stat_View_Labels[Stat_View], LCD_SECOND_ROW, 1);
+	LCD_Send_string_Pos(Stat_String, LCD_SECOND_ROW, STAT_VALUE_COL);
+}
+
+/**=============================================
+  * @Fn				- Show_Entry_Prompt
+  * @brief 			- This function will print the prompt of the next sample on the first row of the LCD
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The prompt is "#n:" where n is the number of the next sample, followed by the typed sample if any,
+  * 				  or "#FULL" once STAT_COUNT_MAX samples were added
+  */
+static void Show_Entry_Prompt(void){
+	LCD_Send_string_Pos((uint8*)"                ", LCD_FIRST_ROW, 1);
+	LCD_Send_Char_Pos('#', LCD_FIRST_ROW, 1);
+	if(STAT_COUNT_MAX <= Stat_Accumulator.count){
+		LCD_Send_String((uint8*)"FULL");
+		return;
+	}
+	else{ /* Do Nothing */ }
+	U64_To_String((uint64)Stat_Accumulator.count + 1, Stat_String);
+	LCD_Send_String(Stat_String);
+	LCD_Send_Char(':');
+	if(0 != Sample_Length){
+		U64_To_String(Sample_Value, Stat_String);
+		LCD_Send_String(Stat_String);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- ST_Sample_Entry
+  * @brief 			- In this state, the user enters samples and browses the running statistics
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in Sample_Entry state
+  * 				- Numbers: type a sample, '=': add the sample, '+'/'-': next/previous statistic
+  * 				- 'C': clear the typed sample, or clear all statistics if nothing is typed, or exit if pressed twice in a row
+  * 				- Once STAT_COUNT_MAX samples are added, numbers are ignored until 'C' clears the statistics
+  */
+STATE_DEF(Sample_Entry){
+	/* State Name */
+	if(Sample_Entry != statistics_state_id){
+		statistics_state_id = Sample_Entry;
+		TRACE_STATE(TRACE_SRC_STATISTICS, Sample_Entry);
+		Show_Statistic();
+		Show_Entry_Prompt();
+	}
+
+	/* State Action */
+	pressed_key = Events_Key();
+	if((0 <= pressed_key) && (10 > pressed_key)){
+		double_check_before_quitting = 0; // Clear flag
+		/* Validate that user is inputting a 6 digit sample, and that one more sample is taken */
+		if((STAT_SAMPLE_MAX_DIGITS > Sample_Length) && (STAT_COUNT_MAX > Stat_Accumulator.count)){
+			LCD_Send_Char(pressed_key+48);
+			Sample_Value = (Sample_Value * 10) + pressed_key;
+			Sample_Length++;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if('=' == pressed_key){
+		double_check_before_quitting = 0; // Clear flag
+		/* Add the typed sample to the running statistics */
+		if(0 != Sample_Length){
+			(void)Stat_Add_Sample(&Stat_Accumulator, Sample_Value); // Digits are refused once it is full
+			Sample_Value = 0;
+			Sample_Length = 0;
+			Show_Statistic();
+			Show_Entry_Prompt();
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(('+' == pressed_key) || ('-' == pressed_key)){
+		double_check_before_quitting = 0; // Clear flag
+		/* Show next or previous statistic */
+		if('+' == pressed_key){
+			Stat_View = (STAT_VIEW_MAX == Stat_View) ? STAT_VIEW_COUNT : (Stat_View + 1);
+		}
+		else{
+			Stat_View = (STAT_VIEW_COUNT == Stat_View) ? STAT_VIEW_MAX : (Stat_View - 1);
+		}
+		Show_Statistic();
+		Show_Entry_Prompt();
+	}
+	else if('C' == pressed_key){
+		if(0 != Sample_Length){
+			/* Clear typed sample only */
+			Sample_Value = 0;
+			Sample_Length = 0;
+			Show_Entry_Prompt();
+		}
+		else if(1 == double_check_before_quitting){
+			/* Exit if pressed twice in a row */
+			double_check_before_quitting = 0;
+			statistics_state_id = statistics_states_max;
+			TRACE_STATE(TRACE_SRC_STATISTICS, HSM_NO_STATE);
+			Stat_Reset(&Stat_Accumulator);
+			Stat_View = STAT_VIEW_COUNT;
+			USER_RESET_FLAG = 1;
+		}
+		else{
+			/* Clear all statistics */
+			double_check_before_quitting = 1;
+			Stat_Reset(&Stat_Accumulator);
+			Show_Statistic();
+			Show_Entry_Prompt();
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Statistics_Stop
+  * @brief 			- Leaves the mode as if 'C' was pressed twice, the samples are cleared
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The LCD is left to the caller, the next call of Sample_Entry shows the mode again
+  */
+void Statistics_Stop(void){
+	if(statistics_states_max != statistics_state_id){
+		statistics_state_id = statistics_states_max;
+		TRACE_STATE(TRACE_SRC_STATISTICS, HSM_NO_STATE);
+	}
+	else{ /* Do Nothing */ }
+	double_check_before_quitting = 0;
+	Stat_Reset(&Stat_Accumulator);
+	Stat_View = STAT_VIEW_COUNT;
+	Sample_Value = 0;
+	Sample_Length = 0;
+	pfStatistics_State_Handler = STATE_CALL(Sample_Entry);
+}
@@ -0,0 +1,130 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : statistics.h 			                           	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef STATISTICS_MODE_STATISTICS_H_
+#define STATISTICS_MODE_STATISTICS_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "lcd_driver.h"
+#include "keypad_driver.h"
+#include "states.h"
+#include "events.h"
+#include <string.h>
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref STAT_FIXED_POINT_define
+#define STAT_FRAC_BITS			16 // Mean and variance are kept in Q.16 fixed-point
+#define STAT_SAMPLE_MAX_DIGITS	6  // Max sample is 999999 (< 2^20) so the Q.16 deltas stay below 2^36 and their product fits in 64 bits
+#define STAT_SAMPLE_MAX			999999ULL
+#define STAT_COUNT_MAX			10000000UL // Samples taken before Stat_Add_Sample refuses more, the prompt shows "#FULL"
+
+// @ref STAT_ADD_RETURN_define
+#define STAT_OK					0x00 // The sample was added
+#define STAT_FULL				0x01 // STAT_COUNT_MAX samples were already added, the accumulator is unchanged
+
+/* The Q.16 sum of Stat_Add_Sample and M2, up to count x (max / 2)^2, must fit in a sint64 at STAT_COUNT_MAX */
+#if (STAT_COUNT_MAX * STAT_SAMPLE_MAX) > (0x7FFFFFFFFFFFFFFFULL >> STAT_FRAC_BITS)
+#error "STAT_COUNT_MAX samples of STAT_SAMPLE_MAX overflow the Q.16 sum of the mean"
+#endif
+#if (STAT_COUNT_MAX * ((STAT_SAMPLE_MAX / 2) + 1) * ((STAT_SAMPLE_MAX / 2) + 1)) > 0x7FFFFFFFFFFFFFFFULL
+#error "STAT_COUNT_MAX samples overflow the integer part of M2"
+#endif
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	Sample_Entry,
+	statistics_states_max
+}statistics_states_t;
+
+typedef enum{
+	STAT_VIEW_COUNT,
+	STAT_VIEW_SUM,
+	STAT_VIEW_MEAN,
+	STAT_VIEW_VARIANCE,
+	STAT_VIEW_STD_DEV,
+	STAT_VIEW_MIN,
+	STAT_VIEW_MAX,
+	STAT_VIEW_MAX_NUM
+}statistics_view_t;
+
+typedef struct{
+	uint32 count;		// Number of samples entered
+	uint64 sum;			// Running sum of all samples
+	uint32 min;			// Smallest sample so far
+	uint32 max;			// Largest sample so far
+	sint64 mean_q;		// Running mean in Q.16 @ref STAT_FIXED_POINT_define
+	sint64 variance_q;	// Running population variance in Q.16 @ref STAT_FIXED_POINT_define
+	sint64 m2_int;		// Sum of the squared deviations from the mean, integer part
+	uint32 m2_frac;		// Sum of the squared deviations from the mean, STAT_FRAC_BITS fraction bits
+}stat_accumulator_t;
+
+extern void (*pfStatistics_State_Handler)(void);
+extern uint8 USER_RESET_FLAG; // if 1, then user wants to restart the app
+
+/*
+ * =============================================
+ * APIs Supported by "statistics"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Stat_Reset
+  * @brief 			- Clears all running statistics of an accumulator
+  * @param [out] 	- acc: Pointer to the accumulator to be cleared
+  * @retval 		- None
+  * Note			- None
+  */
+void Stat_Reset(stat_accumulator_t *acc);
+
+/**=============================================
+  * @Fn				- Stat_Add_Sample
+  * @brief 			- Updates count, sum, min, max, mean and variance with one new sample
+  * @param 		 	- acc: Pointer to the accumulator to be updated
+  * @param [in] 	- sample: New sample value (0...999999)
+  * @retval 		- STAT_OK, or STAT_FULL if STAT_COUNT_MAX samples were already added @ref STAT_ADD_RETURN_define
+  * Note			- Uses Welford's update, so each sample costs O(1) time and no sample is stored
+  */
+uint8 Stat_Add_Sample(stat_accumulator_t *acc, uint32 sample);
+
+/**=============================================
+  * @Fn				- Stat_Get_Std_Dev
+  * @brief 			- Calculates the population standard deviation of the accumulated samples
+  * @param [in] 	- acc: Pointer to the accumulator
+  * @retval 		- Standard deviation in Q.8 fixed-point
+  * Note			- Square root of the Q.16 variance, done with an integer square root rounded to the nearest
+  */
+uint32 Stat_Get_Std_Dev(const stat_accumulator_t *acc);
+
+/**=============================================
+  * @Fn				- ST_Sample_Entry
+  * @brief 			- In this state, the user enters samples and browses the running statistics
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in Sample_Entry state
+  */
+STATE_DEF(Sample_Entry);
+
+/**=============================================
+  * @Fn				- Statistics_Stop
+  * @brief 			- Leaves the mode as if 'C' was pressed twice, the samples are cleared
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The LCD is left to the caller, the next call of Sample_Entry shows the mode again
+  */
+void Statistics_Stop(void);
+
+#endif /* STATISTICS_MODE_STATISTICS_H_ */
@@ -12,21 +12,55 @@
 //----------------------------------------------
 // Section: Includes
 //----------------------------------------------
+#include <stddef.h>
 #include "lcd_driver.h"
 #include "keypad_driver.h"
+#include "flash_driver.h"
+#include "vector_driver.h"
 #include "states.h"
+#include "events.h"
+#include "trace.h"
+#include "memory_usage.h"
+#include "replay.h"
+#include "latency.h"
 #include "calculator.h"
+#include "console.h"
+#include "number_theory.h"
 #include "numbering.h"
+#include "statistics.h"
 
 
 
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#define MAIN_SPLASH_MS			2500		// Time the welcome screen is shown before the modes
+#define MAIN_SETTINGS_PAGE		0x0800FC00UL	// Last flash page, left out of the FLASH region in STM32F103C8TX_FLASH.ld
+#define MAIN_MODE_RECORD_TAG	0xA500U		// High byte of a saved mode record, the low byte is the mode @ref user_selection_t
+#define MAIN_MODE_RECORD_MASK	0xFF00U
+#define MAIN_RETAIN_MAGIC		0x52534D45UL	// Marks the record kept over a warm restart, mixed with the build stamp
+#ifndef MAIN_BUILD_STAMP
+#define MAIN_BUILD_STAMP		__DATE__ " " __TIME__	// Hashed into the retained record, another build starts cold
+#endif
+#define MAIN_RESUME_RESETS		(RCC_CSR_IWDGRSTF | RCC_CSR_WWDGRSTF | RCC_CSR_PORRSTF)	// Resets the running mode survives
+#define MAIN_TICK_PRIORITY		1			// Preemption priority of the system tick, keypad scan and timers
+#define MAIN_UART_PRIORITY		2			// Preemption priority of the UART and its DMA channels
+#define MAIN_DIAGNOSTICS_KEY	'='			// Key of the modes screen that shows the key latency histograms
+
+/* The tick and the UART post events and trace records, the critical sections must mask them */
+#if (MAIN_TICK_PRIORITY < NVIC_CRITICAL_PRIORITY) || (MAIN_UART_PRIORITY < NVIC_CRITICAL_PRIORITY)
+#error "Interrupts posting events must not be above NVIC_CRITICAL_PRIORITY"
+#endif
+
 //----------------------------------------------
 // Section: User type definitions
 //----------------------------------------------
 typedef enum{
 	MAIN_INIT,
 	MAIN_SELECTION,
+	MAIN_MENU,
 	MAIN_RUNNING,
+	MAIN_DIAGNOSTICS,
 	MAIN_STATES_MAX
 }main_states_t;
 
@@ -34,9 +68,34 @@ typedef enum{
 	USER_UNDEFINED,
 	USER_CALCULATOR,
 	USER_NUMBERING,
+	USER_STATISTICS,
+	USER_NUMBER_THEORY,
 	USER_SELCTION_MAX
 }user_selection_t;
 
+typedef struct{
+	uint32 first_key_ms;		// Keypad scanning started, keys pressed from now on are queued
+	uint32 first_screen_ms;		// First screen that takes keys was shown, the last used mode or the modes screen
+	uint32 resume_ms;			// Screen of the running mode was restored after a warm restart, 0 after a cold boot
+}main_boot_time_t;
+
+/* Kept in .noinit and saved after the events that changed it, the arena holding the working set of the mode is checked with it */
+typedef struct{
+	uint32 magic;				// MAIN_RETAIN_MAGIC xor the hash of MAIN_BUILD_STAMP
+	uint8  mode;				// Running mode @ref user_selection_t, USER_UNDEFINED if no mode is running
+	uint8  mode_state;			// State of the calculator or numbering machine, HSM_NO_STATE for the other modes
+	LCD_State_t lcd;			// What the LCD shows
+	uint32 checksum;			// Of the fields above and the arena
+}main_retained_t;
+
+typedef struct{
+	uint32 saves;				// Events after which the record was written
+	uint32 skipped;				// Events that changed neither the machine of the mode nor the LCD
+	uint32 last_cycles;			// CPU cycles the last save took
+	uint32 max_cycles;			// Longest save since reset
+	uint32 reset_flags;			// RCC->CSR at boot, @ref MAIN_RESUME_RESETS
+}main_retain_stats_t;
+
 /*
  * =============================================
  * APIs Supported by "main"
@@ -63,6 +122,38 @@ void clock_init(void);
   */
 void my_delay(int x);
 
+/**=============================================
+  * @Fn				- main_get_boot_time
+  * @brief 			- Reads how long the last boot took
+  * @param [in] 	- None
+  * @param [out] 	- pBoot: Pointer to the boot times
+  * @retval 		- None
+  * Note			- Times are counted from the start of the system tick in MAIN_INIT
+  */
+void main_get_boot_time(main_boot_time_t *pBoot);
+
+/**=============================================
+  * @Fn				- main_get_retain_stats
+  * @brief 			- Reads how often and how long the retained record was saved
+  * @param [in] 	- None
+  * @param [out] 	- pStats: Pointer to the statistics
+  * @retval 		- None
+  * Note			- None
+  */
+void main_get_retain_stats(main_retain_stats_t *pStats);
+
+#if REPLAY_ENABLE == 1
+/**=============================================
+  * @Fn				- main_replay_play
+  * @brief 			- Goes back to the mode and state the recording started from and replays the recording
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- To be called from the main loop, the running mode is left as if 'C' was pressed twice
+  */
+void main_replay_play(void);
+#endif
+
 /**=============================================
   * @Fn				- ST_MAIN_INIT
   * @brief 			- This function initializes clock, peripherals, LCD, and keypad
@@ -70,12 +161,14 @@ void my_delay(int x);
   * @param [out] 	- None
   * @retval 		- None
   * Note			- This function will be called in MAIN_INIT state
+  * 				- The last used mode is started at once, the welcome screen is only shown if there is none
+  * 				- After a warm restart the running mode and its screen are restored instead
   */
 STATE_DEF(MAIN_INIT);
 
 /**=============================================
   * @Fn				- ST_MAIN_SELECTION
-  * @brief 			- This function asks the user to choose between calculator mode and numbering systems mode
+  * @brief 			- This function shows the welcome screen, then asks the user to choose between calculator, numbering systems, statistics and number theory modes
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
@@ -83,9 +176,19 @@ STATE_DEF(MAIN_INIT);
   */
 STATE_DEF(MAIN_SELECTION);
 
+/**=============================================
+  * @Fn				- ST_MAIN_MENU
+  * @brief 			- This function waits for the user to press 1, 2, 3 or 4 to select a mode
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in MAIN_MENU state
+  */
+STATE_DEF(MAIN_MENU);
+
 /**=============================================
   * @Fn				- ST_MAIN_RUNNING
-  * @brief 			- This function will pass control to either calculator mode or numbering system mode
+  * @brief 			- This function will pass control to calculator, numbering system, statistics or number theory mode
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
@@ -93,5 +196,15 @@ STATE_DEF(MAIN_SELECTION);
   */
 STATE_DEF(MAIN_RUNNING);
 
+/**=============================================
+  * @Fn				- ST_MAIN_DIAGNOSTICS
+  * @brief 			- This function shows the key to screen latency histogram of one class of keys at a time
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in MAIN_DIAGNOSTICS state
+  */
+STATE_DEF(MAIN_DIAGNOSTICS);
+
 
 #endif /* APP_H_ */
@@ -13,6 +13,7 @@
 // Section: Includes
 //----------------------------------------------
 #include "gpio_driver.h"
+#include "trace.h"
 
 //----------------------------------------------
 // Section: User Configurations
@@ -34,6 +35,22 @@
 #define COL1		GPIO_PIN_6
 #define COL2		GPIO_PIN_7
 #define COL3		GPIO_PIN_8
+#define KEYPAD_ROWS_MASK	(ROW0 | ROW1 | ROW2 | ROW3)
+#define KEYPAD_COLS_MASK	(COL0 | COL1 | COL2 | COL3)
+
+// @ref Keypad_SCAN_define
+#define KEYPAD_SCAN_PERIOD_MS	10	// Period of keypad_Scan calls, longer than the bounce time of a key
+#define KEYPAD_RELEASE_SCANS	2	// Scans without a pressed key needed before a key is released
+
+/* Drives every row low for one read of the columns, _DOWN_ is 1 if a key is down. Registers only, so the system tick
+ * running from SRAM does not call into flash while the keypad is idle, keypad_Scan finds out which key it is */
+#define KEYPAD_ANY_DOWN(_DOWN_)	do{ \
+									KEYPAD_PORT->BRR = KEYPAD_ROWS_MASK; \
+									GPIO_OUTPUT_WRITTEN(KEYPAD_PORT); \
+									(_DOWN_) = (KEYPAD_COLS_MASK != (KEYPAD_PORT->IDR & KEYPAD_COLS_MASK)) ? 1 : 0; \
+									KEYPAD_PORT->BSRR = KEYPAD_ROWS_MASK; \
+									GPIO_OUTPUT_WRITTEN(KEYPAD_PORT); \
+								}while(0)
 
 /*
  * =============================================
@@ -61,4 +78,14 @@ void keypad_init();
   */
 uint8 keypad_Get_Pressed_Key();
 
+/**=============================================
+  * @Fn				- keypad_Scan
+  * @brief 			- Checks the keypad once without waiting for the key to be released
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Value of a newly pressed key, or F if no key is pressed or the key is still held
+  * Note			- To be called every KEYPAD_SCAN_PERIOD_MS @ref Keypad_SCAN_define, may be called from an interrupt
+  */
+uint8 keypad_Scan(void);
+
 #endif /* INC_KEYPAD_DRIVER_H_ */
@@ -14,6 +14,8 @@
 //----------------------------------------------
 #include "gpio_driver.h"
 #include "systick_driver.h"
+#include "lcd_timing.h"
+#include <string.h>
 
 //----------------------------------------------
 // Section: Macros Configuration References
@@ -43,17 +45,31 @@
 #define LCD_DISPLAY_OFF_CURSOR_OFF                 	(0x08)
 #define LCD_8BIT_MODE_2_LINE           				(0x38)
 #define LCD_4BIT_MODE_2_LINE           				(0x28)
+#define LCD_SET_CGRAM_ADDRESS          				(0x40)
 
 // @ref LCD_ROWS_POS_define
 
 #define LCD_FIRST_ROW								(0x80)
 #define LCD_SECOND_ROW								(0xC0)
 
+// @ref LCD_SIZE_define
+
+#define LCD_DISPLAY_COLS							16	// Columns of the LCD visible at once
+#define LCD_DDRAM_ROWS								2
+#define LCD_DDRAM_ROW_SIZE							40	// Columns of display data RAM behind each row in 2-line mode
+
+// @ref LCD_CGRAM_define
+
+#define LCD_CGRAM_SLOTS								8	// Custom characters held by character generator RAM at once
+#define LCD_GLYPH_ROWS								8	// Rows of a 5x8 custom character, bits 4...0 of every row from left to right
+#define LCD_GLYPH_CODE_BASE							(0x08)	// Character codes 0x08...0x0F show the custom characters, 0x00 would end a string
+
 //----------------------------------------------
 // Section: User Configurations
 //----------------------------------------------
 
 #define LCD_MODE 			LCD_4BIT_MODE // @ref LCD_DATA_MODE_define
+#define LCD_POWER_ON_MS		15	// Time from power on to the first command, counted from MCAL_STK_Tick_Init
 
 
 // @ref LCD_CONFIG_define
@@ -75,6 +91,20 @@
 #define DISPLAY_MODE		LCD_DISPLAY_ON_UNDERLINE_OFF_CURSOR_OFF
 #define ENTRY_MODE			LCD_ENTRY_MODE_INC_SHIFT_OFF
 
+#define LCD_MARQUEE_HOLD_STEPS	3	// Scroll periods a marquee stays at its start and end
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+
+/* What the LCD shows, kept by the application to draw it again after a warm restart */
+typedef struct{
+	uint8 shadow[LCD_DDRAM_ROWS][LCD_DDRAM_ROW_SIZE];	// Display data RAM
+	uint8 glyphs[LCD_CGRAM_SLOTS][LCD_GLYPH_ROWS];		// Pattern of every CGRAM slot, by value so it outlives the firmware image
+	uint8 glyphs_used;									// Bit per CGRAM slot holding a pattern
+	uint8 address;										// Address counter, where the next character goes
+	uint8 shift;										// Columns the display is shifted to the left
+}LCD_State_t;
 
 /*
  * =============================================
@@ -89,6 +119,7 @@
   * @param [out] 	- None
   * @retval 		- None
   * Note			- User must set configurations @ref LCD_CONFIG_define
+  * 				  The system tick must be running, it times the power on wait LCD_POWER_ON_MS
   */
 void LCD_Init();
 
@@ -167,5 +198,116 @@ void LCD_Send_Enable_Signal();
   */
 void LCD_Set_Cursor(uint8 row, uint8 column);
 
+/**=============================================
+  * @Fn				- LCD_Update_String_Pos
+  * @brief 			- Writes only the characters of a string that differ from what the LCD already shows
+  * @param [in] 	- string: pointer to a string of characters to be displayed on LCD
+  * @param [in] 	- row: Selects the row number of the displayed character @ref LCD_ROWS_POS_define
+  * @param [in] 	- column: Selects the column number of the first character (1...40)
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Compares against a copy of display data RAM, so the cursor is only moved over changed cells
+  * 				  Characters past the 40th column are ignored
+  */
+void LCD_Update_String_Pos(uint8 *string, uint8 row, uint8 column);
+
+/**=============================================
+  * @Fn				- LCD_Create_Char
+  * @brief 			- Returns the character code of a custom character, uploading it to CGRAM if needed
+  * @param [in] 	- pPattern: LCD_GLYPH_ROWS rows of the character @ref LCD_CGRAM_define
+  * @param [out] 	- None
+  * @retval 		- Character code to be written to display data RAM (LCD_GLYPH_CODE_BASE...LCD_GLYPH_CODE_BASE + 7)
+  * Note			- Characters are cached by their rows, so the pattern may be built on the stack
+  * 				  When all slots are taken, the least recently used character is replaced, and cells still
+  * 				  showing it change to the new one, so a screen must not use more than LCD_CGRAM_SLOTS characters
+  */
+uint8 LCD_Create_Char(const uint8 *pPattern);
+
+/**=============================================
+  * @Fn				- LCD_Marquee_Start
+  * @brief 			- Writes a row once and scrolls it with the display shift if it is wider than the LCD
+  * @param [in] 	- string: pointer to a string of characters to be displayed on LCD
+  * @param [in] 	- row: Selects the row number of the displayed string @ref LCD_ROWS_POS_define
+  * @param [in] 	- period_ms: Milliseconds between two scroll steps
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Characters past LCD_DDRAM_ROW_SIZE are ignored, the rest of the row is filled with spaces
+  * 				  The display shift moves both rows, so the other row scrolls together with the marquee
+  * 				  Needs the system tick, @ref MCAL_STK_Tick_Init
+  */
+void LCD_Marquee_Start(uint8 *string, uint8 row, uint32 period_ms);
+
+/**=============================================
+  * @Fn				- LCD_Marquee_Update
+  * @brief 			- Scrolls a running marquee by one column when its period has passed
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- To be called on timer events with the marquee period, a step costs one command instead of rewriting the row
+  * 				  After the end of the row is shown, the marquee returns to its start with one command
+  */
+void LCD_Marquee_Update(void);
+
+/**=============================================
+  * @Fn				- LCD_Marquee_Stop
+  * @brief 			- Stops a running marquee and shows the start of the row again
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Clearing the display also stops the marquee
+  */
+void LCD_Marquee_Stop(void);
+
+/**=============================================
+  * @Fn				- LCD_Get_State
+  * @brief 			- Copies what the LCD shows
+  * @param [in] 	- None
+  * @param [out] 	- pState: Pointer to the copy
+  * @retval 		- None
+  * Note			- Taken from the shadow display data RAM, the LCD is not read
+  */
+void LCD_Get_State(LCD_State_t *pState);
+
+/**=============================================
+  * @Fn				- LCD_Restore_State
+  * @brief 			- Draws a copy taken by LCD_Get_State again
+  * @param [in] 	- pState: Pointer to the copy
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called after LCD_Init, uploads the custom characters in use, writes the cells that are not blank and
+  * 				  restores the shift and the address counter. A running marquee is not restored
+  */
+void LCD_Restore_State(const LCD_State_t *pState);
+
+/**=============================================
+  * @Fn				- LCD_Get_Strobe_Count
+  * @brief 			- Returns the number of enable strobes sent to the LCD
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Strobes since start up
+  * Note			- Tells if the LCD was written since an earlier call
+  */
+uint32 LCD_Get_Strobe_Count(void);
+
+/**=============================================
+  * @Fn				- LCD_Take_Changed
+  * @brief 			- Tells if what the LCD shows changed since the last call
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- 1 if the shadow display data RAM, the custom characters, the shift or the address counter changed
+  * Note			- Clears the flag, a copy taken by LCD_Get_State after a 0 is still up to date
+  */
+uint8 LCD_Take_Changed(void);
+
+/**=============================================
+  * @Fn				- LCD_Get_Strobe_Cycles
+  * @brief 			- Returns the time of the last enable strobe
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- MCAL_STK_Get_Cycles at the last enable falling edge, the LCD latches the data then
+  * Note			- None
+  */
+uint32 LCD_Get_Strobe_Cycles(void);
+
 
 #endif /* INCLCD_DRIVER_H_ */
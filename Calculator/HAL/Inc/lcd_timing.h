@@ -0,0 +1,154 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : lcd_timing.h 			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INCLCD_TIMING_H_
+#define INCLCD_TIMING_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "STM32F103x8.h"
+#include "systick_driver.h"
+#include "vector_driver.h"
+#include <string.h>
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#ifndef LCD_TIMING_ENABLE
+#define LCD_TIMING_ENABLE			0		// 1 checks every LCD bus transaction against the HD44780 timings, 0 removes the checks
+#endif
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref LCD_TIMING_NS_define
+/* HD44780U minimum timings in ns for VCC 2.7...4.5 V, the slower of its two supply ranges */
+#define LCD_T_CYCLE_NS				1000UL		// tcycE, enable rising edge to the next one
+#define LCD_T_PULSE_NS				450UL		// PWEH, enable high
+#define LCD_T_ADDRESS_SETUP_NS		60UL		// tAS, RS/RW stable to enable rising edge
+#define LCD_T_ADDRESS_HOLD_NS		20UL		// tAH, enable falling edge to RS/RW change
+#define LCD_T_DATA_SETUP_NS			195UL		// tDSW, data stable to enable falling edge
+#define LCD_T_DATA_HOLD_NS			10UL		// tH, enable falling edge to data change
+#define LCD_T_EXECUTE_NS			37000UL		// Most instructions, enable falling edge to the next instruction
+#define LCD_T_EXECUTE_CHAR_NS		41000UL		// Writing data, the address counter update takes 4 us more
+#define LCD_T_EXECUTE_LONG_NS		1520000UL	// Clear display and return home
+
+// @ref LCD_TIMING_SITE_define
+/* Driver path a transaction is sent from */
+#define LCD_TIMING_SITE_INIT		0		// Function set nibble of LCD_Init
+#define LCD_TIMING_SITE_COMMAND		1		// LCD_Send_Command
+#define LCD_TIMING_SITE_CHAR		2		// LCD_Send_Char
+#define LCD_TIMING_SITES			3
+
+// @ref LCD_TIMING_EDGE_define
+#define LCD_EDGE_ADDRESS			0		// RS or RW changed
+#define LCD_EDGE_DATA				1		// A data pin changed
+#define LCD_EDGE_ENABLE_RISE		2
+#define LCD_EDGE_ENABLE_FALL		3
+#define LCD_EDGE_NONE				4		// No pin changed, LCD_Timing_Init times the hook with it
+
+#define LCD_NS_TO_CYCLES(_NS_)		((((_NS_) * (STK_FCPU / 1000000UL)) + 999UL) / 1000UL)
+
+#if LCD_TIMING_ENABLE == 1
+#define LCD_TIMING_INIT()			LCD_Timing_Init()
+#define LCD_TIMING_BEGIN(_SITE_)	LCD_Timing_Begin(_SITE_)
+#define LCD_TIMING_END(_NS_)		LCD_Timing_End(_NS_)
+#define LCD_TIMING_EDGE(_EDGE_)		LCD_Timing_Edge(_EDGE_)
+#else
+#define LCD_TIMING_INIT()
+#define LCD_TIMING_BEGIN(_SITE_)
+#define LCD_TIMING_END(_NS_)
+#define LCD_TIMING_EDGE(_EDGE_)
+#endif
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	LCD_TIMING_ADDRESS_SETUP,
+	LCD_TIMING_ADDRESS_HOLD,
+	LCD_TIMING_PULSE,
+	LCD_TIMING_DATA_SETUP,
+	LCD_TIMING_DATA_HOLD,
+	LCD_TIMING_CYCLE,
+	LCD_TIMING_EXECUTE,
+	LCD_TIMING_CONSTRAINTS
+}LCD_Timing_Constraint_t;
+
+/* Results of one driver path, times in CPU cycles */
+typedef struct{
+	uint32 transactions;
+	uint32 violations[LCD_TIMING_CONSTRAINTS];		// Times the measured time was below the minimum
+	sint32 min_slack[LCD_TIMING_CONSTRAINTS];		// Smallest measured time less its minimum, negative if violated
+	uint64 wasted[LCD_TIMING_CONSTRAINTS];			// Sum of the time above the minimum
+}LCD_Timing_Site_t;
+
+typedef struct{
+	LCD_Timing_Site_t site[LCD_TIMING_SITES];		// @ref LCD_TIMING_SITE_define
+	uint32 hook_cycles;								// Cost of a hook outside of its own timing, calibrated by LCD_Timing_Init
+}LCD_Timing_Report_t;
+
+/*
+ * =============================================
+ * APIs Supported by "LCD timing"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- LCD_Timing_Init
+  * @brief 			- Starts the cycle counter, clears the results and calibrates the cost of a hook
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Use the LCD_TIMING_ macros so the checks can be removed from the build
+  */
+void LCD_Timing_Init(void);
+
+/**=============================================
+  * @Fn				- LCD_Timing_Begin
+  * @brief 			- Marks the start of a transaction
+  * @param [in] 	- site: Driver path sending it @ref LCD_TIMING_SITE_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void LCD_Timing_Begin(uint8 site);
+
+/**=============================================
+  * @Fn				- LCD_Timing_End
+  * @brief 			- Marks the end of a transaction
+  * @param [in] 	- execute_ns: Time the LCD needs after the last enable falling edge @ref LCD_TIMING_NS_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Checked against the next enable rising edge
+  */
+void LCD_Timing_End(uint32 execute_ns);
+
+/**=============================================
+  * @Fn				- LCD_Timing_Edge
+  * @brief 			- Timestamps a change of the LCD pins and checks the timings it closes
+  * @param [in] 	- edge: Pin change @ref LCD_TIMING_EDGE_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called right after the pin is written, the time spent in the hooks is left out of the measured times
+  */
+void LCD_Timing_Edge(uint8 edge);
+
+/**=============================================
+  * @Fn				- LCD_Timing_Get_Report
+  * @brief 			- Copies the results of every driver path
+  * @param [in] 	- None
+  * @param [out] 	- pReport: Pointer to the results
+  * @retval 		- None
+  * Note			- A constraint never checked keeps its min_slack at 0x7FFFFFFF
+  */
+void LCD_Timing_Get_Report(LCD_Timing_Report_t *pReport);
+
+#endif /* INCLCD_TIMING_H_ */
@@ -10,15 +10,18 @@
 #include "keypad_driver.h"
 
 /* Keypad buttons definition */
-static uint8 Keypad_Buttons [KEYPAD_ROWS][KEYPAD_COLS] = {
+static const uint8 Keypad_Buttons [KEYPAD_ROWS][KEYPAD_COLS] = {
 		{ 7 ,  8 ,  9 , '/'},
 		{ 4 ,  5 ,  6 , 'x'},
 		{ 1 ,  2 ,  3 , '-'},
 		{'C',  0 , '=', '+'}
 };
 
-static uint16 Keypad_ROWS_GPIO [KEYPAD_ROWS] = {ROW0, ROW1, ROW2, ROW3};
-static uint16 Keypad_COLS_GPIO [KEYPAD_COLS] = {COL0, COL1, COL2, COL3};
+static const uint16 Keypad_ROWS_GPIO [KEYPAD_ROWS] = {ROW0, ROW1, ROW2, ROW3};
+static const uint16 Keypad_COLS_GPIO [KEYPAD_COLS] = {COL0, COL1, COL2, COL3};
+
+static uint8 Keypad_Held_Key = 'F'; // Key reported by keypad_Scan and not released yet
+static uint8 Keypad_Release_Count;  // Scans without a pressed key since Keypad_Held_Key was last seen
 
 /**=============================================
   * @Fn				- keypad_init
@@ -78,7 +81,9 @@ uint8 keypad_Get_Pressed_Key(){
 		MCAL_GPIO_WritePin(KEYPAD_PORT, Keypad_ROWS_GPIO[row_index], GPIO_PIN_RESET);
 		for(col_index = 0; col_index < KEYPAD_COLS; col_index++){
 			if(MCAL_GPIO_ReadPin(KEYPAD_PORT, Keypad_COLS_GPIO[col_index]) == GPIO_PIN_RESET){
-				while(MCAL_GPIO_ReadPin(KEYPAD_PORT, Keypad_COLS_GPIO[col_index]) == GPIO_PIN_RESET);
+				while(MCAL_GPIO_ReadPin(KEYPAD_PORT, Keypad_COLS_GPIO[col_index]) == GPIO_PIN_RESET){
+					CPU_BUSY_WAIT();
+				}
 				return_char = Keypad_Buttons[row_index][col_index];
 				MCAL_GPIO_WritePin(KEYPAD_PORT, Keypad_ROWS_GPIO[row_index], GPIO_PIN_SET);
 				return return_char;
@@ -88,3 +93,47 @@ uint8 keypad_Get_Pressed_Key(){
 	}
 	return return_char;
 }
+
+/**=============================================
+  * @Fn				- keypad_Scan
+  * @brief 			- Checks the keypad once without waiting for the key to be released
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Value of a newly pressed key, or F if no key is pressed or the key is still held
+  * Note			- To be called every KEYPAD_SCAN_PERIOD_MS @ref Keypad_SCAN_define, may be called from an interrupt
+  */
+uint8 keypad_Scan(void){
+	uint8 key = 'F';
+	uint8 row_index, col_index;
+	for(row_index = 0; (row_index < KEYPAD_ROWS) && ('F' == key); row_index++){
+		MCAL_GPIO_WritePin(KEYPAD_PORT, Keypad_ROWS_GPIO[row_index], GPIO_PIN_RESET);
+		for(col_index = 0; (col_index < KEYPAD_COLS) && ('F' == key); col_index++){
+			if(MCAL_GPIO_ReadPin(KEYPAD_PORT, Keypad_COLS_GPIO[col_index]) == GPIO_PIN_RESET){
+				key = Keypad_Buttons[row_index][col_index];
+			}
+			else{ /* Do Nothing */ }
+		}
+		MCAL_GPIO_WritePin(KEYPAD_PORT, Keypad_ROWS_GPIO[row_index], GPIO_PIN_SET);
+	}
+
+	if('F' == key){
+		/* A bouncing key reads as released for a short time, so it is released after some scans */
+		if((KEYPAD_RELEASE_SCANS - 1) > Keypad_Release_Count){
+			Keypad_Release_Count++;
+		}
+		else{
+			Keypad_Held_Key = 'F';
+		}
+		return 'F';
+	}
+	else if(key == Keypad_Held_Key){
+		Keypad_Release_Count = 0;
+		return 'F';
+	}
+	else{
+		Keypad_Held_Key = key;
+		Keypad_Release_Count = 0;
+		TRACE(TRACE_ID_KEY, key);
+		return key;
+	}
+}
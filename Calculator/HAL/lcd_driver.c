@@ -9,6 +9,124 @@
 
 #include "lcd_driver.h"
 
+#define LCD_ADDRESS_UNKNOWN		0xFF	// Address counter points to CGRAM or an unused address
+
+static uint8 LCD_Shadow[LCD_DDRAM_ROWS][LCD_DDRAM_ROW_SIZE];	// Copy of display data RAM
+static uint8 LCD_Address = LCD_ADDRESS_UNKNOWN;					// Copy of the address counter
+static uint8 LCD_Glyphs[LCD_CGRAM_SLOTS][LCD_GLYPH_ROWS];		// Pattern held by every CGRAM slot
+static uint8 LCD_Glyphs_Used;									// Bit per CGRAM slot holding a pattern
+static uint8 LCD_Glyph_Order[LCD_CGRAM_SLOTS] = {0, 1, 2, 3, 4, 5, 6, 7}; // Slots from most to least recently used
+static uint8 LCD_Shift;											// Columns the display is shifted to the left
+static uint8 LCD_Marquee_Running;								// 1 if a row is being scrolled
+static uint8 LCD_Marquee_Last_Shift;							// Shift that shows the end of the scrolled row
+static uint8 LCD_Marquee_Hold;									// Steps left before the marquee moves again
+static uint32 LCD_Marquee_Period;								// Milliseconds between two scroll steps
+static uint32 LCD_Marquee_Tick;									// Tick of the last scroll step
+static uint32 LCD_Strobe_Count;									// Enable strobes since start up
+static uint32 LCD_Strobe_Cycles;								// Cycle count at the last enable falling edge
+static uint8 LCD_Changed;										// Shadow changed since LCD_Take_Changed
+#if LCD_TIMING_ENABLE == 1
+static uint16 LCD_Pin_Levels;									// Levels last written to the LCD pins
+#endif
+
+/**=============================================
+  * @Fn				- LCD_Write_Pin
+  * @brief 			- Writes a pin of the LCD bus
+  * @param [in] 	- PinNumber: LCD pin @ref LCD_CONFIG_define
+  * @param [in] 	- Value: 0 for low, else high
+  * @retval 		- None
+  * Note			- With LCD_TIMING_ENABLE every change is timestamped, writing the same level is no edge
+  */
+static void LCD_Write_Pin(uint16 PinNumber, uint8 Value){
+	MCAL_GPIO_WritePin(LCD_PORT, PinNumber, Value);
+#if LCD_TIMING_ENABLE == 1
+	if(((GPIO_PIN_RESET != Value) ? PinNumber : 0) != (LCD_Pin_Levels & PinNumber)){
+		LCD_Pin_Levels ^= PinNumber;
+		if(EN_PIN == PinNumber){
+			LCD_TIMING_EDGE((0 != (LCD_Pin_Levels & EN_PIN)) ? LCD_EDGE_ENABLE_RISE : LCD_EDGE_ENABLE_FALL);
+		}
+		else if((RS_PIN == PinNumber) || (RW_PIN == PinNumber)){
+			LCD_TIMING_EDGE(LCD_EDGE_ADDRESS);
+		}
+		else{
+			LCD_TIMING_EDGE(LCD_EDGE_DATA);
+		}
+	}
+	else{ /* Do Nothing */ }
+#endif
+}
+
+/**=============================================
+  * @Fn				- LCD_Track_Command
+  * @brief 			- Updates the shadow display data RAM and address counter after a command
+  * @param [in] 	- command: Executed command @ref LCD_COMMANDS_define
+  * @retval 		- None
+  * Note			- Entry mode is assumed to increment the address, @ref ENTRY_MODE
+  */
+static void LCD_Track_Command(uint8 command){
+	uint8 column;
+	LCD_Changed = 1;
+	if(0 != (command & 0x80)){
+		/* Set DDRAM address */
+		column = command & 0x3F;
+		LCD_Address = (LCD_DDRAM_ROW_SIZE > column) ? (command & 0x7F) : LCD_ADDRESS_UNKNOWN;
+	}
+	else if(0 != (command & 0x40)){
+		/* Set CGRAM address */
+		LCD_Address = LCD_ADDRESS_UNKNOWN;
+	}
+	else if(LCD_CLEAR_DISPLAY == command){
+		memset(LCD_Shadow, ' ', sizeof(LCD_Shadow));
+		LCD_Address = 0;
+		LCD_Shift = 0;
+		LCD_Marquee_Running = 0;
+	}
+	else if(LCD_RETURN_HOME == (command & 0xFE)){
+		LCD_Address = 0;
+		LCD_Shift = 0;
+	}
+	else if(LCD_DISPLAY_SHIFT_LEFT == command){
+		LCD_Shift = ((LCD_DDRAM_ROW_SIZE - 1) == LCD_Shift) ? 0 : (LCD_Shift + 1);
+	}
+	else if(LCD_DISPLAY_SHIFT_RIGHT == command){
+		LCD_Shift = (0 == LCD_Shift) ? (LCD_DDRAM_ROW_SIZE - 1) : (LCD_Shift - 1);
+	}
+	else if((LCD_CURSOR_MOVE_SHIFT_LEFT == command) && (LCD_ADDRESS_UNKNOWN != LCD_Address)){
+		column = LCD_Address & 0x3F;
+		LCD_Address = (LCD_Address & 0x40) | ((0 == column) ? (LCD_DDRAM_ROW_SIZE - 1) : (column - 1));
+	}
+	else if((LCD_CURSOR_MOVE_SHIFT_RIGHT == command) && (LCD_ADDRESS_UNKNOWN != LCD_Address)){
+		column = LCD_Address & 0x3F;
+		LCD_Address = (LCD_Address & 0x40) | (((LCD_DDRAM_ROW_SIZE - 1) == column) ? 0 : (column + 1));
+	}
+	else{ /* Do Nothing, settings do not move the address counter */ }
+}
+
+/**=============================================
+  * @Fn				- LCD_Track_Char
+  * @brief 			- Updates the shadow display data RAM and address counter after a character is written
+  * @param [in] 	- Char: Written character
+  * @retval 		- None
+  * Note			- The address moves from the end of the first row to the second row and back
+  */
+static void LCD_Track_Char(uint8 Char){
+	uint8 row, column;
+	LCD_Changed = 1;
+	if(LCD_ADDRESS_UNKNOWN != LCD_Address){
+		row = (0 != (LCD_Address & 0x40)) ? 1 : 0;
+		column = LCD_Address & 0x3F;
+		LCD_Shadow[row][column] = Char;
+		column++;
+		if(LCD_DDRAM_ROW_SIZE == column){
+			column = 0;
+			row ^= 1;
+		}
+		else{ /* Do Nothing */ }
+		LCD_Address = (row << 6) | column;
+	}
+	else{ /* Do Nothing */ }
+}
+
 static void LCD_GPIO_Init(){
 	GPIO_PinConfig_t PIN_CFG;
 	PIN_CFG.GPIO_MODE = GPIO_MODE_OUTPUT_PP;
@@ -57,11 +175,17 @@ static void LCD_GPIO_Init(){
   * @param [out] 	- None
   * @retval 		- None
   * Note			- User must set configurations @ref LCD_CONFIG_define
+  * 				  The system tick must be running, it times the power on wait LCD_POWER_ON_MS
   */
 void LCD_Init(){
 	// Initialize GPIO Pins
 	LCD_GPIO_Init();
-	MCAL_STK_Delay1ms(2);
+	LCD_TIMING_INIT();
+
+	// Wait for the rest of the power on time, the initialization done since the system tick started overlaps it
+	while(LCD_POWER_ON_MS > MCAL_STK_Get_Tick()){
+		CPU_WAIT_FOR_INTERRUPT();
+	}
 #if LCD_MODE == LCD_8BIT_MODE
 	// Send Function Set
 	LCD_Send_Command(LCD_8BIT_MODE_2_LINE);
@@ -79,17 +203,19 @@ void LCD_Init(){
 	LCD_Send_Command(ENTRY_MODE);
 
 #elif LCD_MODE == LCD_4BIT_MODE
-	MCAL_GPIO_WritePin(LCD_PORT, RS_PIN, GPIO_PIN_RESET);
-	MCAL_GPIO_WritePin(LCD_PORT, RW_PIN, GPIO_PIN_RESET);
+	LCD_TIMING_BEGIN(LCD_TIMING_SITE_INIT);
+	LCD_Write_Pin(RS_PIN, GPIO_PIN_RESET);
+	LCD_Write_Pin(RW_PIN, GPIO_PIN_RESET);
 	MCAL_STK_Delay1ms(1);
 
 	// Send Function Set
-	MCAL_GPIO_WritePin(LCD_PORT, D4_PIN, (LCD_4BIT_MODE_2_LINE&0x10));
-	MCAL_GPIO_WritePin(LCD_PORT, D5_PIN, (LCD_4BIT_MODE_2_LINE&0x20));
-	MCAL_GPIO_WritePin(LCD_PORT, D6_PIN, (LCD_4BIT_MODE_2_LINE&0x40));
-	MCAL_GPIO_WritePin(LCD_PORT, D7_PIN, (LCD_4BIT_MODE_2_LINE&0x80));
+	LCD_Write_Pin(D4_PIN, (LCD_4BIT_MODE_2_LINE&0x10));
+	LCD_Write_Pin(D5_PIN, (LCD_4BIT_MODE_2_LINE&0x20));
+	LCD_Write_Pin(D6_PIN, (LCD_4BIT_MODE_2_LINE&0x40));
+	LCD_Write_Pin(D7_PIN, (LCD_4BIT_MODE_2_LINE&0x80));
 	MCAL_STK_Delay1ms(1);
 	LCD_Send_Enable_Signal();
+	LCD_TIMING_END(LCD_T_EXECUTE_NS);
 
 	LCD_Send_Command(LCD_4BIT_MODE_2_LINE);
 	MCAL_STK_Delay1ms(1);
@@ -117,32 +243,35 @@ void LCD_Init(){
   * Note			- None
   */
 void LCD_Send_Command(uint8 command){
-	MCAL_GPIO_WritePin(LCD_PORT, RS_PIN, GPIO_PIN_RESET);
-	MCAL_GPIO_WritePin(LCD_PORT, RW_PIN, GPIO_PIN_RESET);
+	LCD_TIMING_BEGIN(LCD_TIMING_SITE_COMMAND);
+	LCD_Write_Pin(RS_PIN, GPIO_PIN_RESET);
+	LCD_Write_Pin(RW_PIN, GPIO_PIN_RESET);
 	MCAL_STK_Delay1ms(1);
 #if LCD_MODE == LCD_8BIT_MODE
-	MCAL_GPIO_WritePin(LCD_PORT, D0_PIN, (command&0x01));
-	MCAL_GPIO_WritePin(LCD_PORT, D1_PIN, (command&0x02));
-	MCAL_GPIO_WritePin(LCD_PORT, D2_PIN, (command&0x04));
-	MCAL_GPIO_WritePin(LCD_PORT, D3_PIN, (command&0x08));
-	MCAL_GPIO_WritePin(LCD_PORT, D4_PIN, (command&0x10));
-	MCAL_GPIO_WritePin(LCD_PORT, D5_PIN, (command&0x20));
-	MCAL_GPIO_WritePin(LCD_PORT, D6_PIN, (command&0x40));
-	MCAL_GPIO_WritePin(LCD_PORT, D7_PIN, (command&0x80));
+	LCD_Write_Pin(D0_PIN, (command&0x01));
+	LCD_Write_Pin(D1_PIN, (command&0x02));
+	LCD_Write_Pin(D2_PIN, (command&0x04));
+	LCD_Write_Pin(D3_PIN, (command&0x08));
+	LCD_Write_Pin(D4_PIN, (command&0x10));
+	LCD_Write_Pin(D5_PIN, (command&0x20));
+	LCD_Write_Pin(D6_PIN, (command&0x40));
+	LCD_Write_Pin(D7_PIN, (command&0x80));
 #elif LCD_MODE == LCD_4BIT_MODE
-	MCAL_GPIO_WritePin(LCD_PORT, D4_PIN, (command&0x10));
-	MCAL_GPIO_WritePin(LCD_PORT, D5_PIN, (command&0x20));
-	MCAL_GPIO_WritePin(LCD_PORT, D6_PIN, (command&0x40));
-	MCAL_GPIO_WritePin(LCD_PORT, D7_PIN, (command&0x80));
+	LCD_Write_Pin(D4_PIN, (command&0x10));
+	LCD_Write_Pin(D5_PIN, (command&0x20));
+	LCD_Write_Pin(D6_PIN, (command&0x40));
+	LCD_Write_Pin(D7_PIN, (command&0x80));
 	LCD_Send_Enable_Signal();
 	MCAL_STK_Delay1ms(1);
-	MCAL_GPIO_WritePin(LCD_PORT, D4_PIN, (command&0x01));
-	MCAL_GPIO_WritePin(LCD_PORT, D5_PIN, (command&0x02));
-	MCAL_GPIO_WritePin(LCD_PORT, D6_PIN, (command&0x04));
-	MCAL_GPIO_WritePin(LCD_PORT, D7_PIN, (command&0x08));
+	LCD_Write_Pin(D4_PIN, (command&0x01));
+	LCD_Write_Pin(D5_PIN, (command&0x02));
+	LCD_Write_Pin(D6_PIN, (command&0x04));
+	LCD_Write_Pin(D7_PIN, (command&0x08));
 #endif
 	MCAL_STK_Delay1ms(1);
 	LCD_Send_Enable_Signal();
+	LCD_TIMING_END(((LCD_CLEAR_DISPLAY == command) || (LCD_RETURN_HOME == (command & 0xFE))) ? LCD_T_EXECUTE_LONG_NS : LCD_T_EXECUTE_NS);
+	LCD_Track_Command(command);
 }
 
 /**=============================================
@@ -154,32 +283,35 @@ void LCD_Send_Command(uint8 command){
   * Note			- None
   */
 void LCD_Send_Char(uint8 Char){
-	MCAL_GPIO_WritePin(LCD_PORT, RS_PIN, GPIO_PIN_SET);
-	MCAL_GPIO_WritePin(LCD_PORT, RW_PIN, GPIO_PIN_RESET);
+	LCD_TIMING_BEGIN(LCD_TIMING_SITE_CHAR);
+	LCD_Write_Pin(RS_PIN, GPIO_PIN_SET);
+	LCD_Write_Pin(RW_PIN, GPIO_PIN_RESET);
 	MCAL_STK_Delay1ms(1);
 #if LCD_MODE == LCD_8BIT_MODE
-	MCAL_GPIO_WritePin(LCD_PORT, D0_PIN, (Char&0x01));
-	MCAL_GPIO_WritePin(LCD_PORT, D1_PIN, (Char&0x02));
-	MCAL_GPIO_WritePin(LCD_PORT, D2_PIN, (Char&0x04));
-	MCAL_GPIO_WritePin(LCD_PORT, D3_PIN, (Char&0x08));
-	MCAL_GPIO_WritePin(LCD_PORT, D4_PIN, (Char&0x10));
-	MCAL_GPIO_WritePin(LCD_PORT, D5_PIN, (Char&0x20));
-	MCAL_GPIO_WritePin(LCD_PORT, D6_PIN, (Char&0x40));
-	MCAL_GPIO_WritePin(LCD_PORT, D7_PIN, (Char&0x80));
+	LCD_Write_Pin(D0_PIN, (Char&0x01));
+	LCD_Write_Pin(D1_PIN, (Char&0x02));
+	LCD_Write_Pin(D2_PIN, (Char&0x04));
+	LCD_Write_Pin(D3_PIN, (Char&0x08));
+	LCD_Write_Pin(D4_PIN, (Char&0x10));
+	LCD_Write_Pin(D5_PIN, (Char&0x20));
+	LCD_Write_Pin(D6_PIN, (Char&0x40));
+	LCD_Write_Pin(D7_PIN, (Char&0x80));
 #elif LCD_MODE == LCD_4BIT_MODE
-	MCAL_GPIO_WritePin(LCD_PORT, D4_PIN, (Char&0x10));
-	MCAL_GPIO_WritePin(LCD_PORT, D5_PIN, (Char&0x20));
-	MCAL_GPIO_WritePin(LCD_PORT, D6_PIN, (Char&0x40));
-	MCAL_GPIO_WritePin(LCD_PORT, D7_PIN, (Char&0x80));
+	LCD_Write_Pin(D4_PIN, (Char&0x10));
+	LCD_Write_Pin(D5_PIN, (Char&0x20));
+	LCD_Write_Pin(D6_PIN, (Char&0x40));
+	LCD_Write_Pin(D7_PIN, (Char&0x80));
 	MCAL_STK_Delay1ms(1);
 	LCD_Send_Enable_Signal();
-	MCAL_GPIO_WritePin(LCD_PORT, D4_PIN, (Char&0x01));
-	MCAL_GPIO_WritePin(LCD_PORT, D5_PIN, (Char&0x02));
-	MCAL_GPIO_WritePin(LCD_PORT, D6_PIN, (Char&0x04));
-	MCAL_GPIO_WritePin(LCD_PORT, D7_PIN, (Char&0x08));
+	LCD_Write_Pin(D4_PIN, (Char&0x01));
+	LCD_Write_Pin(D5_PIN, (Char&0x02));
+	LCD_Write_Pin(D6_PIN, (Char&0x04));
+	LCD_Write_Pin(D7_PIN, (Char&0x08));
 #endif
 	MCAL_STK_Delay1ms(1);
 	LCD_Send_Enable_Signal();
+	LCD_TIMING_END(LCD_T_EXECUTE_CHAR_NS);
+	LCD_Track_Char(Char);
 }
 
 /**=============================================
@@ -236,9 +368,11 @@ void LCD_Send_string_Pos(uint8 *string, uint8 row, uint8 column){
   * Note			- None
   */
 void LCD_Send_Enable_Signal(){
-	MCAL_GPIO_WritePin(LCD_PORT, EN_PIN, GPIO_PIN_SET);
+	LCD_Write_Pin(EN_PIN, GPIO_PIN_SET);
 	MCAL_STK_Delay1ms(1);
-	MCAL_GPIO_WritePin(LCD_PORT, EN_PIN, GPIO_PIN_RESET);
+	LCD_Write_Pin(EN_PIN, GPIO_PIN_RESET);
+	LCD_Strobe_Cycles = MCAL_STK_Get_Cycles();
+	LCD_Strobe_Count++;
 	MCAL_STK_Delay1ms(1);
 }
 
@@ -255,3 +389,260 @@ void LCD_Set_Cursor(uint8 row, uint8 column){
 	column--;
 	LCD_Send_Command(row + column);
 }
+
+/**=============================================
+  * @Fn				- LCD_Update_String_Pos
+  * @brief 			- Writes only the characters of a string that differ from what the LCD already shows
+  * @param [in] 	- string: pointer to a string of characters to be displayed on LCD
+  * @param [in] 	- row: Selects the row number of the displayed character @ref LCD_ROWS_POS_define
+  * @param [in] 	- column: Selects the column number of the first character (1...40)
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Compares against a copy of display data RAM, so the cursor is only moved over changed cells
+  * 				  Characters past the 40th column are ignored
+  */
+void LCD_Update_String_Pos(uint8 *string, uint8 row, uint8 column){
+	uint8 shadow_row = (LCD_SECOND_ROW == row) ? 1 : 0;
+	uint8 index = column - 1;
+	uint8 address;
+	for(; ('\0' != *string) && (LCD_DDRAM_ROW_SIZE > index); string++, index++){
+		if(*string != LCD_Shadow[shadow_row][index]){
+			address = (shadow_row << 6) | index;
+			if(address != LCD_Address){
+				LCD_Set_Cursor(row, index + 1);
+			}
+			else{ /* Do Nothing */ }
+			LCD_Send_Char(*string);
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/**=============================================
+  * @Fn				- LCD_Create_Char
+  * @brief 			- Returns the character code of a custom character, uploading it to CGRAM if needed
+  * @param [in] 	- pPattern: LCD_GLYPH_ROWS rows of the character @ref LCD_CGRAM_define
+  * @param [out] 	- None
+  * @retval 		- Character code to be written to display data RAM (LCD_GLYPH_CODE_BASE...LCD_GLYPH_CODE_BASE + 7)
+  * Note			- Characters are cached by their rows, so the pattern may be built on the stack
+  * 				  When all slots are taken, the least recently used character is replaced, and cells still
+  * 				  showing it change to the new one, so a screen must not use more than LCD_CGRAM_SLOTS characters
+  */
+uint8 LCD_Create_Char(const uint8 *pPattern){
+	uint8 index = 0;
+	uint8 slot, row;
+	while(((LCD_CGRAM_SLOTS - 1) > index) && ((0 == (LCD_Glyphs_Used & (1U << LCD_Glyph_Order[index]))) ||
+			(0 != memcmp(pPattern, LCD_Glyphs[LCD_Glyph_Order[index]], LCD_GLYPH_ROWS)))){
+		index++;
+	}
+	slot = LCD_Glyph_Order[index];
+	if((0 == (LCD_Glyphs_Used & (1U << slot))) || (0 != memcmp(pPattern, LCD_Glyphs[slot], LCD_GLYPH_ROWS))){
+		/* Not cached, the least recently used slot is replaced */
+		memcpy(LCD_Glyphs[slot], pPattern, LCD_GLYPH_ROWS);
+		LCD_Glyphs_Used |= 1U << slot;
+		LCD_Send_Command(LCD_SET_CGRAM_ADDRESS | (slot << 3));
+		for(row = 0; row < LCD_GLYPH_ROWS; row++){
+			LCD_Send_Char(pPattern[row]);
+		}
+	}
+	else{ /* Do Nothing */ }
+
+	/* Move the slot to the front of the order */
+	for(; index > 0; index--){
+		LCD_Glyph_Order[index] = LCD_Glyph_Order[index - 1];
+	}
+	LCD_Glyph_Order[0] = slot;
+	return (LCD_GLYPH_CODE_BASE + slot);
+}
+
+/**=============================================
+  * @Fn				- LCD_Marquee_Start
+  * @brief 			- Writes a row once and scrolls it with the display shift if it is wider than the LCD
+  * @param [in] 	- string: pointer to a string of characters to be displayed on LCD
+  * @param [in] 	- row: Selects the row number of the displayed string @ref LCD_ROWS_POS_define
+  * @param [in] 	- period_ms: Milliseconds between two scroll steps
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Characters past LCD_DDRAM_ROW_SIZE are ignored, the rest of the row is filled with spaces
+  * 				  The display shift moves both rows, so the other row scrolls together with the marquee
+  * 				  Needs the system tick, @ref MCAL_STK_Tick_Init
+  */
+void LCD_Marquee_Start(uint8 *string, uint8 row, uint32 period_ms){
+	uint8 line[LCD_DDRAM_ROW_SIZE + 1];
+	uint8 length = (uint8)strlen((char*)string);
+	LCD_Marquee_Stop();
+	length = (LCD_DDRAM_ROW_SIZE < length) ? LCD_DDRAM_ROW_SIZE : length;
+	memset(line, ' ', LCD_DDRAM_ROW_SIZE);
+	memcpy(line, string, length);
+	line[LCD_DDRAM_ROW_SIZE] = '\0';
+	LCD_Update_String_Pos(line, row, 1);
+	if(LCD_DISPLAY_COLS < length){
+		LCD_Marquee_Last_Shift = length - LCD_DISPLAY_COLS;
+		LCD_Marquee_Period = period_ms;
+		LCD_Marquee_Hold = LCD_MARQUEE_HOLD_STEPS;
+		LCD_Marquee_Tick = MCAL_STK_Get_Tick();
+		LCD_Marquee_Running = 1;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LCD_Marquee_Update
+  * @brief 			- Scrolls a running marquee by one column when its period has passed
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- To be called on timer events with the marquee period, a step costs one command instead of rewriting the row
+  * 				  After the end of the row is shown, the marquee returns to its start with one command
+  */
+void LCD_Marquee_Update(void){
+	uint32 tick = MCAL_STK_Get_Tick();
+	if((1 == LCD_Marquee_Running) && ((tick - LCD_Marquee_Tick) >= LCD_Marquee_Period)){
+		/* Keep to the schedule of a timer with the same period, unless a whole period was missed */
+		LCD_Marquee_Tick += LCD_Marquee_Period;
+		if((tick - LCD_Marquee_Tick) >= LCD_Marquee_Period){
+			LCD_Marquee_Tick = tick;
+		}
+		else{ /* Do Nothing */ }
+		if(0 != LCD_Marquee_Hold){
+			LCD_Marquee_Hold--;
+		}
+		else if(LCD_Marquee_Last_Shift > LCD_Shift){
+			LCD_Send_Command(LCD_DISPLAY_SHIFT_LEFT);
+			LCD_Marquee_Hold = (LCD_Marquee_Last_Shift == LCD_Shift) ? LCD_MARQUEE_HOLD_STEPS : 0;
+		}
+		else{
+			LCD_Send_Command(LCD_RETURN_HOME);
+			LCD_Marquee_Hold = LCD_MARQUEE_HOLD_STEPS;
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LCD_Marquee_Stop
+  * @brief 			- Stops a running marquee and shows the start of the row again
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Clearing the display also stops the marquee
+  */
+void LCD_Marquee_Stop(void){
+	if(1 == LCD_Marquee_Running){
+		LCD_Marquee_Running = 0;
+		if(0 != LCD_Shift){
+			LCD_Send_Command(LCD_RETURN_HOME);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LCD_Get_State
+  * @brief 			- Copies what the LCD shows
+  * @param [in] 	- None
+  * @param [out] 	- pState: Pointer to the copy
+  * @retval 		- None
+  * Note			- Taken from the shadow display data RAM, the LCD is not read
+  */
+void LCD_Get_State(LCD_State_t *pState){
+	memcpy(pState->shadow, LCD_Shadow, sizeof(LCD_Shadow));
+	memcpy(pState->glyphs, LCD_Glyphs, sizeof(LCD_Glyphs));
+	pState->glyphs_used = LCD_Glyphs_Used;
+	pState->address = LCD_Address;
+	pState->shift = LCD_Shift;
+}
+
+/**=============================================
+  * @Fn				- LCD_Restore_State
+  * @brief 			- Draws a copy taken by LCD_Get_State again
+  * @param [in] 	- pState: Pointer to the copy
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called after LCD_Init, uploads the custom characters in use, writes the cells that are not blank and
+  * 				  restores the shift and the address counter. A running marquee is not restored
+  */
+void LCD_Restore_State(const LCD_State_t *pState){
+	uint8 slot, row, column;
+	memcpy(LCD_Glyphs, pState->glyphs, sizeof(LCD_Glyphs));
+	LCD_Glyphs_Used = pState->glyphs_used;
+	for(slot = 0; slot < LCD_CGRAM_SLOTS; slot++){
+		if(0 != (pState->glyphs_used & (1U << slot))){
+			LCD_Send_Command(LCD_SET_CGRAM_ADDRESS | (slot << 3));
+			for(row = 0; row < LCD_GLYPH_ROWS; row++){
+				LCD_Send_Char(pState->glyphs[slot][row]);
+			}
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	/* LCD_Init cleared the display, the address is only set where a run of other cells starts */
+	LCD_Address = LCD_ADDRESS_UNKNOWN;
+	for(row = 0; row < LCD_DDRAM_ROWS; row++){
+		for(column = 0; column < LCD_DDRAM_ROW_SIZE; column++){
+			if(' ' != pState->shadow[row][column]){
+				if(((row << 6) | column) != LCD_Address){
+					LCD_Send_Command(LCD_FIRST_ROW | (row << 6) | column);
+				}
+				else{ /* Do Nothing */ }
+				LCD_Send_Char(pState->shadow[row][column]);
+			}
+			else{ /* Do Nothing */ }
+		}
+	}
+
+	/* The shift wraps around the row, the shorter way is taken */
+	if((LCD_DDRAM_ROW_SIZE / 2) < pState->shift){
+		for(column = pState->shift; column < LCD_DDRAM_ROW_SIZE; column++){
+			LCD_Send_Command(LCD_DISPLAY_SHIFT_RIGHT);
+		}
+	}
+	else{
+		for(column = 0; column < pState->shift; column++){
+			LCD_Send_Command(LCD_DISPLAY_SHIFT_LEFT);
+		}
+	}
+	if((LCD_ADDRESS_UNKNOWN != pState->address) && (pState->address != LCD_Address)){
+		LCD_Send_Command(LCD_FIRST_ROW | pState->address);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LCD_Get_Strobe_Count
+  * @brief 			- Returns the number of enable strobes sent to the LCD
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Strobes since start up
+  * Note			- Tells if the LCD was written since an earlier call
+  */
+uint32 LCD_Get_Strobe_Count(void){
+	return LCD_Strobe_Count;
+}
+
+/**=============================================
+  * @Fn				- LCD_Take_Changed
+  * @brief 			- Tells if what the LCD shows changed since the last call
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- 1 if the shadow display data RAM, the custom characters, the shift or the address counter changed
+  * Note			- Clears the flag, a copy taken by LCD_Get_State after a 0 is still up to date
+  */
+uint8 LCD_Take_Changed(void){
+	uint8 changed = LCD_Changed;
+	LCD_Changed = 0;
+	return changed;
+}
+
+/**=============================================
+  * @Fn				- LCD_Get_Strobe_Cycles
+  * @brief 			- Returns the time of the last enable strobe
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- MCAL_STK_Get_Cycles at the last enable falling edge, the LCD latches the data then
+  * Note			- None
+  */
+uint32 LCD_Get_Strobe_Cycles(void){
+	return LCD_Strobe_Cycles;
+}
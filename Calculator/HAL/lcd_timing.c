@@ -0,0 +1,185 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : lcd_timing.c 			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "lcd_timing.h"
+
+#define LCD_SLACK_UNCHECKED		0x7FFFFFFFL
+
+static LCD_Timing_Report_t LCD_Timing;
+static uint8 LCD_Timing_Site;			// Site of the transaction being sent
+static uint8 LCD_Timing_Fall_Site;		// Site of the last enable falling edge, the hold and execution times belong to it
+static uint32 LCD_Address_Time;			// Cycle counter at the last change of RS/RW
+static uint32 LCD_Data_Time;			// Cycle counter at the last change of a data pin
+static uint32 LCD_Rise_Time;			// Cycle counter at the last enable rising edge
+static uint32 LCD_Fall_Time;			// Cycle counter at the last enable falling edge
+static uint8 LCD_Rise_Valid;			// 1 once an enable rising edge was seen
+static uint8 LCD_Address_Hold_Armed;	// 1 until RS/RW change after an enable falling edge
+static uint8 LCD_Data_Hold_Armed;		// 1 until a data pin changes after an enable falling edge
+static uint32 LCD_Execute_Ns;			// Execution time of the last transaction, 0 once checked
+static uint32 LCD_Hook_Total;			// Cycles spent in the hooks so far, the times above leave them out
+static uint32 LCD_Hook_Exit;			// Cycle counter at the end of the last hook
+static uint32 LCD_Hook_Gap;				// Cycles from the end of the last hook to the start of this one
+
+/**=============================================
+  * @Fn				- LCD_Timing_Check
+  * @brief 			- Compares a measured time with its minimum and adds it to the results of a site
+  * @param [in] 	- site: Driver path @ref LCD_TIMING_SITE_define
+  * @param [in] 	- constraint: Checked timing
+  * @param [in] 	- measured: Measured time in cycles
+  * @param [in] 	- minimum_ns: Minimum time @ref LCD_TIMING_NS_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void LCD_Timing_Check(uint8 site, LCD_Timing_Constraint_t constraint, uint32 measured, uint32 minimum_ns){
+	LCD_Timing_Site_t *pSite = &LCD_Timing.site[site];
+	sint32 slack = (sint32)(measured - LCD_NS_TO_CYCLES(minimum_ns));
+	if(0 > slack){
+		pSite->violations[constraint]++;
+	}
+	else{
+		pSite->wasted[constraint] += (uint32)slack;
+	}
+
+	if(pSite->min_slack[constraint] > slack){
+		pSite->min_slack[constraint] = slack;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LCD_Timing_Init
+  * @brief 			- Starts the cycle counter, clears the results and calibrates the cost of a hook
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Use the LCD_TIMING_ macros so the checks can be removed from the build
+  */
+void LCD_Timing_Init(void){
+	uint8 site, constraint;
+	DEMCR |= DEMCR_TRCENA;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA;
+
+	memset(&LCD_Timing, 0, sizeof(LCD_Timing));
+	for(site = 0; site < LCD_TIMING_SITES; site++){
+		for(constraint = 0; constraint < LCD_TIMING_CONSTRAINTS; constraint++){
+			LCD_Timing.site[site].min_slack[constraint] = LCD_SLACK_UNCHECKED;
+		}
+	}
+
+	/* Two hooks back to back: the gap between them is the return of one and the call of the next, which no hook
+	 * can time itself, the code of the driver in between adds to it on the bus */
+	LCD_Hook_Total = 0;
+	LCD_Timing_Edge(LCD_EDGE_NONE);
+	LCD_Timing_Edge(LCD_EDGE_NONE);
+	LCD_Timing.hook_cycles = LCD_Hook_Gap;
+
+	LCD_Address_Time = DWT->CYCCNT - LCD_Hook_Total;
+	LCD_Data_Time = LCD_Address_Time;
+	LCD_Rise_Valid = 0;
+	LCD_Address_Hold_Armed = 0;
+	LCD_Data_Hold_Armed = 0;
+	LCD_Execute_Ns = 0;
+}
+
+/**=============================================
+  * @Fn				- LCD_Timing_Begin
+  * @brief 			- Marks the start of a transaction
+  * @param [in] 	- site: Driver path sending it @ref LCD_TIMING_SITE_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void LCD_Timing_Begin(uint8 site){
+	LCD_Timing_Site = site;
+	LCD_Timing.site[site].transactions++;
+}
+
+/**=============================================
+  * @Fn				- LCD_Timing_End
+  * @brief 			- Marks the end of a transaction
+  * @param [in] 	- execute_ns: Time the LCD needs after the last enable falling edge @ref LCD_TIMING_NS_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Checked against the next enable rising edge
+  */
+void LCD_Timing_End(uint32 execute_ns){
+	LCD_Execute_Ns = execute_ns;
+}
+
+/**=============================================
+  * @Fn				- LCD_Timing_Edge
+  * @brief 			- Timestamps a change of the LCD pins and checks the timings it closes
+  * @param [in] 	- edge: Pin change @ref LCD_TIMING_EDGE_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called right after the pin is written, the time spent in the hooks is left out of the measured times
+  */
+void LCD_Timing_Edge(uint8 edge){
+	uint32 entry = DWT->CYCCNT;
+	uint32 now = entry - LCD_Hook_Total;
+	LCD_Hook_Gap = entry - LCD_Hook_Exit;
+	if(LCD_EDGE_ADDRESS == edge){
+		if(1 == LCD_Address_Hold_Armed){
+			LCD_Timing_Check(LCD_Timing_Fall_Site, LCD_TIMING_ADDRESS_HOLD, now - LCD_Fall_Time, LCD_T_ADDRESS_HOLD_NS);
+			LCD_Address_Hold_Armed = 0;
+		}
+		else{ /* Do Nothing */ }
+		LCD_Address_Time = now;
+	}
+	else if(LCD_EDGE_DATA == edge){
+		if(1 == LCD_Data_Hold_Armed){
+			LCD_Timing_Check(LCD_Timing_Fall_Site, LCD_TIMING_DATA_HOLD, now - LCD_Fall_Time, LCD_T_DATA_HOLD_NS);
+			LCD_Data_Hold_Armed = 0;
+		}
+		else{ /* Do Nothing */ }
+		LCD_Data_Time = now;
+	}
+	else if(LCD_EDGE_ENABLE_RISE == edge){
+		LCD_Timing_Check(LCD_Timing_Site, LCD_TIMING_ADDRESS_SETUP, now - LCD_Address_Time, LCD_T_ADDRESS_SETUP_NS);
+		if(1 == LCD_Rise_Valid){
+			LCD_Timing_Check(LCD_Timing_Site, LCD_TIMING_CYCLE, now - LCD_Rise_Time, LCD_T_CYCLE_NS);
+		}
+		else{ /* Do Nothing */ }
+
+		/* The previous instruction must be done before this one is latched */
+		if(0 != LCD_Execute_Ns){
+			LCD_Timing_Check(LCD_Timing_Fall_Site, LCD_TIMING_EXECUTE, now - LCD_Fall_Time, LCD_Execute_Ns);
+			LCD_Execute_Ns = 0;
+		}
+		else{ /* Do Nothing */ }
+		LCD_Rise_Time = now;
+		LCD_Rise_Valid = 1;
+	}
+	else if(LCD_EDGE_ENABLE_FALL == edge){
+		LCD_Timing_Check(LCD_Timing_Site, LCD_TIMING_PULSE, now - LCD_Rise_Time, LCD_T_PULSE_NS);
+		LCD_Timing_Check(LCD_Timing_Site, LCD_TIMING_DATA_SETUP, now - LCD_Data_Time, LCD_T_DATA_SETUP_NS);
+		LCD_Fall_Time = now;
+		LCD_Timing_Fall_Site = LCD_Timing_Site;
+		LCD_Address_Hold_Armed = 1;
+		LCD_Data_Hold_Armed = 1;
+	}
+	else{ /* Do Nothing */ }
+
+	/* The checks of this hook and the calibrated call around it are no time on the bus */
+	LCD_Hook_Exit = DWT->CYCCNT;
+	LCD_Hook_Total += (LCD_Hook_Exit - entry) + LCD_Timing.hook_cycles;
+}
+
+/**=============================================
+  * @Fn				- LCD_Timing_Get_Report
+  * @brief 			- Copies the results of every driver path
+  * @param [in] 	- None
+  * @param [out] 	- pReport: Pointer to the results
+  * @retval 		- None
+  * Note			- A constraint never checked keeps its min_slack at 0x7FFFFFFF
+  */
+void LCD_Timing_Get_Report(LCD_Timing_Report_t *pReport){
+	*pReport = LCD_Timing;
+}
@@ -0,0 +1,318 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : sim.h 			                          			 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#ifndef HOST_SIM_SIM_H_
+#define HOST_SIM_SIM_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stdio.h>
+#include "STM32F103x8.h"
+#include "systick_driver.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+/*
+ * Costs in cycles of what the firmware does between two hooks, the code itself runs in no virtual time.
+ * They are rough Cortex-M3 figures at 0 flash wait states, enough to keep the order of events right.
+ */
+#define SIM_POLL_CYCLES			6			// One turn of a loop polling a register, CPU_BUSY_WAIT
+#define SIM_GPIO_WRITE_CYCLES	20			// MCAL_GPIO_WritePin and its call
+#define SIM_EXCEPTION_CYCLES	12			// Exception entry, stacking and vector fetch
+
+#define SIM_RAM_SIZE			0x10000UL	// RAM the firmware runs in, heap from the bottom and stack from the top
+#define SIM_STACK_SIZE			0x4000UL	// _Min_Stack_Size of the host build, x86-64 frames are bigger than Thumb ones
+#define SIM_FLASH_MAP_BASE		0x0800F000UL	// Host page holding the settings page of the flash memory
+#define SIM_FLASH_MAP_SIZE		0x1000UL
+#define SIM_FLASH_ERASE_CYCLES	(20UL * (STK_FCPU / 1000UL))	// Page erase, 20 ms
+#define SIM_FLASH_WRITE_CYCLES	(52UL * (STK_FCPU / 1000000UL))	// Half word programming, 52 us
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define SIM_NEVER				0xFFFFFFFFFFFFFFFFULL	// Time of an event that is not scheduled
+
+// @ref SIM_EXCEPTION_define
+#define SIM_EXCEPTION_SYSTICK	15
+#define SIM_EXCEPTION_IRQ(_IRQ_)	(16 + (_IRQ_))
+#define SIM_IRQS				68			// IRQs of the STM32F103 vector table
+
+#define SIM_STIR_IDLE			0xFFFFFFFFUL	// Left in NVIC->STIR by the simulator, a write replaces it
+
+#define SIM_MS_TO_CYCLES(_MS_)	((uint64)(_MS_) * (STK_FCPU / 1000UL))
+
+/*
+ * =============================================
+ * APIs Supported by "sim"
+ * =============================================
+ */
+
+/* Virtual clock, core and scheduler, sim_core.c */
+extern uint64 SIM_Cycles;					// Cycles since reset
+
+/**=============================================
+  * @Fn				- SIM_Boot
+  * @brief 			- Resets the simulated core and peripherals and prepares the firmware to run from its reset
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Set the reset flags with SIM_Set_Reset_Flags before the first SIM_Run_Until
+  */
+void SIM_Boot(void);
+
+/**=============================================
+  * @Fn				- SIM_Run_Until
+  * @brief 			- Runs the firmware until the virtual clock reaches a time
+  * @param [in] 	- cycles: Time to stop at, in cycles since reset
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Runs on the host stack, the firmware runs on its own stack in the simulated RAM
+  */
+void SIM_Run_Until(uint64 cycles);
+
+/**=============================================
+  * @Fn				- SIM_Pend
+  * @brief 			- Makes an exception pending
+  * @param [in] 	- exception: Exception number @ref SIM_EXCEPTION_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Taken at the next hook if it is enabled and not masked
+  */
+void SIM_Pend(uint8 exception);
+
+/**=============================================
+  * @Fn				- SIM_Fatal
+  * @brief 			- Stops the simulation with an error
+  * @param [in] 	- pText: What went wrong
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Exits with status 2
+  */
+void SIM_Fatal(const char *pText);
+
+/**=============================================
+  * @Fn				- SIM_Set_Reset_Flags
+  * @brief 			- Sets the reset flags the firmware finds in RCC->CSR
+  * @param [in] 	- flags: Bits of RCC->CSR
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_Set_Reset_Flags(uint32 flags);
+
+/**=============================================
+  * @Fn				- SIM_Flash_Load
+  * @brief 			- Fills the settings page of the flash memory from a file
+  * @param [in] 	- pPath: File written by SIM_Flash_Save, erased flash if it does not exist
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_Flash_Load(const char *pPath);
+
+/**=============================================
+  * @Fn				- SIM_Flash_Save
+  * @brief 			- Writes the settings page of the flash memory to a file
+  * @param [in] 	- pPath: File to be written
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_Flash_Save(const char *pPath);
+
+/**=============================================
+  * @Fn				- SIM_Retain_Load
+  * @brief 			- Fills the variables the firmware keeps over a reset from a file
+  * @param [in] 	- pPath: File written by SIM_Retain_Save, the variables are left at 0 if it does not exist
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The variables are the ones marked SECTION_NOINIT, gathered by the linker in sim_noinit
+  */
+void SIM_Retain_Load(const char *pPath);
+
+/**=============================================
+  * @Fn				- SIM_Retain_Save
+  * @brief 			- Writes the variables the firmware keeps over a reset to a file
+  * @param [in] 	- pPath: File to be written
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_Retain_Save(const char *pPath);
+
+/**=============================================
+  * @Fn				- SIM_Retain_Flip
+  * @brief 			- Inverts a byte of the variables the firmware keeps over a reset
+  * @param [in] 	- offset: Byte from the start of sim_noinit
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- A record damaged over the reset, the firmware must not take it
+  */
+void SIM_Retain_Flip(uint32 offset);
+
+/* HD44780 model, sim_lcd.c */
+
+/**=============================================
+  * @Fn				- SIM_LCD_Reset
+  * @brief 			- Powers the display on, 8 bit interface and blank display data RAM
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_LCD_Reset(void);
+
+/**=============================================
+  * @Fn				- SIM_LCD_Pins
+  * @brief 			- Samples the LCD bus after the firmware wrote its port
+  * @param [in] 	- odr: Output data register of the LCD port
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Data is latched on the falling edge of EN
+  */
+void SIM_LCD_Pins(uint32 odr);
+
+/**=============================================
+  * @Fn				- SIM_LCD_Get_Row
+  * @brief 			- Reads what a row of the display shows
+  * @param [in] 	- row: 0 or 1
+  * @param [out] 	- pText: LCD_DISPLAY_COLS characters and '\0', custom characters show as '#'
+  * @retval 		- None
+  * Note			- The display shift is applied, a display turned off shows blanks
+  */
+void SIM_LCD_Get_Row(uint8 row, char *pText);
+
+/**=============================================
+  * @Fn				- SIM_LCD_Take_Counts
+  * @brief 			- Reads how many bytes the firmware sent to the display and starts counting again
+  * @param [out] 	- pCommands: Instructions since the last call
+  * @param [out] 	- pWrites: Data bytes since the last call, display data or custom characters
+  * @retval 		- None
+  * Note			- A byte counts once both of its nibbles are latched
+  */
+void SIM_LCD_Take_Counts(uint32 *pCommands, uint32 *pWrites);
+
+/* Keypad matrix, sim_keypad.c */
+
+/**=============================================
+  * @Fn				- SIM_Keypad_Press
+  * @brief 			- Holds a key of the keypad down
+  * @param [in] 	- key: Key as keypad_Scan returns it, 'F' releases the keypad
+  * @param [out] 	- None
+  * @retval 		- 0 if done, 1 if the keypad has no such key
+  * Note			- One key at a time
+  */
+uint8 SIM_Keypad_Press(uint8 key);
+
+/**=============================================
+  * @Fn				- SIM_Keypad_Update
+  * @brief 			- Drives the column inputs from the row outputs and the held key
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called after every write to the keypad port
+  */
+void SIM_Keypad_Update(void);
+
+/* USART3 and its DMA channels, sim_uart.c */
+
+/**=============================================
+  * @Fn				- SIM_UART_Reset
+  * @brief 			- Clears the line in both directions
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_UART_Reset(void);
+
+/**=============================================
+  * @Fn				- SIM_UART_Next
+  * @brief 			- Time of the next thing the UART model does
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Cycles since reset, SIM_NEVER if nothing is going on
+  * Note			- Starts or stops the transfers enabled or disabled by the firmware since the last call
+  */
+uint64 SIM_UART_Next(void);
+
+/**=============================================
+  * @Fn				- SIM_UART_Run
+  * @brief 			- Moves the bytes due by now and raises the flags and interrupts
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_UART_Run(void);
+
+/**=============================================
+  * @Fn				- SIM_UART_Handled
+  * @brief 			- Clears the flags a handler of the UART cleared by reading registers
+  * @param [in] 	- exception: Handler that just returned @ref SIM_EXCEPTION_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Reads have no side effect on the simulated register blocks
+  */
+void SIM_UART_Handled(uint8 exception);
+
+/**=============================================
+  * @Fn				- SIM_UART_Send
+  * @brief 			- Queues bytes sent to the board, they arrive back to back at the baud rate
+  * @param [in] 	- pData: Bytes
+  * @param [in] 	- length: Number of bytes
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Bytes arriving while the receive DMA is off are lost and counted
+  */
+void SIM_UART_Send(const uint8 *pData, uint32 length);
+
+/**=============================================
+  * @Fn				- SIM_UART_Pending
+  * @brief 			- Number of queued bytes that did not arrive yet
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Bytes
+  * Note			- None
+  */
+uint32 SIM_UART_Pending(void);
+
+/**=============================================
+  * @Fn				- SIM_UART_Received
+  * @brief 			- Gives the bytes the board sent
+  * @param [in] 	- None
+  * @param [out] 	- pLength: Number of bytes
+  * @retval 		- Bytes sent since reset or the last SIM_UART_Clear
+  * Note			- None
+  */
+const uint8 *SIM_UART_Received(uint32 *pLength);
+
+/**=============================================
+  * @Fn				- SIM_UART_Clear
+  * @brief 			- Forgets the bytes the board sent so far
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_UART_Clear(void);
+
+/**=============================================
+  * @Fn				- SIM_UART_Lost
+  * @brief 			- Number of bytes lost because the receive DMA was off
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Bytes
+  * Note			- None
+  */
+uint32 SIM_UART_Lost(void);
+
+#endif /* HOST_SIM_SIM_H_ */
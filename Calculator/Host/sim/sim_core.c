@@ -0,0 +1,657 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : sim_core.c 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <stdint.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+#include "sim.h"
+#include "vector_driver.h"
+#include "flash_driver.h"
+#include "keypad_driver.h"
+#include "lcd_driver.h"
+
+#define SIM_THREAD_PRIORITY		0x100U		// Running priority outside of every handler, below all exceptions
+#define SIM_STK_ENABLE			(1UL<<0)
+#define SIM_STK_TICKINT			(1UL<<1)
+#define SIM_STK_COUNTFLAG		(1UL<<16)
+#define SIM_PAINT_PATTERN		0xDEADBEEFUL	// Written over the free RAM by the startup code
+#define SIM_STRINGIFY(_X_)		#_X_
+#define SIM_STRING(_X_)			SIM_STRINGIFY(_X_)
+
+/* Register blocks and core state seen by the firmware */
+NVIC_TypeDef		SIM_NVIC;
+SCB_TypeDef			SIM_SCB;
+STK_TypeDef			SIM_STK;
+DWT_TypeDef			SIM_DWT;
+vuint32_t			SIM_DEMCR;
+GPIO_TypeDef		SIM_GPIO[7];
+RCC_TypeDef			SIM_RCC;
+FLASH_TypeDef		SIM_FLASH;
+AFIO_TypeDef		SIM_AFIO;
+EXTI_TypeDef		SIM_EXTI;
+USART_TypeDef		SIM_USART3;
+DMA_TypeDef			SIM_DMA1;
+DMA_Channel_TypeDef	SIM_DMA1_Channel[7];
+uint32				SIM_Primask;
+uint32				SIM_Basepri;
+
+/* Stand-ins of the startup and linker script symbols, the host build renames _end, _estack and _Min_Stack_Size */
+uint32 g_pfnVectors[VECT_TABLE_ENTRIES];
+uint32 _sram_vectors[VECT_TABLE_ENTRIES];
+uint32 SIM_RAM[SIM_RAM_SIZE / 4] __attribute__((aligned(8)));
+__asm__(".globl SIM_Stack_Top\n\t.set SIM_Stack_Top, SIM_RAM + " SIM_STRING(SIM_RAM_SIZE) "\n\t"
+		".globl SIM_Stack_Size\n\t.set SIM_Stack_Size, " SIM_STRING(SIM_STACK_SIZE));
+
+/* Bounds the linker gives the SECTION_NOINIT variables, .noinit on the board */
+extern uint8 __start_sim_noinit[];
+extern uint8 __stop_sim_noinit[];
+
+/* Handlers of the firmware */
+extern int firmware_main(void);
+void SysTick_Handler(void);
+void DMA1_Channel2_IRQHandler(void);
+void DMA1_Channel3_IRQHandler(void);
+void USART3_IRQHandler(void);
+
+uint64 SIM_Cycles;
+
+static uint64 SIM_Yield_At;					// Firmware gives the host stack back at this time
+static ucontext_t SIM_Host_Context;
+static ucontext_t SIM_Firmware_Context;
+static uint8 SIM_Started;
+static uint32 SIM_Reset_Flags;
+
+/* NVIC state behind the set and clear registers */
+static uint32 SIM_Enabled[3];
+static uint32 SIM_Pending[3];
+static uint32 SIM_Active[3];
+static uint8 SIM_Systick_Pending;
+static uint16 SIM_Running_Priority = SIM_THREAD_PRIORITY;
+
+/* Flash operation running, SIM_NEVER if none */
+static uint64 SIM_Flash_Done;
+static uint32 SIM_Flash_Status;				// What FLASH->SR reads, the firmware clears flags by writing 1
+static uint32 SIM_Flash_Status_Shown;
+
+/**=============================================
+  * @Fn				- SIM_Fatal
+  * @brief 			- Stops the simulation with an error
+  * @param [in] 	- pText: What went wrong
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Exits with status 2
+  */
+void SIM_Fatal(const char *pText){
+	fprintf(stderr, "sim: %s at cycle %llu\n", pText, (unsigned long long)SIM_Cycles);
+	exit(2);
+}
+
+/**=============================================
+  * @Fn				- SIM_Pend
+  * @brief 			- Makes an exception pending
+  * @param [in] 	- exception: Exception number @ref SIM_EXCEPTION_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Taken at the next hook if it is enabled and not masked
+  */
+void SIM_Pend(uint8 exception){
+	uint8 irq;
+	if(SIM_EXCEPTION_SYSTICK == exception){
+		SIM_Systick_Pending = 1;
+	}
+	else if(SIM_EXCEPTION_IRQ(0) <= exception){
+		irq = exception - SIM_EXCEPTION_IRQ(0);
+		SIM_Pending[irq / 32] |= 1UL << (irq % 32);
+		NVIC->ISPR[irq / 32] = SIM_Pending[irq / 32];
+	}
+	else{
+		SIM_Fatal("exception cannot be pended");
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_Sync_NVIC
+  * @brief 			- Applies what the firmware wrote to the set, clear and trigger registers of the NVIC
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The set registers read back the state, the clear registers read 0
+  */
+static void SIM_Sync_NVIC(void){
+	uint8 index;
+	uint32 irq = NVIC->STIR;
+	if(SIM_STIR_IDLE != irq){
+		if(SIM_IRQS <= irq){
+			SIM_Fatal("NVIC->STIR written with an IRQ that does not exist");
+		}
+		else{ /* Do Nothing */ }
+		NVIC->ISPR[irq / 32] |= 1UL << (irq % 32);
+		NVIC->STIR = SIM_STIR_IDLE;
+	}
+	else{ /* Do Nothing */ }
+	for(index = 0; index < 3; index++){
+		SIM_Enabled[index] = (SIM_Enabled[index] | NVIC->ISER[index]) & ~NVIC->ICER[index];
+		SIM_Pending[index] = (SIM_Pending[index] | NVIC->ISPR[index]) & ~NVIC->ICPR[index];
+		NVIC->ISER[index] = SIM_Enabled[index];
+		NVIC->ICER[index] = 0;
+		NVIC->ISPR[index] = SIM_Pending[index];
+		NVIC->ICPR[index] = 0;
+		NVIC->IABR[index] = SIM_Active[index];
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_Group_Shift
+  * @brief 			- Bits of a priority below its preemption priority
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Shift giving the preemption priority
+  * Note			- From the PRIGROUP field of SCB->AIRCR, 4 priority bits are implemented
+  */
+static uint8 SIM_Group_Shift(void){
+	uint8 group = (uint8)((SCB->AIRCR >> 8) & 7UL);
+	return (group < 3) ? 4 : (group + 1);
+}
+
+/**=============================================
+  * @Fn				- SIM_Next_Exception
+  * @brief 			- Finds the pending exception that would be taken now
+  * @param [in] 	- wake: 1 to ignore PRIMASK, a pending interrupt wakes WFI up while interrupts are masked
+  * @param [out] 	- pPriority: Priority of the exception
+  * @retval 		- Exception number, 0 if none
+  * Note			- Lowest priority value first, then lowest exception number
+  */
+static uint8 SIM_Next_Exception(uint8 wake, uint16 *pPriority){
+	uint8 shift = SIM_Group_Shift();
+	uint8 best = 0;
+	uint16 best_priority = SIM_THREAD_PRIORITY;
+	uint16 priority;
+	uint8 irq;
+
+	if((0 != SIM_Primask) && (0 == wake)){
+		return 0;
+	}
+	else{ /* Do Nothing */ }
+	if(1 == SIM_Systick_Pending){
+		best = SIM_EXCEPTION_SYSTICK;
+		best_priority = SCB->SHP[SIM_EXCEPTION_SYSTICK - 4];
+	}
+	else{ /* Do Nothing */ }
+	for(irq = 0; irq < SIM_IRQS; irq++){
+		if(0 != (SIM_Pending[irq / 32] & SIM_Enabled[irq / 32] & (1UL << (irq % 32)))){
+			priority = NVIC->IP[irq];
+			if((0 == best) || (priority < best_priority)){
+				best = SIM_EXCEPTION_IRQ(irq);
+				best_priority = priority;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	if(0 == best){
+		return 0;
+	}
+	else if((best_priority >> shift) >= (SIM_Running_Priority >> shift)){
+		/* Same or lower preemption priority than the running code */
+		return 0;
+	}
+	else if((0 != SIM_Basepri) && ((best_priority >> shift) >= ((SIM_Basepri & 0xFFUL) >> shift))){
+		return 0;
+	}
+	else{
+		*pPriority = best_priority;
+		return best;
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_Flash_Run
+  * @brief 			- Starts and ends the operations of the flash memory
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Erase and programming take their datasheet time, errors are not modelled
+  */
+static void SIM_Flash_Run(void){
+	uint32 written = FLASH->SR;
+	uint32 page;
+	if(written != SIM_Flash_Status_Shown){
+		/* Flags written with 1 are cleared */
+		SIM_Flash_Status &= ~(written & (FLASH_SR_PGERR | FLASH_SR_WRPRTERR | FLASH_SR_EOP));
+	}
+	else{ /* Do Nothing */ }
+
+	if((SIM_NEVER != SIM_Flash_Done) && (SIM_Cycles >= SIM_Flash_Done)){
+		SIM_Flash_Done = SIM_NEVER;
+		SIM_Flash_Status = (SIM_Flash_Status & ~FLASH_SR_BSY) | FLASH_SR_EOP;
+	}
+	else if(0 != (FLASH->CR & FLASH_CR_STRT)){
+		FLASH->CR &= ~FLASH_CR_STRT;
+		if(0 != (FLASH->CR & FLASH_CR_PER)){
+			page = FLASH->AR & ~(FLASH_PAGE_SIZE - 1);
+			if((SIM_FLASH_MAP_BASE > page) || ((SIM_FLASH_MAP_BASE + SIM_FLASH_MAP_SIZE) <= page)){
+				SIM_Fatal("page erase outside of the simulated flash");
+			}
+			else{ /* Do Nothing */ }
+			memset((void*)(uintptr_t)page, 0xFF, FLASH_PAGE_SIZE);
+			SIM_Flash_Status |= FLASH_SR_BSY;
+			SIM_Flash_Done = SIM_Cycles + SIM_FLASH_ERASE_CYCLES;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if((0 != (FLASH->CR & FLASH_CR_PG)) && (SIM_NEVER == SIM_Flash_Done) && (0 == (SIM_Flash_Status & FLASH_SR_EOP))){
+		/* The half word is already in memory, only the time is simulated */
+		SIM_Flash_Status |= FLASH_SR_BSY;
+		SIM_Flash_Done = SIM_Cycles + SIM_FLASH_WRITE_CYCLES;
+	}
+	else{ /* Do Nothing */ }
+	FLASH->SR = SIM_Flash_Status;
+	SIM_Flash_Status_Shown = SIM_Flash_Status;
+}
+
+/**=============================================
+  * @Fn				- SIM_Advance
+  * @brief 			- Moves the virtual clock on and lets the peripherals do what is due
+  * @param [in] 	- cycles: Cycles to advance by
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- No interrupt is taken here, the host gets its stack back at SIM_Yield_At
+  */
+static void SIM_Advance(uint64 cycles){
+	uint64 target = SIM_Cycles + cycles;
+	uint64 step, next;
+	while(SIM_Cycles < target){
+		step = target - SIM_Cycles;
+		if(0 != (STK->CTRL & SIM_STK_ENABLE)){
+			/* A counter at 0 reloads on the next clock, else it reaches 0 after VAL clocks */
+			next = (0 == STK->VAL) ? 1 : STK->VAL;
+			step = (next < step) ? next : step;
+		}
+		else{ /* Do Nothing */ }
+		next = SIM_UART_Next();
+		if((SIM_NEVER != next) && ((next - SIM_Cycles) < step)){
+			step = (next > SIM_Cycles) ? (next - SIM_Cycles) : 0;
+		}
+		else{ /* Do Nothing */ }
+		if((SIM_NEVER != SIM_Flash_Done) && ((SIM_Flash_Done - SIM_Cycles) < step)){
+			step = (SIM_Flash_Done > SIM_Cycles) ? (SIM_Flash_Done - SIM_Cycles) : 0;
+		}
+		else{ /* Do Nothing */ }
+		if((SIM_Yield_At - SIM_Cycles) < step){
+			step = SIM_Yield_At - SIM_Cycles;
+		}
+		else{ /* Do Nothing */ }
+
+		SIM_Cycles += step;
+		if(0 != (DWT->CTRL & DWT_CTRL_CYCCNTENA)){
+			DWT->CYCCNT += (uint32)step;
+		}
+		else{ /* Do Nothing */ }
+		if((0 != step) && (0 != (STK->CTRL & SIM_STK_ENABLE))){
+			if(0 == STK->VAL){
+				STK->VAL = STK->LOAD & 0x00FFFFFFUL;
+			}
+			else{
+				STK->VAL -= (uint32)step;
+				if(0 == STK->VAL){
+					STK->CTRL |= SIM_STK_COUNTFLAG;
+					if(0 != (STK->CTRL & SIM_STK_TICKINT)){
+						SIM_Systick_Pending = 1;
+					}
+					else{ /* Do Nothing */ }
+				}
+				else{ /* Do Nothing */ }
+			}
+		}
+		else{ /* Do Nothing */ }
+		SIM_UART_Run();
+		SIM_Flash_Run();
+
+		if(SIM_Cycles >= SIM_Yield_At){
+			swapcontext(&SIM_Firmware_Context, &SIM_Host_Context);
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_Take_Interrupts
+  * @brief 			- Runs the handlers of the pending exceptions the core would take now
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Handlers run on the firmware stack and may be preempted by higher priorities
+  */
+static void SIM_Take_Interrupts(void){
+	uint16 priority;
+	uint16 previous;
+	uint8 exception;
+	uint32 *pTable;
+	uint32 handler;
+	uint8 irq;
+
+	SIM_Sync_NVIC();
+	for(exception = SIM_Next_Exception(0, &priority); 0 != exception; exception = SIM_Next_Exception(0, &priority)){
+		irq = exception - SIM_EXCEPTION_IRQ(0);
+		if(SIM_EXCEPTION_SYSTICK == exception){
+			SIM_Systick_Pending = 0;
+		}
+		else{
+			SIM_Pending[irq / 32] &= ~(1UL << (irq % 32));
+			SIM_Active[irq / 32] |= 1UL << (irq % 32);
+			NVIC->ISPR[irq / 32] = SIM_Pending[irq / 32];
+			NVIC->IABR[irq / 32] = SIM_Active[irq / 32];
+		}
+		previous = SIM_Running_Priority;
+		SIM_Running_Priority = priority;
+
+		/* The vector is fetched from the table VTOR points to */
+		pTable = (0 == SCB->VTOR) ? g_pfnVectors : (uint32*)(uintptr_t)SCB->VTOR;
+		handler = pTable[exception];
+		if(0 == handler){
+			SIM_Fatal("exception taken without a handler");
+		}
+		else{ /* Do Nothing */ }
+		SIM_Advance(SIM_EXCEPTION_CYCLES);
+		((void (*)(void))(uintptr_t)handler)();
+		SIM_UART_Handled(exception);
+
+		SIM_Running_Priority = previous;
+		if(SIM_EXCEPTION_SYSTICK != exception){
+			SIM_Active[irq / 32] &= ~(1UL << (irq % 32));
+			NVIC->IABR[irq / 32] = SIM_Active[irq / 32];
+		}
+		else{ /* Do Nothing */ }
+		SIM_Sync_NVIC();
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_Wait_For_Interrupt
+  * @brief 			- WFI, sleeps until an exception is pending that would preempt the running code
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The clock jumps to the next event, with PRIMASK set the exception is taken once it is cleared
+  */
+void SIM_Wait_For_Interrupt(void){
+	uint16 priority;
+	uint64 next;
+	SIM_Sync_NVIC();
+	while(0 == SIM_Next_Exception(1, &priority)){
+		next = SIM_Yield_At;
+		if(0 != (STK->CTRL & SIM_STK_ENABLE)){
+			next = SIM_Cycles + ((0 == STK->VAL) ? 1 : STK->VAL);
+		}
+		else{ /* Do Nothing */ }
+		next = (SIM_UART_Next() < next) ? SIM_UART_Next() : next;
+		next = (SIM_Flash_Done < next) ? SIM_Flash_Done : next;
+		next = (SIM_Yield_At < next) ? SIM_Yield_At : next;
+		SIM_Advance((next > SIM_Cycles) ? (next - SIM_Cycles) : 1);
+		SIM_Sync_NVIC();
+	}
+	SIM_Take_Interrupts();
+}
+
+/**=============================================
+  * @Fn				- SIM_Busy_Wait
+  * @brief 			- One turn of a polling loop
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_Busy_Wait(void){
+	SIM_Flash_Run();
+	SIM_Advance(SIM_POLL_CYCLES);
+	SIM_Take_Interrupts();
+}
+
+/**=============================================
+  * @Fn				- SIM_GPIO_Written
+  * @brief 			- Applies BSRR and BRR to the outputs of a port and lets the models see the pins
+  * @param [in] 	- GPIOx: Port written by the firmware
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Reads of IDR see the outputs, the keypad columns are driven by the keypad model
+  */
+void SIM_GPIO_Written(GPIO_TypeDef *GPIOx){
+	uint32 odr = GPIOx->ODR;
+	odr |= GPIOx->BSRR & 0xFFFFUL;
+	odr &= ~(GPIOx->BSRR >> 16);
+	odr &= ~(GPIOx->BRR & 0xFFFFUL);
+	GPIOx->BSRR = 0;
+	GPIOx->BRR = 0;
+	GPIOx->ODR = odr;
+	GPIOx->IDR = odr;
+	if(LCD_PORT == GPIOx){
+		SIM_LCD_Pins(odr);
+	}
+	else if(KEYPAD_PORT == GPIOx){
+		SIM_Keypad_Update();
+	}
+	else{ /* Do Nothing */ }
+	SIM_Advance(SIM_GPIO_WRITE_CYCLES);
+	SIM_Take_Interrupts();
+}
+
+/**=============================================
+  * @Fn				- SIM_Sync
+  * @brief 			- Takes the exceptions unmasked by the firmware or made pending by a register write
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- CPU_SYNC_BARRIER and the macros clearing PRIMASK and BASEPRI call it
+  */
+void SIM_Sync(void){
+	SIM_Take_Interrupts();
+}
+
+/**=============================================
+  * @Fn				- SIM_Firmware_Entry
+  * @brief 			- Reset handler, runs the firmware on its stack
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- main never returns
+  */
+static void SIM_Firmware_Entry(void){
+	firmware_main();
+	SIM_Fatal("main returned");
+}
+
+/**=============================================
+  * @Fn				- SIM_Retain_Load
+  * @brief 			- Fills the variables the firmware keeps over a reset from a file
+  * @param [in] 	- pPath: File written by SIM_Retain_Save, the variables are left at 0 if it does not exist
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The variables are the ones marked SECTION_NOINIT, gathered by the linker in sim_noinit
+  */
+void SIM_Retain_Load(const char *pPath){
+	uint32 size = (uint32)(__stop_sim_noinit - __start_sim_noinit);
+	FILE *pFile = fopen(pPath, "rb");
+	if(NULL != pFile){
+		if(size != fread(__start_sim_noinit, 1, size, pFile)){
+			SIM_Fatal("retain file does not match the build");
+		}
+		else{ /* Do Nothing */ }
+		fclose(pFile);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- SIM_Retain_Save
+  * @brief 			- Writes the variables the firmware keeps over a reset to a file
+  * @param [in] 	- pPath: File to be written
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_Retain_Save(const char *pPath){
+	uint32 size = (uint32)(__stop_sim_noinit - __start_sim_noinit);
+	FILE *pFile = fopen(pPath, "wb");
+	if((NULL == pFile) || (size != fwrite(__start_sim_noinit, 1, size, pFile))){
+		SIM_Fatal("cannot write the retain file");
+	}
+	else{ /* Do Nothing */ }
+	fclose(pFile);
+}
+
+/**=============================================
+  * @Fn				- SIM_Retain_Flip
+  * @brief 			- Inverts a byte of the variables the firmware keeps over a reset
+  * @param [in] 	- offset: Byte from the start of sim_noinit
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- A record damaged over the reset, the firmware must not take it
+  */
+void SIM_Retain_Flip(uint32 offset){
+	if((uint32)(__stop_sim_noinit - __start_sim_noinit) <= offset){
+		SIM_Fatal("byte outside of the retained variables");
+	}
+	else{ /* Do Nothing */ }
+	__start_sim_noinit[offset] ^= 0xFF;
+}
+
+/**=============================================
+  * @Fn				- SIM_Set_Reset_Flags
+  * @brief 			- Sets the reset flags the firmware finds in RCC->CSR
+  * @param [in] 	- flags: Bits of RCC->CSR
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_Set_Reset_Flags(uint32 flags){
+	SIM_Reset_Flags = flags;
+	RCC->CSR = flags;
+}
+
+/**=============================================
+  * @Fn				- SIM_Boot
+  * @brief 			- Resets the simulated core and peripherals and prepares the firmware to run from its reset
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Set the reset flags with SIM_Set_Reset_Flags before the first SIM_Run_Until
+  */
+void SIM_Boot(void){
+	uint32 index;
+	void *pMap;
+
+	memset(&SIM_NVIC, 0, sizeof(SIM_NVIC));
+	memset(&SIM_SCB, 0, sizeof(SIM_SCB));
+	memset(&SIM_STK, 0, sizeof(SIM_STK));
+	memset(&SIM_GPIO, 0, sizeof(SIM_GPIO));
+	memset(&SIM_RCC, 0, sizeof(SIM_RCC));
+	memset(&SIM_FLASH, 0, sizeof(SIM_FLASH));
+	memset(&SIM_DMA1, 0, sizeof(SIM_DMA1));
+	memset(&SIM_DMA1_Channel, 0, sizeof(SIM_DMA1_Channel));
+	memset(&SIM_USART3, 0, sizeof(SIM_USART3));
+	NVIC->STIR = SIM_STIR_IDLE;
+	SCB->CPUID = 0x411FC231UL;
+	SCB->AIRCR = 0xFA050000UL;
+	RCC->CSR = SIM_Reset_Flags;
+	FLASH->CR = FLASH_CR_LOCK;
+	SIM_Flash_Done = SIM_NEVER;
+	SIM_Yield_At = 0;
+
+	/* Columns of the keypad are pulled up */
+	SIM_Keypad_Update();
+	SIM_LCD_Reset();
+	SIM_UART_Reset();
+
+	/* Vector table of the startup file, only the handlers the firmware has */
+	g_pfnVectors[0] = (uint32)(uintptr_t)&SIM_RAM[SIM_RAM_SIZE / 4];
+	g_pfnVectors[SIM_EXCEPTION_SYSTICK] = (uint32)(uintptr_t)SysTick_Handler;
+	g_pfnVectors[SIM_EXCEPTION_IRQ(DMA1_CHANNEL2_IRQ)] = (uint32)(uintptr_t)DMA1_Channel2_IRQHandler;
+	g_pfnVectors[SIM_EXCEPTION_IRQ(DMA1_CHANNEL3_IRQ)] = (uint32)(uintptr_t)DMA1_Channel3_IRQHandler;
+	g_pfnVectors[SIM_EXCEPTION_IRQ(USART3_IRQ)] = (uint32)(uintptr_t)USART3_IRQHandler;
+
+	/* Settings page of the flash memory at its target address, -no-pie keeps the host image below it */
+	pMap = mmap((void*)SIM_FLASH_MAP_BASE, SIM_FLASH_MAP_SIZE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+	if((void*)SIM_FLASH_MAP_BASE != pMap){
+		SIM_Fatal("cannot map the flash page");
+	}
+	else{ /* Do Nothing */ }
+	memset(pMap, 0xFF, SIM_FLASH_MAP_SIZE);
+
+	/* The startup code paints the free RAM, the heap and stack high water marks are found with it */
+	for(index = 0; index < (SIM_RAM_SIZE / 4); index++){
+		SIM_RAM[index] = SIM_PAINT_PATTERN;
+	}
+	getcontext(&SIM_Firmware_Context);
+	SIM_Firmware_Context.uc_stack.ss_sp = SIM_RAM;
+	SIM_Firmware_Context.uc_stack.ss_size = SIM_RAM_SIZE;
+	SIM_Firmware_Context.uc_link = NULL;
+	makecontext(&SIM_Firmware_Context, SIM_Firmware_Entry, 0);
+	SIM_Started = 1;
+}
+
+/**=============================================
+  * @Fn				- SIM_Run_Until
+  * @brief 			- Runs the firmware until the virtual clock reaches a time
+  * @param [in] 	- cycles: Time to stop at, in cycles since reset
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Runs on the host stack, the firmware runs on its own stack in the simulated RAM
+  */
+void SIM_Run_Until(uint64 cycles){
+	if(0 == SIM_Started){
+		SIM_Fatal("SIM_Run_Until before SIM_Boot");
+	}
+	else{ /* Do Nothing */ }
+	if(cycles > SIM_Cycles){
+		SIM_Yield_At = cycles;
+		swapcontext(&SIM_Host_Context, &SIM_Firmware_Context);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- SIM_Flash_Load
+  * @brief 			- Fills the settings page of the flash memory from a file
+  * @param [in] 	- pPath: File written by SIM_Flash_Save, erased flash if it does not exist
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_Flash_Load(const char *pPath){
+	FILE *pFile = fopen(pPath, "rb");
+	if(NULL != pFile){
+		if(SIM_FLASH_MAP_SIZE != fread((void*)SIM_FLASH_MAP_BASE, 1, SIM_FLASH_MAP_SIZE, pFile)){
+			SIM_Fatal("flash file is too short");
+		}
+		else{ /* Do Nothing */ }
+		fclose(pFile);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- SIM_Flash_Save
+  * @brief 			- Writes the settings page of the flash memory to a file
+  * @param [in] 	- pPath: File to be written
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_Flash_Save(const char *pPath){
+	FILE *pFile = fopen(pPath, "wb");
+	if((NULL == pFile) || (SIM_FLASH_MAP_SIZE != fwrite((const void*)SIM_FLASH_MAP_BASE, 1, SIM_FLASH_MAP_SIZE, pFile))){
+		SIM_Fatal("cannot write the flash file");
+	}
+	else{ /* Do Nothing */ }
+	fclose(pFile);
+}
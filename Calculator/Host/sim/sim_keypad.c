@@ -0,0 +1,73 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : sim_keypad.c 			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "sim.h"
+#include "keypad_driver.h"
+
+#define SIM_KEYPAD_NONE		0xFFU
+
+/* Labels of the keypad wired to the board, as keypad_Scan returns them */
+static const uint8 SIM_Keypad_Labels[KEYPAD_ROWS][KEYPAD_COLS] = {
+		{ 7 ,  8 ,  9 , '/'},
+		{ 4 ,  5 ,  6 , 'x'},
+		{ 1 ,  2 ,  3 , '-'},
+		{'C',  0 , '=', '+'}
+};
+
+static const uint16 SIM_Keypad_Row_Pins[KEYPAD_ROWS] = {ROW0, ROW1, ROW2, ROW3};
+static const uint16 SIM_Keypad_Col_Pins[KEYPAD_COLS] = {COL0, COL1, COL2, COL3};
+
+static uint8 SIM_Keypad_Row = SIM_KEYPAD_NONE;	// Held key, SIM_KEYPAD_NONE if the keypad is released
+static uint8 SIM_Keypad_Col;
+
+/**=============================================
+  * @Fn				- SIM_Keypad_Press
+  * @brief 			- Holds a key of the keypad down
+  * @param [in] 	- key: Key as keypad_Scan returns it, 'F' releases the keypad
+  * @param [out] 	- None
+  * @retval 		- 0 if done, 1 if the keypad has no such key
+  * Note			- One key at a time
+  */
+uint8 SIM_Keypad_Press(uint8 key){
+	uint8 row, col;
+	SIM_Keypad_Row = SIM_KEYPAD_NONE;
+	for(row = 0; row < KEYPAD_ROWS; row++){
+		for(col = 0; col < KEYPAD_COLS; col++){
+			if(key == SIM_Keypad_Labels[row][col]){
+				SIM_Keypad_Row = row;
+				SIM_Keypad_Col = col;
+			}
+			else{ /* Do Nothing */ }
+		}
+	}
+	SIM_Keypad_Update();
+	return (('F' != key) && (SIM_KEYPAD_NONE == SIM_Keypad_Row)) ? 1 : 0;
+}
+
+/**=============================================
+  * @Fn				- SIM_Keypad_Update
+  * @brief 			- Drives the column inputs from the row outputs and the held key
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called after every write to the keypad port
+  */
+void SIM_Keypad_Update(void){
+	uint32 idr = KEYPAD_PORT->ODR;
+	uint8 col;
+	/* Columns are pulled up, a held key connects its column to its row */
+	for(col = 0; col < KEYPAD_COLS; col++){
+		idr |= SIM_Keypad_Col_Pins[col];
+	}
+	if((SIM_KEYPAD_NONE != SIM_Keypad_Row) && (0 == (KEYPAD_PORT->ODR & SIM_Keypad_Row_Pins[SIM_Keypad_Row]))){
+		idr &= ~(uint32)SIM_Keypad_Col_Pins[SIM_Keypad_Col];
+	}
+	else{ /* Do Nothing */ }
+	KEYPAD_PORT->IDR = idr;
+}
@@ -0,0 +1,276 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : sim_lcd.c 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <string.h>
+#include "sim.h"
+#include "lcd_driver.h"
+
+#define SIM_LCD_CGRAM_SIZE		64
+
+/* Controller state */
+static uint8 SIM_LCD_DDRAM[LCD_DDRAM_ROWS][LCD_DDRAM_ROW_SIZE];
+static uint8 SIM_LCD_CGRAM[SIM_LCD_CGRAM_SIZE];
+static uint8 SIM_LCD_Row;					// Address counter, row and column of the display data RAM
+static uint8 SIM_LCD_Column;
+static uint8 SIM_LCD_CG_Address;
+static uint8 SIM_LCD_In_CGRAM;				// 1 after a set CGRAM address, writes go to the custom characters
+static uint8 SIM_LCD_Increment;				// Entry mode I/D
+static uint8 SIM_LCD_Shift_On_Write;		// Entry mode S
+static uint8 SIM_LCD_Shift;					// Display data RAM column shown at the left edge
+static uint8 SIM_LCD_Display_On;
+static uint8 SIM_LCD_8Bit;					// Interface data length, 8 bits after power on
+static uint8 SIM_LCD_High_Nibble;			// First half of a byte in 4 bit mode
+static uint8 SIM_LCD_Have_High;
+static uint8 SIM_LCD_Enable;				// Level of EN at the last sample
+
+/* Bus counters, cleared by SIM_LCD_Take_Counts */
+static uint32 SIM_LCD_Commands;
+static uint32 SIM_LCD_Writes;
+
+/**=============================================
+  * @Fn				- SIM_LCD_Move
+  * @brief 			- Moves the address counter by one column
+  * @param [in] 	- forward: 1 to increment, 0 to decrement
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- In 2 line mode the end of a row goes on with the other row
+  */
+static void SIM_LCD_Move(uint8 forward){
+	if(1 == forward){
+		SIM_LCD_Column++;
+		if(LCD_DDRAM_ROW_SIZE == SIM_LCD_Column){
+			SIM_LCD_Column = 0;
+			SIM_LCD_Row ^= 1;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{
+		if(0 == SIM_LCD_Column){
+			SIM_LCD_Column = LCD_DDRAM_ROW_SIZE - 1;
+			SIM_LCD_Row ^= 1;
+		}
+		else{
+			SIM_LCD_Column--;
+		}
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_LCD_Shift_Display
+  * @brief 			- Shifts the display window by one column
+  * @param [in] 	- left: 1 moves the text to the left
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void SIM_LCD_Shift_Display(uint8 left){
+	if(1 == left){
+		SIM_LCD_Shift = ((LCD_DDRAM_ROW_SIZE - 1) == SIM_LCD_Shift) ? 0 : (SIM_LCD_Shift + 1);
+	}
+	else{
+		SIM_LCD_Shift = (0 == SIM_LCD_Shift) ? (LCD_DDRAM_ROW_SIZE - 1) : (SIM_LCD_Shift - 1);
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_LCD_Command
+  * @brief 			- Executes an instruction
+  * @param [in] 	- command: Instruction byte
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Busy flag reads are not modelled, RW is expected low
+  */
+static void SIM_LCD_Command(uint8 command){
+	if(0 != (command & 0x80)){
+		SIM_LCD_In_CGRAM = 0;
+		SIM_LCD_Row = (0 != (command & 0x40)) ? 1 : 0;
+		SIM_LCD_Column = command & 0x3F;
+		if(LCD_DDRAM_ROW_SIZE <= SIM_LCD_Column){
+			SIM_Fatal("LCD DDRAM address past the end of the row");
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(0 != (command & 0x40)){
+		SIM_LCD_In_CGRAM = 1;
+		SIM_LCD_CG_Address = command & 0x3F;
+	}
+	else if(0 != (command & 0x20)){
+		/* Function set, DL selects the interface */
+		SIM_LCD_8Bit = (0 != (command & 0x10)) ? 1 : 0;
+		SIM_LCD_Have_High = 0;
+	}
+	else if(0 != (command & 0x10)){
+		if(0 != (command & 0x08)){
+			SIM_LCD_Shift_Display((0 == (command & 0x04)) ? 1 : 0);
+		}
+		else{
+			SIM_LCD_Move((0 != (command & 0x04)) ? 1 : 0);
+		}
+	}
+	else if(0 != (command & 0x08)){
+		SIM_LCD_Display_On = (0 != (command & 0x04)) ? 1 : 0;
+	}
+	else if(0 != (command & 0x04)){
+		SIM_LCD_Increment = (0 != (command & 0x02)) ? 1 : 0;
+		SIM_LCD_Shift_On_Write = command & 0x01;
+	}
+	else if(0 != (command & 0x02)){
+		SIM_LCD_In_CGRAM = 0;
+		SIM_LCD_Row = 0;
+		SIM_LCD_Column = 0;
+		SIM_LCD_Shift = 0;
+	}
+	else if(0 != (command & 0x01)){
+		memset(SIM_LCD_DDRAM, ' ', sizeof(SIM_LCD_DDRAM));
+		SIM_LCD_In_CGRAM = 0;
+		SIM_LCD_Row = 0;
+		SIM_LCD_Column = 0;
+		SIM_LCD_Shift = 0;
+		SIM_LCD_Increment = 1;
+	}
+	else{ /* Do Nothing, 0x00 is no instruction */ }
+}
+
+/**=============================================
+  * @Fn				- SIM_LCD_Data
+  * @brief 			- Writes a byte to the display data RAM or the character generator RAM
+  * @param [in] 	- data: Written byte
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void SIM_LCD_Data(uint8 data){
+	if(1 == SIM_LCD_In_CGRAM){
+		SIM_LCD_CGRAM[SIM_LCD_CG_Address] = data & 0x1F;
+		SIM_LCD_CG_Address = (SIM_LCD_CG_Address + ((1 == SIM_LCD_Increment) ? 1 : (SIM_LCD_CGRAM_SIZE - 1))) % SIM_LCD_CGRAM_SIZE;
+	}
+	else{
+		SIM_LCD_DDRAM[SIM_LCD_Row][SIM_LCD_Column] = data;
+		SIM_LCD_Move(SIM_LCD_Increment);
+		if(1 == SIM_LCD_Shift_On_Write){
+			SIM_LCD_Shift_Display(SIM_LCD_Increment);
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_LCD_Reset
+  * @brief 			- Powers the display on, 8 bit interface and blank display data RAM
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_LCD_Reset(void){
+	memset(SIM_LCD_DDRAM, ' ', sizeof(SIM_LCD_DDRAM));
+	memset(SIM_LCD_CGRAM, 0, sizeof(SIM_LCD_CGRAM));
+	SIM_LCD_Row = 0;
+	SIM_LCD_Column = 0;
+	SIM_LCD_CG_Address = 0;
+	SIM_LCD_In_CGRAM = 0;
+	SIM_LCD_Increment = 1;
+	SIM_LCD_Shift_On_Write = 0;
+	SIM_LCD_Shift = 0;
+	SIM_LCD_Display_On = 0;
+	SIM_LCD_8Bit = 1;
+	SIM_LCD_Have_High = 0;
+	SIM_LCD_Enable = 0;
+}
+
+/**=============================================
+  * @Fn				- SIM_LCD_Pins
+  * @brief 			- Samples the LCD bus after the firmware wrote its port
+  * @param [in] 	- odr: Output data register of the LCD port
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Data is latched on the falling edge of EN
+  */
+void SIM_LCD_Pins(uint32 odr){
+	uint8 enable = (0 != (odr & EN_PIN)) ? 1 : 0;
+	uint8 nibble, value;
+	if((1 == SIM_LCD_Enable) && (0 == enable)){
+		if(0 != (odr & RW_PIN)){
+			SIM_Fatal("LCD read cycles are not modelled");
+		}
+		else{ /* Do Nothing */ }
+		nibble = (uint8)((((odr & D4_PIN) ? 1 : 0) | ((odr & D5_PIN) ? 2 : 0) | ((odr & D6_PIN) ? 4 : 0) | ((odr & D7_PIN) ? 8 : 0)));
+		if(1 == SIM_LCD_8Bit){
+			/* D0...D3 are not wired, they read as 0 */
+			value = nibble << 4;
+		}
+		else if(0 == SIM_LCD_Have_High){
+			SIM_LCD_High_Nibble = nibble;
+			SIM_LCD_Have_High = 1;
+			value = 0;
+		}
+		else{
+			value = (SIM_LCD_High_Nibble << 4) | nibble;
+			SIM_LCD_Have_High = 0;
+		}
+
+		if((1 == SIM_LCD_8Bit) || (0 == SIM_LCD_Have_High)){
+			if(0 != (odr & RS_PIN)){
+				SIM_LCD_Writes++;
+				SIM_LCD_Data(value);
+			}
+			else{
+				SIM_LCD_Commands++;
+				SIM_LCD_Command(value);
+			}
+		}
+		else{ /* Do Nothing, waiting for the second nibble */ }
+	}
+	else{ /* Do Nothing */ }
+	SIM_LCD_Enable = enable;
+}
+
+/**=============================================
+  * @Fn				- SIM_LCD_Get_Row
+  * @brief 			- Reads what a row of the display shows
+  * @param [in] 	- row: 0 or 1
+  * @param [out] 	- pText: LCD_DISPLAY_COLS characters and '\0', custom characters show as '#'
+  * @retval 		- None
+  * Note			- The display shift is applied, a display turned off shows blanks
+  */
+void SIM_LCD_Get_Row(uint8 row, char *pText){
+	uint8 column;
+	uint8 code;
+	for(column = 0; column < LCD_DISPLAY_COLS; column++){
+		code = SIM_LCD_DDRAM[row][(SIM_LCD_Shift + column) % LCD_DDRAM_ROW_SIZE];
+		if(0 == SIM_LCD_Display_On){
+			pText[column] = ' ';
+		}
+		else if(0x10 > code){
+			pText[column] = '#';
+		}
+		else if((0x20 > code) || (0x7E < code)){
+			pText[column] = '?';
+		}
+		else{
+			pText[column] = (char)code;
+		}
+	}
+	pText[LCD_DISPLAY_COLS] = '\0';
+}
+
+/**=============================================
+  * @Fn				- SIM_LCD_Take_Counts
+  * @brief 			- Reads how many bytes the firmware sent to the display and starts counting again
+  * @param [out] 	- pCommands: Instructions since the last call
+  * @param [out] 	- pWrites: Data bytes since the last call, display data or custom characters
+  * @retval 		- None
+  * Note			- A byte counts once both of its nibbles are latched
+  */
+void SIM_LCD_Take_Counts(uint32 *pCommands, uint32 *pWrites){
+	*pCommands = SIM_LCD_Commands;
+	*pWrites = SIM_LCD_Writes;
+	SIM_LCD_Commands = 0;
+	SIM_LCD_Writes = 0;
+}
@@ -0,0 +1,376 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : sim_main.c 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <string.h>
+#include <stdlib.h>
+#include "sim.h"
+#include "lcd_driver.h"
+
+#define SIM_LINE_MAX			1024
+#define SIM_KEY_HOLD_MS			50			// Key tap, longer than a keypad scan period
+#define SIM_KEY_GAP_MS			50			// Released time after a tap, longer than KEYPAD_RELEASE_SCANS scans
+
+/* Causes of a reset, as RCC->CSR gives them, the reset pin is also pulled by the internal resets */
+typedef struct{
+	const char *pName;
+	uint32 flags;
+}sim_reset_t;
+static const sim_reset_t SIM_Resets[] = {
+		{"power", RCC_CSR_PINRSTF | RCC_CSR_PORRSTF},
+		{"pin", RCC_CSR_PINRSTF},
+		{"software", RCC_CSR_PINRSTF | RCC_CSR_SFTRSTF},
+		{"iwdg", RCC_CSR_PINRSTF | RCC_CSR_IWDGRSTF},
+		{"wwdg", RCC_CSR_PINRSTF | RCC_CSR_WWDGRSTF}
+};
+#define SIM_RESETS				(sizeof(SIM_Resets) / sizeof(SIM_Resets[0]))
+
+/*
+ * Scripts drive the board, one command per line, '#' starts a comment:
+ *   wait <ms>              runs the firmware for a time
+ *   press <key>            holds a key down, 0...9 + - x / = C, * is x
+ *   release                lets the keypad go
+ *   key <key> [<ms>]       taps a key, held for <ms>
+ *   keys <keys>            taps every key of the word, "12+3="
+ *   expect <row> "<text>"  row 1 or 2 of the display must show the text, padded with blanks
+ *   screen                 prints the display
+ *   send "<text>"          sends the text to the UART of the board, \n and \\ escapes
+ *   expect_uart "<text>"   what the board sent since the last check must be the text
+ *   print_uart             prints what the board sent since the last check
+ *   save_uart "<file>"     writes what the board sent since the last check to a file
+ */
+
+static uint32 SIM_Failures;
+static const char *SIM_Script_Name;
+static uint32 SIM_Script_Line;
+
+/**=============================================
+  * @Fn				- SIM_Wait_Ms
+  * @brief 			- Runs the firmware for a time
+  * @param [in] 	- ms: Milliseconds of virtual time
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void SIM_Wait_Ms(uint32 ms){
+	SIM_Run_Until(SIM_Cycles + SIM_MS_TO_CYCLES(ms));
+}
+
+/**=============================================
+  * @Fn				- SIM_Fail
+  * @brief 			- Reports a failed check of the script
+  * @param [in] 	- pText: What was expected
+  * @param [in] 	- pSeen: What was found
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The script goes on
+  */
+static void SIM_Fail(const char *pText, const char *pSeen){
+	fprintf(stderr, "%s:%u: expected \"%s\", got \"%s\"\n", SIM_Script_Name, SIM_Script_Line, pText, pSeen);
+	SIM_Failures++;
+}
+
+/**=============================================
+  * @Fn				- SIM_Key_Code
+  * @brief 			- Converts a key name to the key keypad_Scan returns
+  * @param [in] 	- name: Character of the key
+  * @param [out] 	- None
+  * @retval 		- Key, 'F' if there is no such key
+  * Note			- None
+  */
+static uint8 SIM_Key_Code(char name){
+	if(('0' <= name) && ('9' >= name)){
+		return (uint8)(name - '0');
+	}
+	else if('*' == name){
+		return 'x';
+	}
+	else if(NULL != strchr("+-x/=C", name)){
+		return (uint8)name;
+	}
+	else{
+		return 'F';
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_Tap
+  * @brief 			- Presses and releases a key
+  * @param [in] 	- name: Character of the key
+  * @param [in] 	- hold_ms: Time the key is held
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void SIM_Tap(char name, uint32 hold_ms){
+	if((1 == SIM_Keypad_Press(SIM_Key_Code(name))) || ('F' == SIM_Key_Code(name))){
+		SIM_Fail("a key of the keypad", (char[]){name, '\0'});
+		return;
+	}
+	else{ /* Do Nothing */ }
+	SIM_Wait_Ms(hold_ms);
+	(void)SIM_Keypad_Press('F');
+	SIM_Wait_Ms(SIM_KEY_GAP_MS);
+}
+
+/**=============================================
+  * @Fn				- SIM_Unquote
+  * @brief 			- Reads a quoted argument with its escapes
+  * @param [in] 	- pArgument: Text starting with '"'
+  * @param [out] 	- pText: Argument without the quotes, escapes replaced
+  * @retval 		- Length of pText
+  * Note			- An argument without quotes is taken as it is
+  */
+static uint32 SIM_Unquote(const char *pArgument, char *pText){
+	uint32 length = 0;
+	uint8 quoted = ('"' == *pArgument) ? 1 : 0;
+	pArgument += quoted;
+	while(('\0' != *pArgument) && !((1 == quoted) && ('"' == *pArgument))){
+		if(('\\' == pArgument[0]) && ('n' == pArgument[1])){
+			pText[length++] = '\n';
+			pArgument += 2;
+		}
+		else if(('\\' == pArgument[0]) && ('\0' != pArgument[1])){
+			pText[length++] = pArgument[1];
+			pArgument += 2;
+		}
+		else{
+			pText[length++] = *pArgument++;
+		}
+	}
+	pText[length] = '\0';
+	return length;
+}
+
+/**=============================================
+  * @Fn				- SIM_Print_Screen
+  * @brief 			- Prints the display between frame lines
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void SIM_Print_Screen(void){
+	char row[LCD_DISPLAY_COLS + 1];
+	printf("+----------------+ %llu ms\n", (unsigned long long)(SIM_Cycles / SIM_MS_TO_CYCLES(1)));
+	SIM_LCD_Get_Row(0, row);
+	printf("|%s|\n", row);
+	SIM_LCD_Get_Row(1, row);
+	printf("|%s|\n", row);
+	printf("+----------------+\n");
+}
+
+/**=============================================
+  * @Fn				- SIM_Command
+  * @brief 			- Runs one line of a script
+  * @param [in] 	- pLine: Line without its end of line
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Unknown commands stop the simulation
+  */
+static void SIM_Command(char *pLine){
+	char text[SIM_LINE_MAX];
+	char row[LCD_DISPLAY_COLS + 1];
+	char *pArgument;
+	const uint8 *pSent;
+	uint32 length;
+	uint32 value;
+	uint32 commands, writes;
+	FILE *pFile;
+
+	pLine[strcspn(pLine, "#\r\n")] = '\0';
+	pLine += strspn(pLine, " \t");
+	if('\0' == *pLine){
+		return;
+	}
+	else{ /* Do Nothing */ }
+	pArgument = pLine + strcspn(pLine, " \t");
+	if('\0' != *pArgument){
+		*pArgument++ = '\0';
+		pArgument += strspn(pArgument, " \t");
+	}
+	else{ /* Do Nothing */ }
+
+	if(0 == strcmp(pLine, "wait")){
+		SIM_Wait_Ms((uint32)strtoul(pArgument, NULL, 10));
+	}
+	else if(0 == strcmp(pLine, "press")){
+		if(1 == SIM_Keypad_Press(SIM_Key_Code(*pArgument))){
+			SIM_Fail("a key of the keypad", pArgument);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(0 == strcmp(pLine, "release")){
+		(void)SIM_Keypad_Press('F');
+	}
+	else if(0 == strcmp(pLine, "key")){
+		value = (uint32)strtoul(pArgument + 1, NULL, 10);
+		SIM_Tap(*pArgument, (0 == value) ? SIM_KEY_HOLD_MS : value);
+	}
+	else if(0 == strcmp(pLine, "keys")){
+		while(('\0' != *pArgument) && (' ' != *pArgument)){
+			SIM_Tap(*pArgument++, SIM_KEY_HOLD_MS);
+		}
+	}
+	else if(0 == strcmp(pLine, "expect")){
+		value = (uint32)strtoul(pArgument, &pArgument, 10);
+		pArgument += strspn(pArgument, " \t");
+		length = SIM_Unquote(pArgument, text);
+		while(LCD_DISPLAY_COLS > length){
+			text[length++] = ' ';
+		}
+		text[length] = '\0';
+		SIM_LCD_Get_Row((2 == value) ? 1 : 0, row);
+		if(0 != strcmp(text, row)){
+			SIM_Fail(text, row);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(0 == strcmp(pLine, "expect_lcd")){
+		value = (uint32)strtoul(pArgument, &pArgument, 10);
+		length = (uint32)strtoul(pArgument, NULL, 10);
+		SIM_LCD_Take_Counts(&commands, &writes);
+		if((value != commands) || (length != writes)){
+			(void)snprintf(text, sizeof(text), "%u %u", (unsigned)value, (unsigned)length);
+			(void)snprintf(row, sizeof(row), "%u %u", (unsigned)commands, (unsigned)writes);
+			SIM_Fail(text, row);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(0 == strcmp(pLine, "screen")){
+		SIM_Print_Screen();
+	}
+	else if(0 == strcmp(pLine, "send")){
+		length = SIM_Unquote(pArgument, text);
+		SIM_UART_Send((const uint8*)text, length);
+	}
+	else if(0 == strcmp(pLine, "expect_uart")){
+		(void)SIM_Unquote(pArgument, text);
+		pSent = SIM_UART_Received(&length);
+		if((strlen(text) != length) || (0 != memcmp(text, pSent, length))){
+			SIM_Fail(text, (const char*)pSent);
+		}
+		else{ /* Do Nothing */ }
+		SIM_UART_Clear();
+	}
+	else if(0 == strcmp(pLine, "print_uart")){
+		pSent = SIM_UART_Received(&length);
+		fwrite(pSent, 1, length, stdout);
+		SIM_UART_Clear();
+	}
+	else if(0 == strcmp(pLine, "save_uart")){
+		(void)SIM_Unquote(pArgument, text);
+		pFile = fopen(text, "wb");
+		if(NULL == pFile){
+			fprintf(stderr, "%s:%u: cannot write %s\n", SIM_Script_Name, SIM_Script_Line, text);
+			exit(2);
+		}
+		else{ /* Do Nothing */ }
+		pSent = SIM_UART_Received(&length);
+		fwrite(pSent, 1, length, pFile);
+		fclose(pFile);
+		SIM_UART_Clear();
+	}
+	else{
+		fprintf(stderr, "%s:%u: unknown command \"%s\"\n", SIM_Script_Name, SIM_Script_Line, pLine);
+		exit(2);
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_Run_Script
+  * @brief 			- Runs every line of a script file
+  * @param [in] 	- pPath: Script, "-" for the standard input
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void SIM_Run_Script(const char *pPath){
+	char line[SIM_LINE_MAX];
+	FILE *pFile = (0 == strcmp(pPath, "-")) ? stdin : fopen(pPath, "r");
+	if(NULL == pFile){
+		fprintf(stderr, "sim: cannot open %s\n", pPath);
+		exit(2);
+	}
+	else{ /* Do Nothing */ }
+	SIM_Script_Name = pPath;
+	SIM_Script_Line = 0;
+	while(NULL != fgets(line, sizeof(line), pFile)){
+		SIM_Script_Line++;
+		SIM_Command(line);
+	}
+	if(stdin != pFile){
+		fclose(pFile);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- main
+  * @brief 			- Boots the firmware and runs the scripts given on the command line
+  * @param [in] 	- argc, argv: [--reset <cause>] [--flash <file>] [--retain <file> [--flip <byte>]] [--screen] <script>...
+  * @param [out] 	- None
+  * @retval 		- 0 if every check passed, 1 if one failed, 2 on errors
+  * Note			- --reset gives the cause of the reset in RCC->CSR, power, pin, software, iwdg or wwdg, power if not given,
+  * 				  --flash keeps the settings page in a file from one run to the next,
+  * 				  --retain keeps the SECTION_NOINIT variables in a file the same way, --flip inverts one byte of them,
+  * 				  --screen prints the display at the end
+  */
+int main(int argc, char *argv[]){
+	const char *pFlash = NULL;
+	const char *pRetain = NULL;
+	uint8 screen = 0;
+	uint8 reset;
+	int index;
+
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	SIM_Set_Reset_Flags(SIM_Resets[0].flags);
+	SIM_Boot();
+	for(index = 1; index < argc; index++){
+		if((0 == strcmp(argv[index], "--reset")) && ((index + 1) < argc)){
+			index++;
+			for(reset = 0; (reset < SIM_RESETS) && (0 != strcmp(argv[index], SIM_Resets[reset].pName)); reset++){
+			}
+			if(SIM_RESETS == reset){
+				SIM_Fatal("unknown cause of reset");
+			}
+			else{ /* Do Nothing */ }
+			SIM_Set_Reset_Flags(SIM_Resets[reset].flags);
+		}
+		else if((0 == strcmp(argv[index], "--flash")) && ((index + 1) < argc)){
+			pFlash = argv[++index];
+			SIM_Flash_Load(pFlash);
+		}
+		else if((0 == strcmp(argv[index], "--retain")) && ((index + 1) < argc)){
+			pRetain = argv[++index];
+			SIM_Retain_Load(pRetain);
+		}
+		else if((0 == strcmp(argv[index], "--flip")) && ((index + 1) < argc)){
+			SIM_Retain_Flip((uint32)strtoul(argv[++index], NULL, 10));
+		}
+		else if(0 == strcmp(argv[index], "--screen")){
+			screen = 1;
+		}
+		else{
+			SIM_Run_Script(argv[index]);
+		}
+	}
+	if(1 == screen){
+		SIM_Print_Screen();
+	}
+	else{ /* Do Nothing */ }
+	if(NULL != pFlash){
+		SIM_Flash_Save(pFlash);
+	}
+	else{ /* Do Nothing */ }
+	if(NULL != pRetain){
+		SIM_Retain_Save(pRetain);
+	}
+	else{ /* Do Nothing */ }
+	return (0 == SIM_Failures) ? 0 : 1;
+}
@@ -0,0 +1,327 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : sim_uart.c 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+#include "sim.h"
+#include "uart_driver.h"
+
+#define SIM_UART_CAPTURE_SIZE	(4UL * 1024UL * 1024UL)	// Bytes sent by the board kept for the host
+#define SIM_UART_INPUT_SIZE		(1UL * 1024UL * 1024UL)	// Bytes queued for the board
+#define SIM_UART_CHANNELS		7
+
+/* Transmit DMA, a byte leaves the line every frame */
+static uint8 SIM_UART_TX_Running;
+static const uint8 *SIM_UART_TX_Data;
+static uint64 SIM_UART_TX_Next;				// Time the next byte is out
+
+/* Receive DMA, circular, the firmware buffer is written at its base + size - CNDTR */
+static uint8 SIM_UART_RX_Running;
+static uint8 *SIM_UART_RX_Base;
+static uint32 SIM_UART_RX_Size;
+static uint64 SIM_UART_RX_Next;				// Time the next queued byte has arrived
+static uint64 SIM_UART_Idle_At;				// Time the line is seen idle after the last byte, SIM_NEVER if not armed
+static uint32 SIM_UART_Lost_Bytes;
+
+static uint8 SIM_UART_Input[SIM_UART_INPUT_SIZE];
+static uint32 SIM_UART_Input_Head;
+static uint32 SIM_UART_Input_Tail;
+static uint8 SIM_UART_Capture[SIM_UART_CAPTURE_SIZE];
+static uint32 SIM_UART_Captured;
+
+/**=============================================
+  * @Fn				- SIM_UART_Frame
+  * @brief 			- Length of one character on the line
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Cycles, start bit, 8 data bits and the stop bits at the programmed baud rate
+  * Note			- The USART clock is the core clock, UART_PCLK
+  */
+static uint64 SIM_UART_Frame(void){
+	uint32 bits = (0 != (UART_INSTANCE->CR2 & ((uint32)UART_STOP_BITS_2 << UART_CR2_STOP_POS))) ? 11 : 10;
+	uint32 brr = UART_INSTANCE->BRR;
+	if(0 == brr){
+		/* Not configured yet, what arrives is lost anyway */
+		brr = UART_PCLK / 115200UL;
+	}
+	else if(16 > brr){
+		SIM_Fatal("USART BRR below 16, the baud rate is too high for UART_PCLK");
+	}
+	else{ /* Do Nothing */ }
+	return (uint64)bits * brr * (STK_FCPU / UART_PCLK);
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Clear_Flags
+  * @brief 			- Applies DMA->IFCR, flags written with 1 are cleared
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- A global flag clears the 4 flags of its channel
+  */
+static void SIM_UART_Clear_Flags(void){
+	uint32 clear = UART_DMA->IFCR;
+	uint8 channel;
+	for(channel = 1; channel <= SIM_UART_CHANNELS; channel++){
+		if(0 != (clear & DMA_ISR_GIF(channel))){
+			clear |= 0x0FUL << ((channel - 1) * 4);
+		}
+		else{ /* Do Nothing */ }
+	}
+	UART_DMA->ISR &= ~clear;
+	UART_DMA->IFCR = 0;
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Reset
+  * @brief 			- Clears the line in both directions
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_UART_Reset(void){
+	SIM_UART_TX_Running = 0;
+	SIM_UART_RX_Running = 0;
+	SIM_UART_Idle_At = SIM_NEVER;
+	SIM_UART_Lost_Bytes = 0;
+	SIM_UART_Input_Head = 0;
+	SIM_UART_Input_Tail = 0;
+	SIM_UART_Captured = 0;
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Next
+  * @brief 			- Time of the next thing the UART model does
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Cycles since reset, SIM_NEVER if nothing is going on
+  * Note			- Starts or stops the transfers enabled or disabled by the firmware since the last call
+  */
+uint64 SIM_UART_Next(void){
+	uint64 next = SIM_NEVER;
+	uint8 enabled;
+
+	/* Transmit channel enabled or disabled by the firmware */
+	enabled = (0 != (UART_DMA_TX->CCR & DMA_CCR_EN)) ? 1 : 0;
+	if((1 == enabled) && (0 == SIM_UART_TX_Running) && (0 != UART_DMA_TX->CNDTR)){
+		SIM_UART_TX_Running = 1;
+		SIM_UART_TX_Data = (const uint8*)(uintptr_t)UART_DMA_TX->CMAR;
+		SIM_UART_TX_Next = SIM_Cycles + SIM_UART_Frame();
+	}
+	else if(0 == enabled){
+		SIM_UART_TX_Running = 0;
+	}
+	else{ /* Do Nothing */ }
+
+	enabled = ((0 != (UART_DMA_RX->CCR & DMA_CCR_EN)) && (0 != (UART_INSTANCE->CR3 & UART_CR3_DMAR))) ? 1 : 0;
+	if((1 == enabled) && (0 == SIM_UART_RX_Running)){
+		SIM_UART_RX_Running = 1;
+		SIM_UART_RX_Base = (uint8*)(uintptr_t)UART_DMA_RX->CMAR;
+		SIM_UART_RX_Size = UART_DMA_RX->CNDTR;
+	}
+	else if(0 == enabled){
+		SIM_UART_RX_Running = 0;
+	}
+	else{ /* Do Nothing */ }
+
+	if(1 == SIM_UART_TX_Running){
+		next = SIM_UART_TX_Next;
+	}
+	else{ /* Do Nothing */ }
+	if((SIM_UART_Input_Head != SIM_UART_Input_Tail) && (SIM_UART_RX_Next < next)){
+		next = SIM_UART_RX_Next;
+	}
+	else{ /* Do Nothing */ }
+	if(SIM_UART_Idle_At < next){
+		next = SIM_UART_Idle_At;
+	}
+	else{ /* Do Nothing */ }
+	return next;
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Receive_Byte
+  * @brief 			- A byte arrived, the receive DMA stores it
+  * @param [in] 	- byte: Received byte
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Half transfer and transfer complete flags as the DMA sets them
+  */
+static void SIM_UART_Receive_Byte(uint8 byte){
+	uint32 left = UART_DMA_RX->CNDTR;
+	if((0 == SIM_UART_RX_Running) || (0 == left) || (0 == (UART_INSTANCE->CR1 & UART_CR1_RE))){
+		SIM_UART_Lost_Bytes++;
+		return;
+	}
+	else{ /* Do Nothing */ }
+	SIM_UART_RX_Base[SIM_UART_RX_Size - left] = byte;
+	left--;
+	if((SIM_UART_RX_Size / 2) == left){
+		UART_DMA->ISR |= DMA_ISR_GIF(UART_DMA_RX_CH) | DMA_ISR_HTIF(UART_DMA_RX_CH);
+		if(0 != (UART_DMA_RX->CCR & DMA_CCR_HTIE)){
+			SIM_Pend(SIM_EXCEPTION_IRQ(DMA1_CHANNEL3_IRQ));
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(0 == left){
+		UART_DMA->ISR |= DMA_ISR_GIF(UART_DMA_RX_CH) | DMA_ISR_TCIF(UART_DMA_RX_CH);
+		if(0 != (UART_DMA_RX->CCR & DMA_CCR_TCIE)){
+			SIM_Pend(SIM_EXCEPTION_IRQ(DMA1_CHANNEL3_IRQ));
+		}
+		else{ /* Do Nothing */ }
+		left = (0 != (UART_DMA_RX->CCR & DMA_CCR_CIRC)) ? SIM_UART_RX_Size : 0;
+	}
+	else{ /* Do Nothing */ }
+	UART_DMA_RX->CNDTR = left;
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Run
+  * @brief 			- Moves the bytes due by now and raises the flags and interrupts
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_UART_Run(void){
+	SIM_UART_Clear_Flags();
+	(void)SIM_UART_Next();
+
+	while((1 == SIM_UART_TX_Running) && (SIM_Cycles >= SIM_UART_TX_Next)){
+		if(SIM_UART_CAPTURE_SIZE > SIM_UART_Captured){
+			SIM_UART_Capture[SIM_UART_Captured++] = *SIM_UART_TX_Data;
+		}
+		else{
+			SIM_Fatal("UART capture buffer is full");
+		}
+		SIM_UART_TX_Data++;
+		UART_DMA_TX->CNDTR--;
+		if(0 == UART_DMA_TX->CNDTR){
+			SIM_UART_TX_Running = 0;
+			UART_DMA->ISR |= DMA_ISR_GIF(UART_DMA_TX_CH) | DMA_ISR_TCIF(UART_DMA_TX_CH);
+			if(0 != (UART_DMA_TX->CCR & DMA_CCR_TCIE)){
+				SIM_Pend(SIM_EXCEPTION_IRQ(DMA1_CHANNEL2_IRQ));
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{
+			SIM_UART_TX_Next += SIM_UART_Frame();
+		}
+	}
+
+	while((SIM_UART_Input_Head != SIM_UART_Input_Tail) && (SIM_Cycles >= SIM_UART_RX_Next)){
+		SIM_UART_Receive_Byte(SIM_UART_Input[SIM_UART_Input_Tail]);
+		SIM_UART_Input_Tail = (SIM_UART_Input_Tail + 1) % SIM_UART_INPUT_SIZE;
+		SIM_UART_Idle_At = SIM_UART_RX_Next + SIM_UART_Frame();
+		SIM_UART_RX_Next += SIM_UART_Frame();
+	}
+
+	if((SIM_NEVER != SIM_UART_Idle_At) && (SIM_Cycles >= SIM_UART_Idle_At)){
+		SIM_UART_Idle_At = SIM_NEVER;
+		UART_INSTANCE->SR |= UART_SR_IDLE;
+		if(0 != (UART_INSTANCE->CR1 & UART_CR1_IDLEIE)){
+			SIM_Pend(SIM_EXCEPTION_IRQ(USART3_IRQ));
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Handled
+  * @brief 			- Clears the flags a handler of the UART cleared by reading registers
+  * @param [in] 	- exception: Handler that just returned @ref SIM_EXCEPTION_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Reads have no side effect on the simulated register blocks
+  */
+void SIM_UART_Handled(uint8 exception){
+	if(SIM_EXCEPTION_IRQ(USART3_IRQ) == exception){
+		/* The handler read SR then DR */
+		UART_INSTANCE->SR &= ~UART_SR_IDLE;
+	}
+	else{ /* Do Nothing */ }
+	SIM_UART_Clear_Flags();
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Send
+  * @brief 			- Queues bytes sent to the board, they arrive back to back at the baud rate
+  * @param [in] 	- pData: Bytes
+  * @param [in] 	- length: Number of bytes
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Bytes arriving while the receive DMA is off are lost and counted
+  */
+void SIM_UART_Send(const uint8 *pData, uint32 length){
+	uint32 index;
+	if(SIM_UART_Input_Head == SIM_UART_Input_Tail){
+		/* Line was idle, the first byte takes one frame from now */
+		SIM_UART_RX_Next = SIM_Cycles + SIM_UART_Frame();
+	}
+	else{ /* Do Nothing */ }
+	for(index = 0; index < length; index++){
+		SIM_UART_Input[SIM_UART_Input_Head] = pData[index];
+		SIM_UART_Input_Head = (SIM_UART_Input_Head + 1) % SIM_UART_INPUT_SIZE;
+		if(SIM_UART_Input_Head == SIM_UART_Input_Tail){
+			SIM_Fatal("UART input queue is full");
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Pending
+  * @brief 			- Number of queued bytes that did not arrive yet
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Bytes
+  * Note			- None
+  */
+uint32 SIM_UART_Pending(void){
+	return (SIM_UART_Input_Head + SIM_UART_INPUT_SIZE - SIM_UART_Input_Tail) % SIM_UART_INPUT_SIZE;
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Received
+  * @brief 			- Gives the bytes the board sent
+  * @param [in] 	- None
+  * @param [out] 	- pLength: Number of bytes
+  * @retval 		- Bytes sent since reset or the last SIM_UART_Clear
+  * Note			- None
+  */
+const uint8 *SIM_UART_Received(uint32 *pLength){
+	*pLength = SIM_UART_Captured;
+	return SIM_UART_Capture;
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Clear
+  * @brief 			- Forgets the bytes the board sent so far
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void SIM_UART_Clear(void){
+	SIM_UART_Captured = 0;
+}
+
+/**=============================================
+  * @Fn				- SIM_UART_Lost
+  * @brief 			- Number of bytes lost because the receive DMA was off
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Bytes
+  * Note			- None
+  */
+uint32 SIM_UART_Lost(void){
+	return SIM_UART_Lost_Bytes;
+}
@@ -0,0 +1,199 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : map_ram.c 			                                 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Platform_Types.h"
+
+/*
+ * RAM report of a GNU ld map file:
+ *   map_ram <file>
+ * Prints the RAM output sections with their sizes, the bytes every object file puts in each of them and the
+ * largest variables. Only the memory map part of the file is read, the discarded input sections are not counted.
+ * Sizes of the output sections include the alignment fill, the sums of the objects do not.
+ */
+
+#define MAP_LINE_SIZE		512
+#define MAP_NAME_SIZE		64
+#define MAP_OBJECTS_MAX		64
+#define MAP_VARIABLES_MAX	512
+#define MAP_LARGEST			12
+
+/* Output sections placed in RAM by STM32F103C8TX_FLASH.ld, .data is also loaded from flash */
+static const char *const Map_Sections[] = {".ram_vectors", ".data", ".bss", ".noinit", "._user_heap_stack"};
+#define MAP_SECTIONS		(sizeof(Map_Sections) / sizeof(Map_Sections[0]))
+
+typedef struct{
+	char   name[MAP_NAME_SIZE];
+	uint32 size[MAP_SECTIONS];
+}map_object_t;
+
+typedef struct{
+	char   name[MAP_NAME_SIZE];			// Input section, .bss.<variable> with -fdata-sections
+	char   object[MAP_NAME_SIZE];
+	uint32 size;
+	uint8  section;
+}map_variable_t;
+
+static map_object_t Map_Objects[MAP_OBJECTS_MAX];
+static uint32 Map_Object_Count;
+static map_variable_t Map_Variables[MAP_VARIABLES_MAX];
+static uint32 Map_Variable_Count;
+static uint32 Map_Section_Size[MAP_SECTIONS];
+
+/**=============================================
+  * @Fn				- Map_Section_Index
+  * @brief 			- Looks up an output section
+  * @param [in] 	- pName: Name of the output section
+  * @retval 		- Index in Map_Sections, MAP_SECTIONS if it is not in RAM
+  * Note			- None
+  */
+static uint8 Map_Section_Index(const char *pName){
+	uint8 index;
+	for(index = 0; index < MAP_SECTIONS; index++){
+		if(0 == strcmp(pName, Map_Sections[index])){
+			break;
+		}
+		else{ /* Do Nothing */ }
+	}
+	return index;
+}
+
+/**=============================================
+  * @Fn				- Map_Add
+  * @brief 			- Counts an input section for its object file
+  * @param [in] 	- section: Output section index
+  * @param [in] 	- pName: Input section
+  * @param [in] 	- size: Bytes
+  * @param [in] 	- pObject: Object file, the path is dropped
+  * @retval 		- None
+  * Note			- None
+  */
+static void Map_Add(uint8 section, const char *pName, uint32 size, const char *pObject){
+	const char *pBase = strrchr(pObject, '/');
+	uint32 index;
+	pBase = (NULL != pBase) ? (pBase + 1) : pObject;
+	for(index = 0; (index < Map_Object_Count) && (0 != strcmp(Map_Objects[index].name, pBase)); index++){
+	}
+	if(index == Map_Object_Count){
+		if(MAP_OBJECTS_MAX == Map_Object_Count){
+			fprintf(stderr, "map_ram: more than %u objects\n", MAP_OBJECTS_MAX);
+			exit(2);
+		}
+		else{ /* Do Nothing */ }
+		snprintf(Map_Objects[index].name, MAP_NAME_SIZE, "%s", pBase);
+		Map_Object_Count++;
+	}
+	else{ /* Do Nothing */ }
+	Map_Objects[index].size[section] += size;
+	if((0 != size) && (MAP_VARIABLES_MAX > Map_Variable_Count)){
+		snprintf(Map_Variables[Map_Variable_Count].name, MAP_NAME_SIZE, "%s", pName);
+		snprintf(Map_Variables[Map_Variable_Count].object, MAP_NAME_SIZE, "%s", pBase);
+		Map_Variables[Map_Variable_Count].size = size;
+		Map_Variables[Map_Variable_Count].section = section;
+		Map_Variable_Count++;
+	}
+	else{ /* Do Nothing */ }
+}
+
+static int Map_Compare_Size(const void *pA, const void *pB){
+	const map_variable_t *pVarA = pA, *pVarB = pB;
+	return (pVarA->size < pVarB->size) ? 1 : ((pVarA->size > pVarB->size) ? -1 : strcmp(pVarA->name, pVarB->name));
+}
+
+int main(int argc, char *argv[]){
+	char line[MAP_LINE_SIZE], name[MAP_NAME_SIZE] = "", object[MAP_LINE_SIZE];
+	unsigned long address, size;
+	uint8 section = MAP_SECTIONS, in_map = 0, index;
+	uint8 pending = 0;			// 1: input section, 2: output section waiting for its address and size
+	uint32 object_index, total;
+	FILE *pIn;
+
+	if((2 != argc) || (NULL == (pIn = fopen(argv[1], "r")))){
+		fprintf(stderr, "usage: map_ram <map file>\n");
+		return 2;
+	}
+	else{ /* Do Nothing */ }
+	while(NULL != fgets(line, sizeof(line), pIn)){
+		if(0 == in_map){
+			in_map = (0 == strncmp(line, "Linker script and memory map", 28)) ? 1 : 0;
+		}
+		else if('.' == line[0]){
+			/* Output section, the address and size follow the name or are on the next line */
+			(void)sscanf(line, "%63s", name);
+			section = Map_Section_Index(name);
+			pending = 0;
+			if((MAP_SECTIONS != section) && (2 == sscanf(line, "%*s %lx %lx", &address, &size))){
+				Map_Section_Size[section] = size;
+			}
+			else if(MAP_SECTIONS != section){
+				pending = 2;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else if(MAP_SECTIONS == section){
+			/* Do Nothing */
+		}
+		else if((' ' == line[0]) && (('.' == line[1]) || (0 == strncmp(&line[1], "COMMON", 6)))){
+			/* Input section, long names put the address, size and object on the next line */
+			if(4 == sscanf(line, " %63s %lx %lx %511s", name, &address, &size, object)){
+				Map_Add(section, name, size, object);
+				pending = 0;
+			}
+			else{
+				pending = 1;
+			}
+		}
+		else if((2 == pending) && (2 == sscanf(line, " %lx %lx", &address, &size))){
+			Map_Section_Size[section] = size;
+			pending = 0;
+		}
+		else if((1 == pending) && (3 == sscanf(line, " %lx %lx %511s", &address, &size, object))){
+			Map_Add(section, name, size, object);
+			pending = 0;
+		}
+		else{
+			pending = 0;
+		}
+	}
+	fclose(pIn);
+
+	printf("%-22s", "RAM section");
+	for(index = 0; index < MAP_SECTIONS; index++){
+		printf(" %12s", Map_Sections[index]);
+	}
+	printf("\n%-22s", "size with fill");
+	for(index = 0, total = 0; index < MAP_SECTIONS; index++){
+		printf(" %12u", Map_Section_Size[index]);
+		total += Map_Section_Size[index];
+	}
+	printf("    total %u bytes\n", total);
+	for(object_index = 0; object_index < Map_Object_Count; object_index++){
+		for(index = 0, total = 0; index < MAP_SECTIONS; index++){
+			total += Map_Objects[object_index].size[index];
+		}
+		if(0 == total){
+			continue;
+		}
+		else{ /* Do Nothing */ }
+		printf("  %-20s", Map_Objects[object_index].name);
+		for(index = 0; index < MAP_SECTIONS; index++){
+			printf(" %12u", Map_Objects[object_index].size[index]);
+		}
+		printf("\n");
+	}
+	qsort(Map_Variables, Map_Variable_Count, sizeof(map_variable_t), Map_Compare_Size);
+	printf("largest:\n");
+	for(object_index = 0; (object_index < MAP_LARGEST) && (object_index < Map_Variable_Count); object_index++){
+		printf("  %6u %-8s %-40s %s\n", Map_Variables[object_index].size, Map_Sections[Map_Variables[object_index].section],
+				Map_Variables[object_index].name, Map_Variables[object_index].object);
+	}
+	return 0;
+}
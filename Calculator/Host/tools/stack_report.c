@@ -0,0 +1,468 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : stack_report.c 			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include "Platform_Types.h"
+
+/*
+ * Worst case stack of the state handlers, from the call graphs gcc writes with -fcallgraph-info=su:
+ *   stack_report <dir>
+ * Reads every <name>.ci of the directory and the <name>.s built with it. The worst case of a function is its
+ * own frame plus the worst case of the functions it calls. The graphs do not say where a call through a pointer
+ * goes, Stack_Pointer_Calls lists the functions each pointer of the firmware is set to, among the ones whose
+ * address the assembly takes. A pointer call that is not in the table may reach any of them and is reported, add it
+ * to the table. A function met again on its own call path is a cycle, it counts once and is reported.
+ * Functions without a frame in the graphs (the C library, compiler helpers) count 0 bytes and are listed.
+ */
+
+#define STACK_NODES_MAX		1024
+#define STACK_EDGES_MAX		8192
+#define STACK_TITLE_SIZE	128
+#define STACK_LINE_SIZE		1024
+#define STACK_PATH_MAX		24
+
+/* Functions that call through a pointer and what the pointer is set to, names ending in '*' are prefixes */
+typedef struct{
+	const char *pCaller;
+	const char *pTargets;
+}stack_pointer_call_t;
+
+static const stack_pointer_call_t Stack_Pointer_Calls[] = {
+	{"main",						"ST_MAIN_*"},			// pfMain_State_Handler
+	{"ST_MAIN_RUNNING",				"ST_* !ST_MAIN_*"},		// State handler of the running mode
+	{"HSM_Dispatch",				"Act_* HSM_Transit"},	// Actions of the transition tables
+	{"HSM_Enter",					"Enter_*"},				// Entry and exit hooks of the states
+	{"Evaluate",					"Op_*"},				// Numbering_Op_Kernels
+	{"MCAL_UART_Received",			"Console_Received"},	// UART_RX_Callback
+	{"DMA1_Channel2_IRQHandler",	"Console_Sent Trace_Sent"},	// UART_TX_Callback
+	{"SysTick_Handler",				"main_tick"},			// STK_Callback
+};
+#define STACK_POINTER_CALLS	(sizeof(Stack_Pointer_Calls) / sizeof(Stack_Pointer_Calls[0]))
+
+/* Interrupts by preemption priority of main_init, one of each line can be active on top of main */
+static const char *const Stack_Interrupt_Levels[] = {
+	"SysTick_Handler",											// MAIN_TICK_PRIORITY
+	"USART3_IRQHandler DMA1_Channel2_IRQHandler DMA1_Channel3_IRQHandler",	// MAIN_UART_PRIORITY
+};
+#define STACK_INTERRUPT_LEVELS	(sizeof(Stack_Interrupt_Levels) / sizeof(Stack_Interrupt_Levels[0]))
+#define STACK_EXCEPTION_FRAME	32		// r0-r3, r12, lr, pc and xPSR stacked on entry, aligned to 8 bytes
+
+typedef struct{
+	char   title[STACK_TITLE_SIZE];		// "<source>:<name>" for static functions, "<name>" otherwise
+	const char *pName;					// Name without the source
+	uint32 frame;						// Bytes of its own frame
+	uint32 worst;						// Bytes with the deepest call below it
+	sint32 via;							// Callee of the deepest call, -1 if none
+	uint16 first_edge;
+	uint16 edges;
+	uint8  defined;						// Frame is known
+	uint8  address_taken;
+	uint8  calls_indirect;
+	uint8  pointer_call;				// Index in Stack_Pointer_Calls, STACK_POINTER_CALLS if it is not listed
+	uint8  state;						// 0 not visited, 1 on the call path, 2 done
+	uint8  cycle;						// Call path came back to it
+}stack_node_t;
+
+static stack_node_t Stack_Nodes[STACK_NODES_MAX];
+static uint32 Stack_Node_Count;
+static uint16 Stack_Edges[STACK_EDGES_MAX][2];	// Caller, callee
+static uint32 Stack_Edge_Count;
+static uint16 Stack_Callees[STACK_EDGES_MAX];	// Callees sorted by caller
+
+/**=============================================
+  * @Fn				- Stack_Node
+  * @brief 			- Finds a function, adds it if it is new
+  * @param [in] 	- pTitle: Title of the node in the graph
+  * @retval 		- Index of the node
+  * Note			- None
+  */
+static uint16 Stack_Node(const char *pTitle){
+	uint32 index;
+	const char *pColon;
+	for(index = 0; index < Stack_Node_Count; index++){
+		if(0 == strcmp(Stack_Nodes[index].title, pTitle)){
+			return (uint16)index;
+		}
+		else{ /* Do Nothing */ }
+	}
+	if(STACK_NODES_MAX == Stack_Node_Count){
+		fprintf(stderr, "stack_report: more than %u functions\n", STACK_NODES_MAX);
+		exit(2);
+	}
+	else{ /* Do Nothing */ }
+	snprintf(Stack_Nodes[index].title, STACK_TITLE_SIZE, "%s", pTitle);
+	pColon = strrchr(Stack_Nodes[index].title, ':');
+	Stack_Nodes[index].pName = (NULL != pColon) ? (pColon + 1) : Stack_Nodes[index].title;
+	Stack_Nodes[index].via = -1;
+	Stack_Node_Count++;
+	return (uint16)index;
+}
+
+/**=============================================
+  * @Fn				- Stack_Quoted
+  * @brief 			- Copies the quoted value that follows a key
+  * @param [in] 	- pLine: Line of the graph
+  * @param [in] 	- pKey: Key like "title: "
+  * @param [out] 	- pValue: Value without the quotes
+  * @retval 		- 1 if the key was found
+  * Note			- Escapes are kept as they are, the label of a node has "\n" between its parts
+  */
+static uint8 Stack_Quoted(const char *pLine, const char *pKey, char *pValue){
+	const char *pStart = strstr(pLine, pKey), *pEnd;
+	if(NULL == pStart){
+		return 0;
+	}
+	else{ /* Do Nothing */ }
+	pStart = strchr(pStart + strlen(pKey), '"');
+	pEnd = (NULL != pStart) ? strchr(++pStart, '"') : NULL;
+	if((NULL == pEnd) || ((pEnd - pStart) >= STACK_LINE_SIZE)){
+		return 0;
+	}
+	else{ /* Do Nothing */ }
+	memcpy(pValue, pStart, pEnd - pStart);
+	pValue[pEnd - pStart] = '\0';
+	return 1;
+}
+
+/**=============================================
+  * @Fn				- Stack_Read_Graph
+  * @brief 			- Reads the functions, frames and calls of one .ci file
+  * @param [in] 	- pPath: File
+  * @retval 		- None
+  * Note			- None
+  */
+static void Stack_Read_Graph(const char *pPath){
+	char line[STACK_LINE_SIZE], title[STACK_LINE_SIZE], label[STACK_LINE_SIZE], target[STACK_LINE_SIZE];
+	const char *pFrame;
+	uint16 node, callee;
+	uint32 index;
+	FILE *pIn = fopen(pPath, "r");
+	if(NULL == pIn){
+		fprintf(stderr, "stack_report: cannot open %s\n", pPath);
+		exit(2);
+	}
+	else{ /* Do Nothing */ }
+	while(NULL != fgets(line, sizeof(line), pIn)){
+		if((0 == strncmp(line, "node:", 5)) && (1 == Stack_Quoted(line, "title:", title)) &&
+				(1 == Stack_Quoted(line, "label:", label))){
+			/* Label: name\nsource:line:column\n<bytes> bytes (<qualifiers>) for the functions of this file */
+			node = Stack_Node(title);
+			pFrame = strstr(label, "\\n");
+			pFrame = (NULL != pFrame) ? strstr(pFrame + 2, "\\n") : NULL;
+			if(NULL != pFrame){
+				Stack_Nodes[node].frame = (uint32)strtoul(pFrame + 2, NULL, 10);
+				Stack_Nodes[node].defined = 1;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else if((0 == strncmp(line, "edge:", 5)) && (1 == Stack_Quoted(line, "sourcename:", title)) &&
+				(1 == Stack_Quoted(line, "targetname:", target))){
+			node = Stack_Node(title);
+			if(0 == strcmp(target, "__indirect_call")){
+				Stack_Nodes[node].calls_indirect = 1;
+				continue;
+			}
+			else{ /* Do Nothing */ }
+			callee = Stack_Node(target);
+			for(index = 0; index < Stack_Edge_Count; index++){
+				if((node == Stack_Edges[index][0]) && (callee == Stack_Edges[index][1])){
+					break;
+				}
+				else{ /* Do Nothing */ }
+			}
+			if(STACK_EDGES_MAX == Stack_Edge_Count){
+				fprintf(stderr, "stack_report: more than %u calls\n", STACK_EDGES_MAX);
+				exit(2);
+			}
+			else if(index == Stack_Edge_Count){
+				Stack_Edges[index][0] = node;
+				Stack_Edges[index][1] = callee;
+				Stack_Edge_Count++;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+	}
+	fclose(pIn);
+}
+
+/**=============================================
+  * @Fn				- Stack_Read_Addresses
+  * @brief 			- Marks the functions whose address the assembly of one file takes
+  * @param [in] 	- pPath: .s file
+  * @param [in] 	- pSource: Source file of the graph built with it, for the static functions
+  * @retval 		- None
+  * Note			- An address is an immediate "$name" or a table entry ".long name", calls and jumps are not
+  */
+static void Stack_Read_Addresses(const char *pPath, const char *pSource){
+	char line[STACK_LINE_SIZE], name[STACK_TITLE_SIZE], title[STACK_LINE_SIZE + STACK_TITLE_SIZE];
+	const char *pRef;
+	uint32 index, length;
+	FILE *pIn = fopen(pPath, "r");
+	if(NULL == pIn){
+		return;
+	}
+	else{ /* Do Nothing */ }
+	while(NULL != fgets(line, sizeof(line), pIn)){
+		pRef = strchr(line, '$');
+		if(NULL == pRef){
+			pRef = strstr(line, ".long\t");
+			pRef = (NULL != pRef) ? (pRef + 5) : NULL;
+		}
+		else{ /* Do Nothing */ }
+		if(NULL == pRef){
+			continue;
+		}
+		else{ /* Do Nothing */ }
+		pRef++;
+		for(length = 0; (length < (STACK_TITLE_SIZE - 1)) && (('_' == pRef[length]) ||
+				(('a' <= pRef[length]) && ('z' >= pRef[length])) || (('A' <= pRef[length]) && ('Z' >= pRef[length])) ||
+				((0 != length) && ('0' <= pRef[length]) && ('9' >= pRef[length]))); length++){
+		}
+		memcpy(name, pRef, length);
+		name[length] = '\0';
+		snprintf(title, sizeof(title), "%s:%s", pSource, name);
+		for(index = 0; (0 != length) && (index < Stack_Node_Count); index++){
+			if((1 == Stack_Nodes[index].defined) &&
+					((0 == strcmp(Stack_Nodes[index].title, title)) || (0 == strcmp(Stack_Nodes[index].title, name)))){
+				Stack_Nodes[index].address_taken = 1;
+			}
+			else{ /* Do Nothing */ }
+		}
+	}
+	fclose(pIn);
+}
+
+/**=============================================
+  * @Fn				- Stack_Is_Target
+  * @brief 			- Checks a function against the targets of a pointer call
+  * @param [in] 	- pTargets: Names separated by spaces, '*' ends a prefix and '!' excludes
+  * @param [in] 	- pName: Function
+  * @retval 		- 1 if the pointer may be set to it
+  * Note			- The last pattern that matches decides
+  */
+static uint8 Stack_Is_Target(const char *pTargets, const char *pName){
+	uint8 result = 0, exclude;
+	uint32 length;
+	while('\0' != *pTargets){
+		exclude = ('!' == *pTargets) ? 1 : 0;
+		pTargets += exclude;
+		for(length = 0; ('\0' != pTargets[length]) && (' ' != pTargets[length]); length++){
+		}
+		if(('*' == pTargets[length - 1]) && (0 == strncmp(pName, pTargets, length - 1))){
+			result = (uint8)(1 - exclude);
+		}
+		else if((strlen(pName) == length) && (0 == strncmp(pName, pTargets, length))){
+			result = (uint8)(1 - exclude);
+		}
+		else{ /* Do Nothing */ }
+		pTargets += length;
+		while(' ' == *pTargets){
+			pTargets++;
+		}
+	}
+	return result;
+}
+
+/**=============================================
+  * @Fn				- Stack_Worst
+  * @brief 			- Worst case stack of a function and the calls below it
+  * @param [in] 	- node: Function
+  * @retval 		- Bytes
+  * Note			- Depth first, a function on the current call path counts 0 and is marked as a cycle
+  */
+static uint32 Stack_Worst(uint16 node){
+	stack_node_t *pNode = &Stack_Nodes[node];
+	uint32 index, worst, best = 0;
+	if(2 == pNode->state){
+		return pNode->worst;
+	}
+	else if(1 == pNode->state){
+		pNode->cycle = 1;
+		return 0;
+	}
+	else{ /* Do Nothing */ }
+	pNode->state = 1;
+	for(index = pNode->first_edge; index < (uint32)(pNode->first_edge + pNode->edges); index++){
+		worst = Stack_Worst(Stack_Callees[index]);
+		if(worst > best){
+			best = worst;
+			pNode->via = Stack_Callees[index];
+		}
+		else{ /* Do Nothing */ }
+	}
+	for(index = 0; (1 == pNode->calls_indirect) && (index < Stack_Node_Count); index++){
+		if((1 == Stack_Nodes[index].address_taken) && ((STACK_POINTER_CALLS == pNode->pointer_call) ||
+				(1 == Stack_Is_Target(Stack_Pointer_Calls[pNode->pointer_call].pTargets, Stack_Nodes[index].pName)))){
+			worst = Stack_Worst((uint16)index);
+			if(worst > best){
+				best = worst;
+				pNode->via = (sint32)index;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+	}
+	pNode->worst = pNode->frame + best;
+	pNode->state = 2;
+	return pNode->worst;
+}
+
+/* Deepest call path below a function, "*" marks a call through a pointer */
+static void Stack_Print_Path(uint16 node){
+	uint32 depth, index;
+	uint8 direct;
+	printf("%s %u", Stack_Nodes[node].pName, Stack_Nodes[node].frame);
+	for(depth = 0; (depth < STACK_PATH_MAX) && (-1 != Stack_Nodes[node].via); depth++){
+		direct = 0;
+		for(index = Stack_Nodes[node].first_edge; index < (uint32)(Stack_Nodes[node].first_edge + Stack_Nodes[node].edges); index++){
+			direct |= (Stack_Callees[index] == Stack_Nodes[node].via) ? 1 : 0;
+		}
+		node = (uint16)Stack_Nodes[node].via;
+		printf(" > %s%s %u", (1 == direct) ? "" : "*", Stack_Nodes[node].pName, Stack_Nodes[node].frame);
+	}
+	printf("\n");
+}
+
+static int Stack_Compare_Worst(const void *pA, const void *pB){
+	const stack_node_t *pNodeA = &Stack_Nodes[*(const uint16*)pA], *pNodeB = &Stack_Nodes[*(const uint16*)pB];
+	return (pNodeA->worst < pNodeB->worst) ? 1 : ((pNodeA->worst > pNodeB->worst) ? -1 : strcmp(pNodeA->pName, pNodeB->pName));
+}
+
+int main(int argc, char *argv[]){
+	char path[STACK_LINE_SIZE], source[STACK_LINE_SIZE], line[STACK_LINE_SIZE];
+	static uint16 list[STACK_NODES_MAX];
+	uint32 index, edge, count = 0, length;
+	struct dirent *pEntry;
+	DIR *pDir;
+	FILE *pIn;
+
+	if((2 != argc) || (NULL == (pDir = opendir(argv[1])))){
+		fprintf(stderr, "usage: stack_report <directory of .ci and .s files>\n");
+		return 2;
+	}
+	else{ /* Do Nothing */ }
+	while(NULL != (pEntry = readdir(pDir))){
+		length = strlen(pEntry->d_name);
+		if((3 < length) && (0 == strcmp(&pEntry->d_name[length - 3], ".ci"))){
+			snprintf(path, sizeof(path), "%s/%s", argv[1], pEntry->d_name);
+			Stack_Read_Graph(path);
+		}
+		else{ /* Do Nothing */ }
+	}
+	rewinddir(pDir);
+	while(NULL != (pEntry = readdir(pDir))){
+		length = strlen(pEntry->d_name);
+		if((3 < length) && (0 == strcmp(&pEntry->d_name[length - 3], ".ci"))){
+			/* First line: graph: { title: "<source>" */
+			snprintf(path, sizeof(path), "%s/%s", argv[1], pEntry->d_name);
+			pIn = fopen(path, "r");
+			if((NULL != pIn) && (NULL != fgets(line, sizeof(line), pIn)) && (1 == Stack_Quoted(line, "title:", source))){
+				snprintf(path, sizeof(path), "%s/%.*ss", argv[1], (int)(length - 2), pEntry->d_name);
+				Stack_Read_Addresses(path, source);
+			}
+			else{ /* Do Nothing */ }
+			if(NULL != pIn){
+				fclose(pIn);
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+	}
+	closedir(pDir);
+
+	/* Callees of every function next to each other, the pointer calls looked up in the table */
+	for(index = 0; index < Stack_Node_Count; index++){
+		for(edge = 0; (edge < STACK_POINTER_CALLS) && (0 != strcmp(Stack_Pointer_Calls[edge].pCaller, Stack_Nodes[index].pName)); edge++){
+		}
+		Stack_Nodes[index].pointer_call = (uint8)edge;
+		Stack_Nodes[index].first_edge = (uint16)count;
+		for(edge = 0; edge < Stack_Edge_Count; edge++){
+			if(index == Stack_Edges[edge][0]){
+				Stack_Callees[count++] = Stack_Edges[edge][1];
+			}
+			else{ /* Do Nothing */ }
+		}
+		Stack_Nodes[index].edges = (uint16)(count - Stack_Nodes[index].first_edge);
+	}
+
+	/* State handlers, then the entry points: main and the interrupt handlers */
+	printf("state handler                    frame  worst  deepest path, * through a pointer\n");
+	for(count = 0, index = 0; index < Stack_Node_Count; index++){
+		if((1 == Stack_Nodes[index].defined) && (0 == strncmp(Stack_Nodes[index].pName, "ST_", 3))){
+			(void)Stack_Worst((uint16)index);
+			list[count++] = (uint16)index;
+		}
+		else{ /* Do Nothing */ }
+	}
+	qsort(list, count, sizeof(list[0]), Stack_Compare_Worst);
+	for(index = 0; index < count; index++){
+		printf("  %-30s %5u  %5u  ", Stack_Nodes[list[index]].pName, Stack_Nodes[list[index]].frame, Stack_Nodes[list[index]].worst);
+		Stack_Print_Path(list[index]);
+	}
+	printf("entry point\n");
+	for(count = 0, index = 0; index < Stack_Node_Count; index++){
+		length = strlen(Stack_Nodes[index].pName);
+		if((1 == Stack_Nodes[index].defined) && ((0 == strcmp(Stack_Nodes[index].pName, "main")) ||
+				((7 < length) && (0 == strcmp(&Stack_Nodes[index].pName[length - 7], "Handler")) &&
+				(0 != strncmp(Stack_Nodes[index].pName, "MCAL_", 5)) && (0 == Stack_Nodes[index].address_taken)))){
+			(void)Stack_Worst((uint16)index);
+			list[count++] = (uint16)index;
+		}
+		else{ /* Do Nothing */ }
+	}
+	qsort(list, count, sizeof(list[0]), Stack_Compare_Worst);
+	for(index = 0; index < count; index++){
+		printf("  %-30s %5u  %5u  ", Stack_Nodes[list[index]].pName, Stack_Nodes[list[index]].frame, Stack_Nodes[list[index]].worst);
+		Stack_Print_Path(list[index]);
+	}
+	/* Deepest interrupt of every priority nested on the deepest path of main, each with its exception frame */
+	for(index = 0, length = 0; index < count; index++){
+		length = (0 == strcmp(Stack_Nodes[list[index]].pName, "main")) ? Stack_Nodes[list[index]].worst : length;
+	}
+	printf("main with an interrupt of every priority on top: %u", length);
+	for(edge = 0; edge < STACK_INTERRUPT_LEVELS; edge++){
+		for(index = 0, count = 0; index < Stack_Node_Count; index++){
+			if((1 == Stack_Nodes[index].defined) && (1 == Stack_Is_Target(Stack_Interrupt_Levels[edge], Stack_Nodes[index].pName)) &&
+					(count < Stack_Nodes[index].worst)){
+				count = Stack_Nodes[index].worst;
+			}
+			else{ /* Do Nothing */ }
+		}
+		printf(" + %u + %u", STACK_EXCEPTION_FRAME, count);
+		length += STACK_EXCEPTION_FRAME + count;
+	}
+	printf(" = %u bytes\n", length);
+	printf("pointer calls not in the table, counted with every address taken:");
+	for(index = 0; index < Stack_Node_Count; index++){
+		if((1 == Stack_Nodes[index].calls_indirect) && (STACK_POINTER_CALLS == Stack_Nodes[index].pointer_call)){
+			printf(" %s", Stack_Nodes[index].pName);
+		}
+		else{ /* Do Nothing */ }
+	}
+	printf("\ncycles:");
+	for(index = 0; index < Stack_Node_Count; index++){
+		if(1 == Stack_Nodes[index].cycle){
+			printf(" %s", Stack_Nodes[index].pName);
+		}
+		else{ /* Do Nothing */ }
+	}
+	printf("\nno frame, counted 0:");
+	for(index = 0; index < Stack_Node_Count; index++){
+		if((0 == Stack_Nodes[index].defined) && (0 == Stack_Nodes[index].cycle)){
+			printf(" %s", Stack_Nodes[index].pName);
+		}
+		else{ /* Do Nothing */ }
+	}
+	printf("\n");
+	return 0;
+}
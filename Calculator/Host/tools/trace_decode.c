@@ -0,0 +1,180 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : trace_decode.c 			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace.h"
+
+/*
+ * Decodes the trace records the board sends over the UART into text, one record per line:
+ *   trace_decode [--no-time] [<file>]
+ * Reads stdin without a file. The format strings of the records are kept here and not on the board,
+ * %k is a key as returned by keypad_Scan, %s the source of a state record.
+ * The exit code is 0 if every byte belonged to a known record, 1 otherwise.
+ */
+
+#define TRACE_RECORD_SIZE		8
+
+/* Text of every record id @ref TRACE_ID_define */
+static const char *const Trace_Formats[] = {
+	[TRACE_ID_BOOT]		= "boot",
+	[TRACE_ID_KEY]		= "key %k",
+	[TRACE_ID_STATE]	= "%s state %u",
+	[TRACE_ID_MODE]		= "mode %u selected",
+	[TRACE_ID_LOST]		= "%u records lost",
+	[TRACE_ID_STACK]	= "stack past its limit, %u bytes used",
+	[TRACE_ID_RESUME]	= "resumed in %u ms",
+};
+
+/* Names of the sources of state records @ref TRACE_SOURCE_define */
+static const char *const Trace_Sources[] = {
+	[TRACE_SRC_MAIN]			= "main",
+	[TRACE_SRC_CALCULATOR]		= "calculator",
+	[TRACE_SRC_NUMBERING]		= "numbering",
+	[TRACE_SRC_STATISTICS]		= "statistics",
+	[TRACE_SRC_NUMBER_THEORY]	= "number theory",
+};
+
+/**=============================================
+  * @Fn				- Trace_Format
+  * @brief 			- Writes the text of one record
+  * @param [in] 	- id: Record id
+  * @param [in] 	- arg: Argument of the record
+  * @param [out] 	- pOut: Stream to write to
+  * @retval 		- 1 if the id is known, 0 otherwise
+  * Note			- None
+  */
+static uint8 Trace_Format(uint8 id, uint16 arg, FILE *pOut){
+	const char *pFormat;
+	uint8 source = arg >> 8, state = arg & 0xFF;
+	if((id >= (sizeof(Trace_Formats) / sizeof(Trace_Formats[0]))) || (NULL == Trace_Formats[id])){
+		fprintf(pOut, "unknown record 0x%02X, arg %u", id, arg);
+		return 0;
+	}
+	else{ /* Do Nothing */ }
+	for(pFormat = Trace_Formats[id]; '\0' != *pFormat; pFormat++){
+		if(('%' != pFormat[0]) || ('\0' == pFormat[1])){
+			fputc(*pFormat, pOut);
+			continue;
+		}
+		else{ /* Do Nothing */ }
+		pFormat++;
+		if('k' == *pFormat){
+			/* Digits are their value, the other keys their character */
+			if(10 > arg){
+				fputc('0' + arg, pOut);
+			}
+			else{
+				fputc(arg, pOut);
+			}
+		}
+		else if('s' == *pFormat){
+			if((source < (sizeof(Trace_Sources) / sizeof(Trace_Sources[0]))) && (NULL != Trace_Sources[source])){
+				fputs(Trace_Sources[source], pOut);
+			}
+			else{
+				fprintf(pOut, "source %u", source);
+			}
+		}
+		else if('u' == *pFormat){
+			if(TRACE_ID_STATE != id){
+				fprintf(pOut, "%u", arg);
+			}
+			else if(0xFF == state){
+				fputs("stopped", pOut);
+			}
+			else{
+				fprintf(pOut, "%u", state);
+			}
+		}
+		else{
+			fputc(*pFormat, pOut);
+		}
+	}
+	return 1;
+}
+
+/**=============================================
+  * @Fn				- Trace_Decode
+  * @brief 			- Decodes the bytes the board sent into one line per record
+  * @param [in] 	- pBytes: Bytes received from the board
+  * @param [in] 	- length: Number of bytes
+  * @param [out] 	- pOut: Stream to write the lines to
+  * @param [in] 	- with_time: 1 to start every line with the time of the record
+  * @retval 		- Number of problems: unknown records and runs of bytes that were not records
+  * Note			- Bytes before a sync byte are skipped, so decoding can start in the middle of a record
+  */
+uint32 Trace_Decode(const uint8 *pBytes, uint32 length, FILE *pOut, uint8 with_time){
+	uint32 index = 0, skipped = 0, problems = 0, time_ms;
+	uint16 arg;
+	while((index + TRACE_RECORD_SIZE) <= length){
+		if(TRACE_SYNC != pBytes[index]){
+			skipped++;
+			index++;
+			continue;
+		}
+		else{ /* Do Nothing */ }
+		if(0 != skipped){
+			fprintf(pOut, "%s(%u bytes skipped)\n", (1 == with_time) ? "             " : "", skipped);
+			problems++;
+			skipped = 0;
+		}
+		else{ /* Do Nothing */ }
+		/* Little endian, as trace_record_t is kept in RAM */
+		arg = (uint16)(pBytes[index + 2] | (pBytes[index + 3] << 8));
+		time_ms = pBytes[index + 4] | (pBytes[index + 5] << 8) | (pBytes[index + 6] << 16) | ((uint32)pBytes[index + 7] << 24);
+		if(1 == with_time){
+			fprintf(pOut, "%10u ms  ", time_ms);
+		}
+		else{ /* Do Nothing */ }
+		problems += (0 == Trace_Format(pBytes[index + 1], arg, pOut)) ? 1 : 0;
+		fputc('\n', pOut);
+		index += TRACE_RECORD_SIZE;
+	}
+	skipped += length - index;
+	if(0 != skipped){
+		fprintf(pOut, "%s(%u bytes skipped)\n", (1 == with_time) ? "             " : "", skipped);
+		problems++;
+	}
+	else{ /* Do Nothing */ }
+	return problems;
+}
+
+#ifndef TRACE_DECODE_NO_MAIN
+int main(int argc, char *argv[]){
+	FILE *pIn = stdin;
+	uint8 *pBytes = NULL;
+	uint32 length = 0, size = 0;
+	uint8 with_time = 1;
+	int arg;
+	size_t count;
+
+	for(arg = 1; arg < argc; arg++){
+		if(0 == strcmp(argv[arg], "--no-time")){
+			with_time = 0;
+		}
+		else if(NULL == (pIn = fopen(argv[arg], "rb"))){
+			fprintf(stderr, "trace_decode: cannot open %s\n", argv[arg]);
+			return 2;
+		}
+		else{ /* Do Nothing */ }
+	}
+	do{
+		if(length == size){
+			size = (0 == size) ? 4096 : (size * 2);
+			pBytes = realloc(pBytes, size);
+		}
+		else{ /* Do Nothing */ }
+		count = fread(&pBytes[length], 1, size - length, pIn);
+		length += count;
+	}while(0 != count);
+	return (0 == Trace_Decode(pBytes, length, stdout, with_time)) ? 0 : 1;
+}
+#endif
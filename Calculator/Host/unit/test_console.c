@@ -0,0 +1,326 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : test_console.c 			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "sim.h"
+#include "console.h"
+
+/*
+ * Loopback of the serial console: the firmware of the console variant runs on the simulator and the test is the
+ * host at the other end of the line. It keeps requests of 10 bytes coming back to back, "aaaa+bbbb\n" with
+ * every operation, up to CONSOLE_RX_SIZE bytes not answered yet, and checks every reply against the
+ * left to right evaluation. Expressions per second are counted from the first request sent to the last reply.
+ * The code between two hooks of the simulator takes no time, so this is the rate the line, the DMA, the event
+ * queue and the two reply batches allow, not the rate the core parses at.
+ * The memory report "M" is then checked against the stack and heap of the simulator, and the event report "S"
+ * against a window of the loopback and a quiet one. Last, the report "W" of the retained record must show that the
+ * requests, which change neither the mode nor the LCD, did not save it, and the report "V" must be well formed. The
+ * simulator enters every handler in SIM_EXCEPTION_CYCLES, so both of its numbers are that and say nothing of flash
+ * against SRAM. The arena peak of "M" is 0 until the calculator mode is entered, then its working set,
+ * aligned to ARENA_ALIGN and within ARENA_SIZE.
+ */
+
+#define TEST_EXPRESSIONS		5000UL
+#define TEST_REQUEST_SIZE		10
+#define TEST_RESET_POWER_ON		((1UL<<26) | (1UL<<27))	// PINRSTF and PORRSTF in RCC->CSR
+#define TEST_STEP_CYCLES		(STK_FCPU / 20000UL)	// Host looks at the line every 50 us
+
+static uint32 Test_Checks, Test_Failures;
+
+/* Request number index and its reply */
+static uint32 Test_Request(uint32 index, char *pText){
+	static const char operations[] = {'+', '-', 'x', '/'};
+	uint32 a = (index * 7919UL) % 10000UL, b = ((index * 104729UL) % 9999UL) + 1UL;
+	char operation = operations[index % 4];
+	snprintf(pText, TEST_REQUEST_SIZE + 1, "%04u%c%04u\n", a, operation, b);
+	if('+' == operation){
+		return a + b;
+	}
+	else if('-' == operation){
+		/* Calculate_Result gives the absolute difference */
+		return (a > b) ? (a - b) : (b - a);
+	}
+	else if('x' == operation){
+		return a * b;
+	}
+	else{
+		return a / b;
+	}
+}
+
+/**=============================================
+  * @Fn				- Test_Loopback
+  * @brief 			- Sends TEST_EXPRESSIONS requests and checks the replies
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Runs at the baud rate programmed in USART3, prints the rate against the one of the line
+  */
+static void Test_Loopback(void){
+	char request[TEST_REQUEST_SIZE + 1], expected[16];
+	const uint8 *pReplies;
+	uint32 length, offset = 0, sent = 0, answered = 0, wrong = 0, result;
+	uint64 start, end, limit;
+	double seconds, line;
+	uint32 line_start;
+
+	SIM_UART_Clear();
+	start = SIM_Cycles;
+	limit = start + SIM_MS_TO_CYCLES(60000);
+	while((TEST_EXPRESSIONS > answered) && (SIM_Cycles < limit)){
+		/* Requests in flight stay within the receive buffer */
+		while((TEST_EXPRESSIONS > sent) && (((sent - answered + 1) * TEST_REQUEST_SIZE) <= CONSOLE_RX_SIZE)){
+			(void)Test_Request(sent, request);
+			SIM_UART_Send((const uint8*)request, TEST_REQUEST_SIZE);
+			sent++;
+		}
+		SIM_Run_Until(SIM_Cycles + TEST_STEP_CYCLES);
+		pReplies = SIM_UART_Received(&length);
+		for(line_start = offset; offset < length; offset++){
+			if('\n' == pReplies[offset]){
+				result = Test_Request(answered, request);
+				snprintf(expected, sizeof(expected), "%u\n", result);
+				if(((offset + 1 - line_start) != strlen(expected)) ||
+						(0 != memcmp(&pReplies[line_start], expected, strlen(expected)))){
+					wrong++;
+					if(1 == wrong){
+						printf("  FAILED: reply %u to %.9s is %.*s, expected %u\n", answered, request,
+								(int)(offset - line_start), (const char*)&pReplies[line_start], result);
+					}
+					else{ /* Do Nothing */ }
+				}
+				else{ /* Do Nothing */ }
+				answered++;
+				line_start = offset + 1;
+			}
+			else{ /* Do Nothing */ }
+		}
+		offset = line_start;
+	}
+	end = SIM_Cycles;
+
+	/* Each request takes 10 frames of UART_PCLK / BRR / 10 on the line to the board */
+	line = (double)UART_PCLK / SIM_USART3.BRR / 10.0 / TEST_REQUEST_SIZE;
+	seconds = (double)(end - start) / STK_FCPU;
+	printf("  %6u baud: %u expressions in %.3f s, %.0f expressions/s, %.1f%% of the line, %u wrong\n",
+			(uint32)(UART_PCLK / SIM_USART3.BRR), answered, seconds, answered / seconds,
+			100.0 * answered / seconds / line, wrong);
+	Test_Checks++;
+	if((TEST_EXPRESSIONS != answered) || (0 != wrong)){
+		Test_Failures++;
+		printf("  FAILED: %u of %lu answered, %u wrong\n", answered, TEST_EXPRESSIONS, wrong);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Test_Ask
+  * @brief 			- Sends a report request and waits for its lines
+  * @param [in] 	- pRequest: Request with its '\n'
+  * @param [in] 	- lines: Lines of the report
+  * @param [out] 	- pLength: Bytes received
+  * @retval 		- What the board sent
+  * Note			- Gives up after 100 ms
+  */
+static const uint8 *Test_Ask(const char *pRequest, uint32 lines, uint32 *pLength){
+	const uint8 *pReply;
+	uint64 limit = SIM_Cycles + SIM_MS_TO_CYCLES(100);
+	uint32 received, index;
+	SIM_UART_Clear();
+	SIM_UART_Send((const uint8*)pRequest, strlen(pRequest));
+	do{
+		SIM_Run_Until(SIM_Cycles + TEST_STEP_CYCLES);
+		pReply = SIM_UART_Received(pLength);
+		for(index = 0, received = 0; index < *pLength; index++){
+			received += ('\n' == pReply[index]) ? 1 : 0;
+		}
+	}while((lines > received) && (SIM_Cycles < limit));
+	return pReply;
+}
+
+/**=============================================
+  * @Fn				- Test_Memory
+  * @brief 			- Asks for the memory report and checks its fields
+  * @param [in] 	- entered: 1 if a mode took its working set from the arena, else the arena peak must be 0
+  * @retval 		- None
+  * Note			- The stack of the simulator is SIM_STACK_SIZE, the loopback ran deeper than nothing
+  */
+static void Test_Memory(uint8 entered){
+	const uint8 *pReply;
+	char text[128];
+	uint32 length;
+	unsigned int limit, peak, heap_used, heap_peak, never_used, calls, failures, overflow, arena;
+
+	pReply = Test_Ask("M\n", 1, &length);
+	snprintf(text, sizeof(text), "%.*s", (int)length, (const char*)pReply);
+	printf("  memory report: %s", text);
+	Test_Checks++;
+	if((9 != sscanf(text, "M %u %u %u %u %u %u %u %u %u\n", &limit, &peak, &heap_used, &heap_peak, &never_used,
+			&calls, &failures, &overflow, &arena)) || ('\n' != text[strlen(text) - 1]) || (SIM_STACK_SIZE != limit) ||
+			(0 == peak) || (limit < peak) || (heap_peak < heap_used) || (0 != failures) || (0 != overflow) ||
+			((0 == entered) ? (0 != arena) : ((0 == arena) || (ARENA_SIZE < arena) || (0 != (arena % ARENA_ALIGN))))){
+		Test_Failures++;
+		printf("  FAILED: memory report\n");
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Test_Events
+  * @brief 			- Asks for the event report and checks its fields
+  * @param [in] 	- pWhen: Name of the window for the output
+  * @param [in] 	- min_events: Fewest events per second expected in the last window
+  * @retval 		- None
+  * Note			- The system tick wakes the core every ms, nothing may be dropped
+  */
+static void Test_Events(const char *pWhen, uint32 min_events){
+	const uint8 *pReply;
+	char text[64];
+	uint32 length;
+	unsigned int idle, wakeups, events, dropped;
+
+	pReply = Test_Ask("S\n", 1, &length);
+	snprintf(text, sizeof(text), "%.*s", (int)length, (const char*)pReply);
+	printf("  event report, %s: %s", pWhen, text);
+	Test_Checks++;
+	if((4 != sscanf(text, "S %u %u %u %u\n", &idle, &wakeups, &events, &dropped)) || ('\n' != text[strlen(text) - 1]) ||
+			(100 < idle) || (1000 > wakeups) || (min_events > events) || (0 != dropped)){
+		Test_Failures++;
+		printf("  FAILED: event report\n");
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Test_Retain
+  * @brief 			- Asks for the retained record report and checks its fields
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The console events come after the modes screen, none of them may save the record, several
+  * 				  requests are answered per EVENT_SERIAL
+  */
+static void Test_Retain(void){
+	const uint8 *pReply;
+	char text[96];
+	uint32 length;
+	unsigned int saves, skipped, last_cycles, max_cycles, flags, resume_ms;
+
+	pReply = Test_Ask("W\n", 1, &length);
+	snprintf(text, sizeof(text), "%.*s", (int)length, (const char*)pReply);
+	printf("  retain report: %s", text);
+	Test_Checks++;
+	if((6 != sscanf(text, "W %u %u %u %u %u %u\n", &saves, &skipped, &last_cycles, &max_cycles, &flags, &resume_ms)) ||
+			('\n' != text[strlen(text) - 1]) || (10 < saves) || (1000 > skipped) ||
+			((TEST_RESET_POWER_ON >> 24) != flags) || (0 != resume_ms)){
+		Test_Failures++;
+		printf("  FAILED: retain report\n");
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Test_Vectors
+  * @brief 			- Asks for the interrupt entry latency and checks its fields
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The simulator takes SIM_EXCEPTION_CYCLES to enter any handler, flash has no wait states
+  */
+static void Test_Vectors(void){
+	const uint8 *pReply;
+	char text[32];
+	uint32 length;
+	unsigned int flash_cycles, ram_cycles;
+
+	pReply = Test_Ask("V\n", 1, &length);
+	snprintf(text, sizeof(text), "%.*s", (int)length, (const char*)pReply);
+	printf("  vector report: %s", text);
+	Test_Checks++;
+	if((2 != sscanf(text, "V %u %u\n", &flash_cycles, &ram_cycles)) || ('\n' != text[strlen(text) - 1]) ||
+			(SIM_EXCEPTION_CYCLES != flash_cycles) || (SIM_EXCEPTION_CYCLES != ram_cycles)){
+		Test_Failures++;
+		printf("  FAILED: vector report\n");
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Test_LCD_Timing
+  * @brief 			- Asks for the LCD bus timings and checks them
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The hooks take no time in the simulator, so the calibrated cost must be 0. Every driver path sent
+  * 				  something since the boot and none may break a minimum time of the HD44780
+  */
+static void Test_LCD_Timing(void){
+	static const char *const names[LCD_TIMING_SITES] = {"Init", "Cmd", "Char"};
+	const uint8 *pReply;
+	char text[512], name[8];
+	const char *pLine;
+	uint32 length, site;
+	unsigned int hook_cycles, transactions, violations;
+	int slack[LCD_TIMING_CONSTRAINTS], used, constraint, failed = 0;
+
+	pReply = Test_Ask("T\n", 1 + LCD_TIMING_SITES, &length);
+	snprintf(text, sizeof(text), "%.*s", (int)length, (const char*)pReply);
+	printf("  LCD timing report:\n%s", text);
+	Test_Checks++;
+	pLine = text;
+	if((1 != sscanf(pLine, "T %u\n%n", &hook_cycles, &used)) || (0 != hook_cycles)){
+		failed = 1;
+	}
+	else{
+		pLine += used;
+	}
+	for(site = 0; (0 == failed) && (site < LCD_TIMING_SITES); site++){
+		if((10 != sscanf(pLine, "%7s %u %u %d %d %d %d %d %d %d\n%n", name, &transactions, &violations, &slack[0],
+				&slack[1], &slack[2], &slack[3], &slack[4], &slack[5], &slack[6], &used)) ||
+				(0 != strcmp(name, names[site])) || (0 == transactions) || (0 != violations)){
+			failed = 1;
+		}
+		else{
+			for(constraint = 0; constraint < LCD_TIMING_CONSTRAINTS; constraint++){
+				failed |= (0 > slack[constraint]) ? 1 : 0;
+			}
+			pLine += used;
+		}
+	}
+	if(1 == failed){
+		Test_Failures++;
+		printf("  FAILED: LCD timing report\n");
+	}
+	else{ /* Do Nothing */ }
+}
+
+int main(void){
+	SIM_Set_Reset_Flags(TEST_RESET_POWER_ON);
+	SIM_Boot();
+	SIM_Run_Until(SIM_MS_TO_CYCLES(3000));
+	Test_Events("idle", 0);
+
+	printf("test_console: %lu requests of %u bytes, up to %u bytes not answered\n",
+			TEST_EXPRESSIONS, TEST_REQUEST_SIZE, CONSOLE_RX_SIZE);
+	Test_Loopback();
+	/* Highest baud rate of UART_PCLK, set from the host side while the line is quiet */
+	SIM_USART3.BRR = 16;
+	Test_Loopback();
+	Test_Events("loopback", 1000);
+	Test_Memory(0);
+	Test_Retain();
+	Test_Vectors();
+	Test_LCD_Timing();
+	/* The calculator mode takes its working set from the arena */
+	(void)SIM_Keypad_Press(1);
+	SIM_Run_Until(SIM_Cycles + SIM_MS_TO_CYCLES(50));
+	(void)SIM_Keypad_Press('F');
+	SIM_Run_Until(SIM_Cycles + SIM_MS_TO_CYCLES(200));
+	Test_Memory(1);
+
+	printf("test_console: %u checks, %u failed\n", Test_Checks, Test_Failures);
+	return (0 == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,501 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : test_conversion.c 			                         */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <x86intrin.h>
+/* Included rather than linked, so its static tables can be checked */
+#include "conversion.c"
+
+/*
+ * Checks the digit kernels of "conversion" against printf and a plain division loop, then times them
+ * against the routines numbering mode used before them (PowerOf, DecToHex, HexToDec, Print_Array_LCD...),
+ * kept below as they were. The times are cycles of the time stamp counter of the PC per conversion,
+ * the least of TEST_ROUNDS rounds over the same TEST_VALUES values.
+ * The chunk table of Conv_Render_Radix is regenerated and compared, and its cycles per digit are timed
+ * against one 64-bit division per digit.
+ */
+
+#define TEST_VALUES			4096
+#define TEST_ROUNDS			200
+#define TEST_RANDOM_VALUES	200000
+
+/* Cortex-M3 cycles, the same estimates as test_number_theory, for the digits of Conv_Render_Radix on the board */
+#define TEST_CYCLES_DIVISION		150UL	// __aeabi_uldivmod, 64-bit dividend
+#define TEST_CYCLES_UDIV			12UL	// UDIV, 32-bit, at the worst
+#define TEST_CYCLES_DIGIT			8UL		// Multiply back, subtract, table load, store, loop
+
+static uint32 Test_Checks, Test_Failures;
+static uint64 Test_Random = 0x9E3779B97F4A7C15ULL;
+static uint64 Test_Values[TEST_VALUES];
+static volatile uint8 Test_Sink;
+static uint64 Test_Digits;			// Digits of "Test_Values" in the radix timed last
+
+static uint64 Test_Next_Random(void){
+	/* xorshift64 */
+	Test_Random ^= Test_Random << 13;
+	Test_Random ^= Test_Random >> 7;
+	Test_Random ^= Test_Random << 17;
+	return Test_Random;
+}
+
+static void Test_Check(uint8 condition, const char *what, uint64 value, const uint8 *got, const char *expected){
+	Test_Checks++;
+	if(!condition){
+		Test_Failures++;
+		if(10 >= Test_Failures){
+			printf("  FAILED: %s of %llu: \"%s\", expected \"%s\"\n", what, (unsigned long long)value, got, expected);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/*
+ * =============================================
+ * Routines of numbering mode before "conversion"
+ * =============================================
+ */
+
+#define DECIMAL_MAX_SIZE	10
+#define OCTAL_MAX_SIZE		11
+#define BINARY_MAX_SIZE		32
+#define HEXA_MAX_SIZE		8
+
+static uint8 Decimal_Number[DECIMAL_MAX_SIZE];
+static uint8 Decimal_Length;
+static uint8 Octal_Number[OCTAL_MAX_SIZE];
+static uint8 Octal_Length;
+static uint8 Hexa_Number[HEXA_MAX_SIZE];
+static uint8 Hexadecimal_Length;
+static uint8 Binary_Number[BINARY_MAX_SIZE];
+static uint8 Binary_Length;
+static uint8 Old_LCD[40];
+static uint8 Old_LCD_Length;
+
+static void LCD_Send_Char(uint8 character){
+	Old_LCD[Old_LCD_Length] = character;
+	Old_LCD_Length++;
+}
+
+static uint32 PowerOf(uint8 base, uint8 power){
+	uint32 result = 1;
+	uint8 index;
+	for(index = 0; index < power; index++){
+		result *= base;
+	}
+	return result;
+}
+
+static void Print_Array_LCD(uint8 *Array, uint8 Length){
+	uint8 index;
+	for(index = 0; index < Length; index++){
+		if(10 > Array[index]){
+			LCD_Send_Char(Array[index]+48);
+		}
+		else{
+			switch(Array[index]){
+			case 10: LCD_Send_Char('A'); break;
+			case 11: LCD_Send_Char('B'); break;
+			case 12: LCD_Send_Char('C'); break;
+			case 13: LCD_Send_Char('D'); break;
+			case 14: LCD_Send_Char('E'); break;
+			case 15: LCD_Send_Char('F'); break;
+			}
+		}
+	}
+}
+
+static uint8 Integer_To_Array_Reversed(uint32 source_int, uint8 *Dest_Array){
+	uint8 index = 0;
+	while(0 != source_int){
+		Dest_Array[index] = source_int % 10;
+		source_int /= 10;
+		index++;
+	}
+	return index;
+}
+
+static void Reverse_Array(uint8 *arr, uint8 length){
+	uint8 temp, index;
+	uint8 *pStart = arr;
+	uint8 *pEnd = (arr + length);
+	for(index = 0; index <= length/2; index++){
+		temp = *pStart;
+		*pStart = *pEnd;
+		*pEnd = temp;
+		pStart++;
+		pEnd--;
+	}
+}
+
+/* DecToOct, DecToBin and DecToHex after Flush_Array, the value is already in a variable.
+ * Inlined, so the base is a constant as in the original functions and divides by 8, 2 and 16 are shifts */
+static inline __attribute__((always_inline)) void DecToBase(uint32 decimal_value, uint8 base, uint8 *Number, uint8 *Length, uint8 Size){
+	memset(Number, 0, Size);
+	*Length = 0;
+	while(0 != decimal_value){
+		Number[*Length] += decimal_value % base;
+		decimal_value /= base;
+		(*Length)++;
+	}
+	if(0 != *Length){
+		Reverse_Array(Number, (*Length - 1));
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* BinToDec and HexToDec */
+static inline __attribute__((always_inline)) void BaseToDec(uint8 base, uint8 *Number, uint8 *Length, uint8 Size){
+	uint32 decimal_value = 0;
+	uint8 index = 0;
+	uint8 *pArrIndex = (Number + (*Length - 1));
+	memset(Decimal_Number, 0, DECIMAL_MAX_SIZE);
+	Decimal_Length = 0;
+	while(pArrIndex >= Number){
+		decimal_value += (*pArrIndex * PowerOf(base, index));
+		index++;
+		pArrIndex--;
+	}
+	memset(Number, 0, Size);
+	*Length = 0;
+	Decimal_Length = Integer_To_Array_Reversed(decimal_value, Decimal_Number);
+	if(0 != Decimal_Length){
+		Reverse_Array(Decimal_Number, (Decimal_Length - 1));
+	}
+	else{ /* Do Nothing */ }
+}
+
+static void Old_Decimal(uint32 value){
+	Old_LCD_Length = 0;
+	Decimal_Length = Integer_To_Array_Reversed(value, Decimal_Number);
+	Reverse_Array(Decimal_Number, (Decimal_Length - 1));
+	Print_Array_LCD(Decimal_Number, Decimal_Length);
+}
+
+static void Old_Octal(uint32 value){
+	Old_LCD_Length = 0;
+	DecToBase(value, 8, Octal_Number, &Octal_Length, OCTAL_MAX_SIZE);
+	Print_Array_LCD(Octal_Number, Octal_Length);
+}
+
+static void Old_Binary(uint32 value){
+	Old_LCD_Length = 0;
+	DecToBase(value, 2, Binary_Number, &Binary_Length, BINARY_MAX_SIZE);
+	Print_Array_LCD(Binary_Number, Binary_Length);
+}
+
+static void Old_Hexadecimal(uint32 value){
+	Old_LCD_Length = 0;
+	DecToBase(value, 16, Hexa_Number, &Hexadecimal_Length, HEXA_MAX_SIZE);
+	Print_Array_LCD(Hexa_Number, Hexadecimal_Length);
+}
+
+/* Digits typed in hexadecimal back to the decimal view */
+static void Old_Parse_Hexadecimal(uint32 value){
+	DecToBase(value, 16, Hexa_Number, &Hexadecimal_Length, HEXA_MAX_SIZE);
+	BaseToDec(16, Hexa_Number, &Hexadecimal_Length, HEXA_MAX_SIZE);
+}
+
+static void Old_Parse_Binary(uint32 value){
+	DecToBase(value, 2, Binary_Number, &Binary_Length, BINARY_MAX_SIZE);
+	BaseToDec(2, Binary_Number, &Binary_Length, BINARY_MAX_SIZE);
+}
+
+/*
+ * =============================================
+ * Same jobs done the way numbering mode does them now
+ * =============================================
+ */
+
+static uint8 New_Buffer[CONV_RADIX_SIZE];
+static conv_bases_t New_Bases;
+static uint8 New_Digits[BINARY_MAX_SIZE];
+
+static void New_Decimal(uint32 value){ Test_Sink = *Conv_Render_Decimal(value, &New_Buffer[CONV_RADIX_SIZE - 1]); }
+static void New_Octal(uint32 value){ Test_Sink = *Conv_Render_Power_Of_Two(value, 3, &New_Buffer[CONV_RADIX_SIZE - 1]); }
+static void New_Binary(uint32 value){ Test_Sink = *Conv_Render_Binary(value, &New_Buffer[CONV_RADIX_SIZE - 1]); }
+static void New_Hexadecimal(uint32 value){ Test_Sink = *Conv_Render_Power_Of_Two(value, 4, &New_Buffer[CONV_RADIX_SIZE - 1]); }
+static void New_All_Bases(uint32 value){ Conv_Render_Bases(value, &New_Bases); Test_Sink = *New_Bases.pDigits[CONV_DECIMAL]; }
+
+/* Typed digits are shifted into the value, then the decimal view renders it */
+static inline __attribute__((always_inline)) void New_Parse(uint32 value, uint8 shift){
+	uint32 parsed = 0, mask = (1UL << shift) - 1;
+	uint8 length = 0, index;
+	do{
+		New_Digits[length] = value & mask;
+		value >>= shift;
+		length++;
+	}while(0 != value);
+	for(index = length; index > 0; index--){
+		parsed = (parsed << shift) | New_Digits[index - 1];
+	}
+	Test_Sink = *Conv_Render_Decimal(parsed, &New_Buffer[CONV_RADIX_SIZE - 1]);
+}
+static void New_Parse_Hexadecimal(uint32 value){ New_Parse(value, 4); }
+static void New_Parse_Binary(uint32 value){ New_Parse(value, 1); }
+
+/*
+ * =============================================
+ * Checks and timing
+ * =============================================
+ */
+
+static void Test_Reference_Radix(uint64 value, uint8 radix, char *pString){
+	char reversed[CONV_RADIX_SIZE];
+	uint8 length = 0;
+	do{
+		reversed[length] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"[value % radix];
+		value /= radix;
+		length++;
+	}while(0 != value);
+	while(0 != length){
+		length--;
+		*pString = reversed[length];
+		pString++;
+	}
+	*pString = '\0';
+}
+
+static void Test_Value(uint64 value){
+	char expected[CONV_RADIX_SIZE];
+	uint8 *pDigits;
+	uint8 radix;
+
+	snprintf(expected, sizeof(expected), "%llu", (unsigned long long)value);
+	pDigits = Conv_Render_Decimal(value, &New_Buffer[CONV_RADIX_SIZE - 1]);
+	Test_Check(0 == strcmp((char *)pDigits, expected), "Conv_Render_Decimal", value, pDigits, expected);
+	Conv_Render_Bases(value, &New_Bases);
+	Test_Check(0 == strcmp((char *)New_Bases.pDigits[CONV_DECIMAL], expected), "decimal of Conv_Render_Bases", value, New_Bases.pDigits[CONV_DECIMAL], expected);
+
+	snprintf(expected, sizeof(expected), "%llo", (unsigned long long)value);
+	pDigits = Conv_Render_Power_Of_Two(value, 3, &New_Buffer[CONV_RADIX_SIZE - 1]);
+	Test_Check(0 == strcmp((char *)pDigits, expected), "Conv_Render_Power_Of_Two 3", value, pDigits, expected);
+	Test_Check(0 == strcmp((char *)New_Bases.pDigits[CONV_OCTAL], expected), "octal of Conv_Render_Bases", value, New_Bases.pDigits[CONV_OCTAL], expected);
+
+	snprintf(expected, sizeof(expected), "%llX", (unsigned long long)value);
+	pDigits = Conv_Render_Power_Of_Two(value, 4, &New_Buffer[CONV_RADIX_SIZE - 1]);
+	Test_Check(0 == strcmp((char *)pDigits, expected), "Conv_Render_Power_Of_Two 4", value, pDigits, expected);
+	Test_Check(0 == strcmp((char *)New_Bases.pDigits[CONV_HEXADECIMAL], expected), "hexadecimal of Conv_Render_Bases", value, New_Bases.pDigits[CONV_HEXADECIMAL], expected);
+
+	Test_Reference_Radix(value, 2, expected);
+	pDigits = Conv_Render_Power_Of_Two(value, 1, &New_Buffer[CONV_RADIX_SIZE - 1]);
+	Test_Check(0 == strcmp((char *)pDigits, expected), "Conv_Render_Power_Of_Two 1", value, pDigits, expected);
+	Test_Check(0 == strcmp((char *)New_Bases.pDigits[CONV_BINARY], expected), "binary of Conv_Render_Bases", value, New_Bases.pDigits[CONV_BINARY], expected);
+
+	for(radix = CONV_RADIX_MIN; radix <= CONV_RADIX_MAX; radix++){
+		Test_Reference_Radix(value, radix, expected);
+		pDigits = Conv_Render_Radix(value, radix, &New_Buffer[CONV_RADIX_SIZE - 1]);
+		Test_Check(0 == strcmp((char *)pDigits, expected), "Conv_Render_Radix", value, pDigits, expected);
+	}
+}
+
+static void Test_Old_Matches(uint32 value){
+	char expected[CONV_RADIX_SIZE];
+	/* The old routines print nothing for 0, the value was shown as an empty entry */
+	if(0 == value){
+		return;
+	}
+	else{ /* Do Nothing */ }
+	Old_Hexadecimal(value);
+	Old_LCD[Old_LCD_Length] = '\0';
+	snprintf(expected, sizeof(expected), "%X", value);
+	Test_Check(0 == strcmp((char *)Old_LCD, expected), "old hexadecimal", value, Old_LCD, expected);
+	Old_Decimal(value);
+	Old_LCD[Old_LCD_Length] = '\0';
+	snprintf(expected, sizeof(expected), "%u", value);
+	Test_Check(0 == strcmp((char *)Old_LCD, expected), "old decimal", value, Old_LCD, expected);
+}
+
+/**=============================================
+  * @Fn				- Test_Time
+  * @brief 			- Times a conversion over "Test_Values"
+  * @param [in] 	- pfConvert: Conversion to be timed
+  * @retval 		- Cycles per conversion, the least of TEST_ROUNDS rounds
+  * Note			- None
+  */
+static double Test_Time(void (*pfConvert)(uint32)){
+	uint64 start, cycles, best = ~0ULL;
+	uint32 round, index;
+	for(round = 0; round < TEST_ROUNDS; round++){
+		start = __rdtsc();
+		for(index = 0; index < TEST_VALUES; index++){
+			pfConvert((uint32)Test_Values[index]);
+		}
+		cycles = __rdtsc() - start;
+		best = (cycles < best) ? cycles : best;
+	}
+	return (double)best / TEST_VALUES;
+}
+
+static void Test_Compare(const char *name, void (*pfOld)(uint32), void (*pfNew)(uint32)){
+	double old_cycles = Test_Time(pfOld), new_cycles = Test_Time(pfNew);
+	printf("  %-28s %10.1f %10.1f %8.1fx\n", name, old_cycles, new_cycles, old_cycles / new_cycles);
+}
+
+/**=============================================
+  * @Fn				- Test_Radix_Chunks
+  * @brief 			- Regenerates "Conv_Radix_Chunks" and compares it with the table in conversion.c
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Prints the regenerated rows in the layout of conversion.c if they differ
+  */
+static void Test_Radix_Chunks(void){
+	conv_chunk_t chunks[CONV_RADIX_MAX - CONV_RADIX_MIN + 1];
+	uint64 power;
+	uint8 radix, index, differs = 0;
+	char got[24], expected[24];
+	for(radix = CONV_RADIX_MIN; radix <= CONV_RADIX_MAX; radix++){
+		index = radix - CONV_RADIX_MIN;
+		chunks[index].digits = 0;
+		for(power = 1; CONV_U32_MAX >= (power * radix); power *= radix){
+			chunks[index].digits++;
+		}
+		chunks[index].divisor = (uint32)power;
+		snprintf(got, sizeof(got), "%lu^%u", (unsigned long)Conv_Radix_Chunks[index].divisor, Conv_Radix_Chunks[index].digits);
+		snprintf(expected, sizeof(expected), "%lu^%u", (unsigned long)chunks[index].divisor, chunks[index].digits);
+		Test_Check(0 == strcmp(got, expected), "Conv_Radix_Chunks", radix, (uint8 *)got, expected);
+		differs |= (0 != strcmp(got, expected)) ? 1 : 0;
+	}
+	if(1 == differs){
+		printf("Regenerated Conv_Radix_Chunks:\n");
+		for(index = 0; index <= (CONV_RADIX_MAX - CONV_RADIX_MIN); index += 4){
+			printf("\t\t");
+			for(radix = index; (radix < (index + 4)) && (radix <= (CONV_RADIX_MAX - CONV_RADIX_MIN)); radix++){
+				printf("{%10luUL, %2u}, ", (unsigned long)chunks[radix].divisor, chunks[radix].digits);
+			}
+			printf("// %u...%u\n", index + CONV_RADIX_MIN, ((radix - 1) + CONV_RADIX_MIN));
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Test_Time_Radix
+  * @brief 			- Times the digits of "Test_Values" in one radix
+  * @param [in] 	- radix: Radix of the digits
+  * @param [in] 	- chunked: 1 for Conv_Render_Radix, 0 for one 64-bit division per digit
+  * @retval 		- Cycles per digit, the least of TEST_ROUNDS rounds
+  * Note			- None
+  */
+static double Test_Time_Radix(uint8 radix, uint8 chunked){
+	char reference[CONV_RADIX_SIZE];
+	uint64 start, cycles, best = ~0ULL, digits = 0;
+	uint32 round, index;
+	for(index = 0; index < TEST_VALUES; index++){
+		digits += strlen((char *)Conv_Render_Radix(Test_Values[index], radix, &New_Buffer[CONV_RADIX_SIZE - 1]));
+	}
+	Test_Digits = digits;
+	for(round = 0; round < (TEST_ROUNDS / 4); round++){
+		start = __rdtsc();
+		for(index = 0; index < TEST_VALUES; index++){
+			if(1 == chunked){
+				Test_Sink = *Conv_Render_Radix(Test_Values[index], radix, &New_Buffer[CONV_RADIX_SIZE - 1]);
+			}
+			else{
+				Test_Reference_Radix(Test_Values[index], radix, reference);
+				Test_Sink = reference[0];
+			}
+		}
+		cycles = __rdtsc() - start;
+		best = (cycles < best) ? cycles : best;
+	}
+	return (double)best / digits;
+}
+
+/**=============================================
+  * @Fn				- Test_Board_Cycles
+  * @brief 			- Estimates the Cortex-M3 cycles per digit of Conv_Render_Radix over "Test_Values"
+  * @param [in] 	- radix: Radix of the digits
+  * @retval 		- Cycles per digit
+  * Note			- The 64-bit divisions are counted, one per chunk, every digit takes one UDIV
+  */
+static double Test_Board_Cycles(uint8 radix){
+	const conv_chunk_t *pChunk = &Conv_Radix_Chunks[radix - CONV_RADIX_MIN];
+	uint64 value, divisions = 0;
+	uint32 index;
+	for(index = 0; index < TEST_VALUES; index++){
+		for(value = Test_Values[index]; CONV_U32_MAX < value; value /= pChunk->divisor){
+			divisions++;
+		}
+	}
+	return ((double)(divisions * TEST_CYCLES_DIVISION) / Test_Digits) + TEST_CYCLES_UDIV + TEST_CYCLES_DIGIT;
+}
+
+static void Test_Radix_Cycles(void){
+	uint8 radix, width;
+	uint32 index;
+	double chunked[2], plain[2], board;
+	printf("Cycles per digit of Conv_Render_Radix (chunks) against one 64-bit division per digit (digits),\n");
+	printf("on the PC and estimated for the Cortex-M3 from the divisions made, full length values\n");
+	printf("  %5s %14s %14s %14s %14s %18s\n", "radix", "32-bit chunks", "32-bit digits", "64-bit chunks", "64-bit digits", "M3 64-bit chunks");
+	for(radix = CONV_RADIX_MIN; radix <= CONV_RADIX_MAX; radix++){
+		for(width = 0; width < 2; width++){
+			/* Full length values of the width */
+			Test_Random = 0x9E3779B97F4A7C15ULL + radix;
+			for(index = 0; index < TEST_VALUES; index++){
+				Test_Values[index] = (0 == width) ? (Test_Next_Random() | 0x80000000ULL) & CONV_U32_MAX : (Test_Next_Random() | (1ULL << 63));
+			}
+			chunked[width] = Test_Time_Radix(radix, 1);
+			plain[width] = Test_Time_Radix(radix, 0);
+		}
+		board = Test_Board_Cycles(radix);
+		printf("  %5u %14.1f %14.1f %14.1f %14.1f %18.1f\n", radix, chunked[0], plain[0], chunked[1], plain[1], board);
+	}
+	printf("  A digit made with its own 64-bit division takes %lu cycles on the Cortex-M3\n", TEST_CYCLES_DIVISION + TEST_CYCLES_DIGIT);
+}
+
+static void Test_Old_All_Bases(uint32 value){
+	Old_Decimal(value);
+	Old_Octal(value);
+	Old_Binary(value);
+	Old_Hexadecimal(value);
+}
+
+int main(void){
+	uint32 index;
+	uint8 bits;
+
+	Test_Value(0);
+	for(bits = 0; bits < 64; bits++){
+		Test_Value(1ULL << bits);
+		Test_Value((1ULL << bits) - 1);
+		Test_Value(~0ULL >> bits);
+	}
+	Test_Value(99999999ULL);
+	Test_Value(100000000ULL);
+	Test_Value(4294967295ULL);
+	Test_Value(4294967296ULL);
+	Test_Value(10000000000000000000ULL);
+	for(index = 0; index < TEST_RANDOM_VALUES; index++){
+		/* Random lengths, so short values are checked as often as long ones */
+		Test_Value(Test_Next_Random() >> (index % 64));
+	}
+	for(index = 0; index < TEST_VALUES; index++){
+		/* Full range of the 32-bit entry of numbering mode */
+		Test_Values[index] = Test_Next_Random() >> (32 + (index % 32));
+		Test_Old_Matches((uint32)Test_Values[index]);
+	}
+
+	printf("Cycles of the PC per conversion of a 32-bit value, %u values of every length\n", TEST_VALUES);
+	printf("  %-28s %10s %10s %9s\n", "conversion", "before", "after", "speedup");
+	Test_Compare("decimal", Old_Decimal, New_Decimal);
+	Test_Compare("octal", Old_Octal, New_Octal);
+	Test_Compare("binary", Old_Binary, New_Binary);
+	Test_Compare("hexadecimal", Old_Hexadecimal, New_Hexadecimal);
+	Test_Compare("all four bases", Test_Old_All_Bases, New_All_Bases);
+	Test_Compare("hexadecimal entry to decimal", Old_Parse_Hexadecimal, New_Parse_Hexadecimal);
+	Test_Compare("binary entry to decimal", Old_Parse_Binary, New_Parse_Binary);
+
+	Test_Radix_Chunks();
+	Test_Radix_Cycles();
+
+	printf("test_conversion: %u checks, %u failed\n", Test_Checks, Test_Failures);
+	return (0 == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : test_hsm.c 			                         		 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "states.h"
+
+/*
+ * Drives event sequences through the state machine framework of "states" and checks the transitions:
+ * the hooks and actions that ran, in order, the current state and the state records of the trace.
+ * The machine is shaped like the calculator, a parent takes 'C' for its children and the second 'C'
+ * in a row stops the machine.
+ */
+
+#define TEST_LOG_SIZE		256
+
+typedef enum{
+	TM_Idle,				// Parent of the entry states, takes 'C'
+	TM_First_Operand,
+	TM_Second_Operand,
+	TM_Result,				// Top state
+	TM_Confirm_Exit,		// Top state, a second 'C' stops the machine
+	test_states_max
+}test_state_t;
+
+static char Test_Log[TEST_LOG_SIZE];
+static uint16 Test_Trace[32];
+static uint8 Test_Trace_Count;
+static uint32 Test_Checks, Test_Failures;
+static uint8 Test_Action_Target = HSM_TABLE_NEXT;
+
+/* Fake of the trace, keeps the state records */
+void Trace_Record(uint8 id, uint16 arg){
+	if((TRACE_ID_STATE == id) && (Test_Trace_Count < (sizeof(Test_Trace) / sizeof(Test_Trace[0])))){
+		Test_Trace[Test_Trace_Count] = arg;
+		Test_Trace_Count++;
+	}
+	else{ /* Do Nothing */ }
+}
+
+static void Test_Log_Add(const char *text){
+	strncat(Test_Log, text, TEST_LOG_SIZE - strlen(Test_Log) - 1);
+}
+
+static void Entry_First(void){ Test_Log_Add("+first "); }
+static void Exit_First(void){ Test_Log_Add("-first "); }
+static void Entry_Second(void){ Test_Log_Add("+second "); }
+static void Exit_Second(void){ Test_Log_Add("-second "); }
+static void Entry_Result(void){ Test_Log_Add("+result "); }
+static void Exit_Result(void){ Test_Log_Add("-result "); }
+static void Entry_Confirm(void){ Test_Log_Add("+confirm "); }
+static void Exit_Confirm(void){ Test_Log_Add("-confirm "); }
+
+static hsm_state_t Action_Digit(hsm_event_t event){
+	char text[8];
+	snprintf(text, sizeof(text), "d%u ", event);
+	Test_Log_Add(text);
+	return HSM_INTERNAL;
+}
+
+static hsm_state_t Action_Operator(hsm_event_t event){ Test_Log_Add("op "); return HSM_TABLE_NEXT; }
+static hsm_state_t Action_Equal(hsm_event_t event){ Test_Log_Add("eq "); return Test_Action_Target; }
+static hsm_state_t Action_Clear(hsm_event_t event){ Test_Log_Add("clear "); return HSM_TABLE_NEXT; }
+static hsm_state_t Action_Quit(hsm_event_t event){ Test_Log_Add("quit "); return HSM_TABLE_NEXT; }
+
+#define DIGITS		{Action_Digit, HSM_INTERNAL}, {Action_Digit, HSM_INTERNAL}, {Action_Digit, HSM_INTERNAL}, \
+					{Action_Digit, HSM_INTERNAL}, {Action_Digit, HSM_INTERNAL}, {Action_Digit, HSM_INTERNAL}, \
+					{Action_Digit, HSM_INTERNAL}, {Action_Digit, HSM_INTERNAL}, {Action_Digit, HSM_INTERNAL}, \
+					{Action_Digit, HSM_INTERNAL}
+#define NO_DIGITS	{NULL}, {NULL}, {NULL}, {NULL}, {NULL}, {NULL}, {NULL}, {NULL}, {NULL}, {NULL}
+#define PASS		{NULL}
+
+/* Events: 0...9, +, -, x, /, =, C */
+static const hsm_transition_t Test_Table[test_states_max * hsm_key_events_max] = {
+	/* TM_Idle */
+	NO_DIGITS, PASS, PASS, PASS, PASS, PASS, {Action_Clear, TM_Confirm_Exit},
+	/* TM_First_Operand */
+	DIGITS, {Action_Operator, TM_Second_Operand}, {Action_Operator, TM_Second_Operand},
+	{Action_Operator, TM_Second_Operand}, {Action_Operator, TM_Second_Operand}, PASS, PASS,
+	/* TM_Second_Operand */
+	DIGITS, PASS, PASS, PASS, PASS, {Action_Equal, TM_Result}, PASS,
+	/* TM_Result */
+	NO_DIGITS, PASS, PASS, PASS, PASS, PASS, {HSM_Transit, TM_First_Operand},
+	/* TM_Confirm_Exit */
+	NO_DIGITS, PASS, PASS, PASS, PASS, {HSM_Transit, TM_First_Operand}, {Action_Quit, HSM_NO_STATE},
+};
+
+static const hsm_state_info_t Test_States[test_states_max] = {
+	[TM_Idle]			= {HSM_NO_STATE, NULL, NULL},
+	[TM_First_Operand]	= {TM_Idle, Entry_First, Exit_First},
+	[TM_Second_Operand]	= {TM_Idle, Entry_Second, Exit_Second},
+	[TM_Result]			= {HSM_NO_STATE, Entry_Result, Exit_Result},
+	[TM_Confirm_Exit]	= {HSM_NO_STATE, Entry_Confirm, Exit_Confirm},
+};
+
+static const hsm_machine_t Test_Machine = {
+	Test_Table, Test_States, test_states_max, hsm_key_events_max, TM_First_Operand, TRACE_SRC_CALCULATOR
+};
+
+static hsm_t Test_HSM = {&Test_Machine, HSM_NO_STATE};
+
+/**=============================================
+  * @Fn				- Test_Sequence
+  * @brief 			- Dispatches the events of a key sequence and checks what ran and where it ended
+  * @param [in] 	- keys: Keys to be dispatched, as returned by keypad_Get_Pressed_Key
+  * @param [in] 	- expected_log: Hooks and actions expected to run, in order
+  * @param [in] 	- expected_state: State expected at the end
+  * @retval 		- None
+  * Note			- None
+  */
+static void Test_Sequence(const char *keys, const char *expected_log, hsm_state_t expected_state){
+	const char *pKey;
+	Test_Log[0] = '\0';
+	for(pKey = keys; '\0' != *pKey; pKey++){
+		HSM_Dispatch(&Test_HSM, HSM_Key_Event(('0' <= *pKey) && ('9' >= *pKey) ? (uint8)(*pKey - '0') : (uint8)*pKey));
+	}
+	Test_Checks++;
+	if((0 != strcmp(Test_Log, expected_log)) || (expected_state != Test_HSM.current)){
+		Test_Failures++;
+		printf("  FAILED: \"%s\" ran \"%s\" and ended in %u, expected \"%s\" and %u\n",
+				keys, Test_Log, Test_HSM.current, expected_log, expected_state);
+	}
+	else{ /* Do Nothing */ }
+}
+
+static void Test_Trace_Records(const uint8 *states, uint8 count){
+	uint8 index;
+	Test_Checks++;
+	for(index = 0; index < count; index++){
+		if((index >= Test_Trace_Count) || (Test_Trace[index] != ((TRACE_SRC_CALCULATOR << 8) | states[index]))){
+			Test_Failures++;
+			printf("  FAILED: state record %u\n", index);
+			return;
+		}
+		else{ /* Do Nothing */ }
+	}
+	if(count != Test_Trace_Count){
+		Test_Failures++;
+		printf("  FAILED: %u state records, expected %u\n", Test_Trace_Count, count);
+	}
+	else{ /* Do Nothing */ }
+}
+
+static void Test_Keys(void){
+	uint8 key;
+	const uint8 keys[] = {'+', '-', 'x', '/', '=', 'C'};
+	Test_Checks++;
+	for(key = 0; key < 10; key++){
+		Test_Failures += ((key != HSM_Key_Event(key)) || (key != HSM_Event_Key(key))) ? 1 : 0;
+	}
+	for(key = 0; key < sizeof(keys); key++){
+		Test_Failures += ((EV_KEY_PLUS + key) != HSM_Key_Event(keys[key])) ? 1 : 0;
+		Test_Failures += (keys[key] != HSM_Event_Key(EV_KEY_PLUS + key)) ? 1 : 0;
+	}
+	Test_Failures += (hsm_key_events_max != HSM_Key_Event('?')) ? 1 : 0;
+}
+
+int main(void){
+	const uint8 started[] = {TM_First_Operand, TM_Second_Operand, TM_Result};
+	const uint8 stopped[] = {TM_Confirm_Exit, HSM_NO_STATE, TM_First_Operand};
+
+	Test_Keys();
+
+	/* Started by the first event, digits are internal, an operator moves on by the table */
+	Test_Sequence("12", "+first d1 d2 ", TM_First_Operand);
+	Test_Sequence("+3", "op -first +second d3 ", TM_Second_Operand);
+	/* A key no state handles changes nothing */
+	Test_Sequence("+", "", TM_Second_Operand);
+	/* The action returns HSM_TABLE_NEXT, the table says TM_Result */
+	Test_Sequence("=", "eq -second +result ", TM_Result);
+	Test_Trace_Records(started, sizeof(started));
+
+	/* An action overrides the table, HSM_INTERNAL keeps the state without hooks */
+	Test_Sequence("C4+", "-result +first d4 op -first +second ", TM_Second_Operand);
+	Test_Action_Target = HSM_INTERNAL;
+	Test_Sequence("=", "eq ", TM_Second_Operand);
+	Test_Action_Target = TM_Second_Operand;
+	Test_Sequence("=", "eq -second +second ", TM_Second_Operand);
+	Test_Action_Target = HSM_TABLE_NEXT;
+
+	/* 'C' is left to the parent, '=' cancels the exit, a second 'C' stops the machine */
+	Test_Sequence("C", "clear -second +confirm ", TM_Confirm_Exit);
+	Test_Sequence("=", "-confirm +first ", TM_First_Operand);
+	Test_Trace_Count = 0;
+	Test_Sequence("CC", "clear -first +confirm quit -confirm ", HSM_NO_STATE);
+	/* A stopped machine enters its initial state again on the next event */
+	Test_Sequence("7", "+first d7 ", TM_First_Operand);
+	Test_Trace_Records(stopped, sizeof(stopped));
+
+	/* Resumed after a warm restart: no entry hook, the events go on from that state */
+	HSM_Resume(&Test_HSM, TM_Result);
+	Test_Sequence("5C", "-result +first ", TM_First_Operand);
+	HSM_Resume(&Test_HSM, HSM_NO_STATE);
+	HSM_Start(&Test_HSM);
+	Test_Sequence("", "", TM_First_Operand);
+
+	printf("test_hsm: %u checks, %u failed\n", Test_Checks, Test_Failures);
+	return (0 == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,442 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : test_number_theory.c 		                         */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include "number_theory.h"
+
+/*
+ * Runs PRIME, FACTOR and POWMOD jobs of the number theory mode slice by slice on the hardest 64-bit inputs,
+ * checks the results against 128-bit arithmetic and measures the work of every slice.
+ * The work of a slice is replayed from the job before the slice with the same operations, the replay must
+ * end where the firmware ended, and is counted in double-and-add steps of NT_MulMod, 64-bit divisions and
+ * steps of the binary GCD. The counts are exact, the cycles are these counts times the costs below.
+ */
+
+/* Cortex-M3 cycles of the operations, from the Thumb-2 sequences GCC emits for them (TRM instruction timings),
+ * an estimate until the table is measured with the DWT counter on the board */
+#define TEST_CYCLES_LADDER_STEP		27UL	// One double-and-add step whose bit is set: two NT_AddMod, shift, loop
+#define TEST_CYCLES_MULMOD_CALL		325UL	// Call, saved registers and the two reductions of NT_MulMod
+#define TEST_CYCLES_SHORT_MULMOD	190UL	// NT_MulMod with a modulus below 2^32: one multiplication and __aeabi_uldivmod
+#define TEST_CYCLES_DIVISION		150UL	// __aeabi_uldivmod, 64-bit dividend
+#define TEST_CYCLES_GCD_STEP		20UL	// One step of the binary GCD: count trailing zeros, shift, compare, subtract
+#define TEST_CYCLES_RHO_STEP		40UL	// Bookkeeping of one rho iteration besides its four NT_MulMod
+#define TEST_FCPU_KHZ				8000UL
+
+#define TEST_SEMIPRIMES				200			// Random products of two primes of 32 bits
+#define TEST_RANDOM_NUMBERS			2000		// Random 64-bit numbers
+
+typedef struct{
+	uint64 ladder_steps;
+	uint64 mulmods;
+	uint64 short_mulmods;
+	uint64 divisions;
+	uint64 gcd_steps;
+	uint64 rho_steps;
+}test_cost_t;
+
+typedef struct{
+	const char *name;
+	uint64 slices;
+	uint64 worst_cycles;
+	test_cost_t worst;
+	uint64 input;
+}test_phase_t;
+
+static test_phase_t Test_Phases[] = {
+	[NT_PHASE_POWMOD]			= {"POWMOD, 8 exponent bits"},
+	[NT_PHASE_TRIAL]			= {"TRIAL, divisors below 256"},
+	[NT_PHASE_NEXT_COMPOSITE]	= {"NEXT_COMPOSITE"},
+	[NT_PHASE_PRIME_TEST]		= {"PRIME_TEST, one witness"},
+	[NT_PHASE_RHO]				= {"RHO, 64 iterations"},
+};
+
+static const uint8 Test_MR_Bases[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+static uint64 Test_Random = 88172645463325252ULL;
+static uint32 Test_Checks, Test_Failures;
+static uint64 Test_Worst_Rho_Steps, Test_Worst_Rho_Input;
+static uint64 Test_Worst_Job_Cycles, Test_Worst_Job_Input;
+
+static uint64 Test_Next_Random(void){
+	/* xorshift64 */
+	Test_Random ^= Test_Random << 13;
+	Test_Random ^= Test_Random >> 7;
+	Test_Random ^= Test_Random << 17;
+	return Test_Random;
+}
+
+static void Test_Check(uint8 condition, const char *what, uint64 input){
+	Test_Checks++;
+	if(!condition){
+		Test_Failures++;
+		printf("  FAILED: %s for %llu\n", what, (unsigned long long)input);
+	}
+	else{ /* Do Nothing */ }
+}
+
+static uint64 Test_Cycles(const test_cost_t *cost){
+	return (cost->ladder_steps * TEST_CYCLES_LADDER_STEP) + (cost->mulmods * TEST_CYCLES_MULMOD_CALL) +
+			(cost->short_mulmods * TEST_CYCLES_SHORT_MULMOD) + (cost->divisions * TEST_CYCLES_DIVISION) +
+			(cost->gcd_steps * TEST_CYCLES_GCD_STEP) + (cost->rho_steps * TEST_CYCLES_RHO_STEP);
+}
+
+static uint64 Test_Cycles_To_Us(uint64 cycles){
+	return (cycles * 1000UL) / TEST_FCPU_KHZ;
+}
+
+/**=============================================
+  * @Fn				- Test_MulMod
+  * @brief 			- NT_MulMod with its cost counted
+  * @param [in] 	- a, b, m: Operands of NT_MulMod
+  * @param [out] 	- cost: Cost to be increased
+  * @retval 		- (a * b) mod m
+  * Note			- A step whose bit is clear is counted as a full step, the table is a worst case
+  */
+static uint64 Test_MulMod(uint64 a, uint64 b, uint64 m, test_cost_t *cost){
+	uint64 bits = b % m;
+	if(0xFFFFFFFFULL >= m){
+		cost->short_mulmods++;
+	}
+	else{
+		cost->mulmods++;
+		while(0 != bits){
+			cost->ladder_steps++;
+			bits >>= 1;
+		}
+	}
+	return NT_MulMod(a, b, m);
+}
+
+static uint64 Test_AddMod(uint64 a, uint64 b, uint64 m){
+	return (uint64)(((unsigned __int128)a + b) % m);
+}
+
+static uint64 Test_GCD(uint64 a, uint64 b, test_cost_t *cost){
+	uint64 x = a, y = b, temp;
+	if((0 != x) && (0 != y)){
+		x >>= __builtin_ctzll(x);
+		do{
+			cost->gcd_steps++;
+			y >>= __builtin_ctzll(y);
+			if(x > y){
+				temp = x;
+				x = y;
+				y = temp;
+			}
+			else{ /* Do Nothing */ }
+			y -= x;
+		}while(0 != y);
+	}
+	else{ /* Do Nothing */ }
+	return NT_GCD(a, b);
+}
+
+static uint64 Test_PowMod(uint64 base, uint64 exp, uint64 m, test_cost_t *cost){
+	uint64 result = 1 % m;
+	base %= m;
+	while(0 != exp){
+		if(exp & 1){
+			result = Test_MulMod(result, base, m, cost);
+		}
+		else{ /* Do Nothing */ }
+		base = Test_MulMod(base, base, m, cost);
+		exp >>= 1;
+	}
+	return result;
+}
+
+static uint8 Test_Is_Prime(uint64 n){
+	uint64 d = n - 1, x;
+	uint8 s = 0, base, index;
+	if(2 > n){
+		return 0;
+	}
+	else if(0 == (n & 1)){
+		return (2 == n) ? 1 : 0;
+	}
+	else{ /* Do Nothing */ }
+	while(0 == (d & 1)){
+		d >>= 1;
+		s++;
+	}
+	for(base = 0; base < sizeof(Test_MR_Bases); base++){
+		if(0 == (n % Test_MR_Bases[base])){
+			return (n == Test_MR_Bases[base]) ? 1 : 0;
+		}
+		else{ /* Do Nothing */ }
+		x = 1;
+		{
+			unsigned __int128 power = Test_MR_Bases[base], result = 1;
+			uint64 exp = d;
+			while(0 != exp){
+				if(exp & 1){
+					result = (result * power) % n;
+				}
+				else{ /* Do Nothing */ }
+				power = (power * power) % n;
+				exp >>= 1;
+			}
+			x = (uint64)result;
+		}
+		if((1 == x) || ((n - 1) == x)){
+			continue;
+		}
+		else{ /* Do Nothing */ }
+		for(index = 1; index < s; index++){
+			x = (uint64)(((unsigned __int128)x * x) % n);
+			if((n - 1) == x){
+				break;
+			}
+			else{ /* Do Nothing */ }
+		}
+		if(index == s){
+			return 0;
+		}
+		else{ /* Do Nothing */ }
+	}
+	return 1;
+}
+
+static uint64 Test_Random_Prime(uint64 low, uint64 high){
+	uint64 n;
+	do{
+		n = (low + (Test_Next_Random() % (high - low))) | 1;
+	}while(!Test_Is_Prime(n));
+	return n;
+}
+
+/**=============================================
+  * @Fn				- Test_Replay_Slice
+  * @brief 			- Replays the slice the firmware did and counts its cost
+  * @param [in] 	- before: Job before the slice
+  * @param [in] 	- after: Job after the slice
+  * @param [out] 	- cost: Cost of the slice
+  * @retval 		- 1 if the replay ended where the firmware ended
+  * Note			- None
+  */
+static uint8 Test_Replay_Slice(const nt_job_t *before, const nt_job_t *after, test_cost_t *cost){
+	uint64 n = before->current, x, y, q, c, divisor;
+	uint32 steps, index;
+	uint8 matches = 1;
+
+	switch(before->phase){
+	case NT_PHASE_POWMOD:
+		x = before->result;
+		y = before->pow_base;
+		q = before->pow_exp;
+		for(index = 0; (index < NT_POW_SLICE_BITS) && (0 != q); index++){
+			if(q & 1){
+				x = Test_MulMod(x, y, before->pow_mod, cost);
+			}
+			else{ /* Do Nothing */ }
+			y = Test_MulMod(y, y, before->pow_mod, cost);
+			q >>= 1;
+		}
+		matches = (x == after->result) && ((0 == q) || ((y == after->pow_base) && (q == after->pow_exp)));
+		break;
+	case NT_PHASE_TRIAL:
+		for(divisor = 2; (divisor < NT_TRIAL_LIMIT) && ((divisor * divisor) <= n); divisor = (2 == divisor) ? 3 : (divisor + 2)){
+			cost->divisions++;
+			while(0 == (n % divisor)){
+				cost->divisions += 2;
+				n /= divisor;
+			}
+			if((NT_OP_PRIME == before->operation) && (n != before->current)){
+				break;
+			}
+			else{ /* Do Nothing */ }
+		}
+		break;
+	case NT_PHASE_PRIME_TEST:
+		x = Test_PowMod(Test_MR_Bases[before->mr_base_index], before->mr_d, n, cost);
+		if((1 != x) && ((n - 1) != x)){
+			for(index = 1; index < before->mr_s; index++){
+				x = Test_MulMod(x, x, n, cost);
+				if((n - 1) == x){
+					break;
+				}
+				else{ /* Do Nothing */ }
+			}
+		}
+		else{ /* Do Nothing */ }
+		break;
+	case NT_PHASE_RHO:
+		x = before->rho_x;
+		y = before->rho_y;
+		q = before->rho_q;
+		c = before->rho_c;
+		steps = before->rho_steps;
+		while(steps != after->rho_steps){
+			x = Test_AddMod(Test_MulMod(x, x, n, cost), c, n);
+			y = Test_AddMod(Test_MulMod(y, y, n, cost), c, n);
+			y = Test_AddMod(Test_MulMod(y, y, n, cost), c, n);
+			q = Test_MulMod(q, (x > y) ? (x - y) : (y - x), n, cost);
+			cost->rho_steps++;
+			steps++;
+			if(0 == (steps % NT_RHO_GCD_BATCH)){
+				divisor = Test_GCD(q, n, cost);
+				if(n == divisor){
+					/* The firmware restarted the polynomial, the slice ends here */
+					matches = (steps == after->rho_steps) && ((c + 1) == after->rho_c);
+					break;
+				}
+				else{ /* Do Nothing */ }
+			}
+			else{ /* Do Nothing */ }
+		}
+		if((NT_PHASE_RHO == after->phase) && (c == after->rho_c)){
+			matches = (x == after->rho_x) && (y == after->rho_y) && (q == after->rho_q);
+		}
+		else{ /* Do Nothing */ }
+		break;
+	default:
+		break;
+	}
+	return matches;
+}
+
+/**=============================================
+  * @Fn				- Test_Run_Job
+  * @brief 			- Runs a job to its end, replaying and timing every slice
+  * @param [in] 	- job: Job started with NT_Job_Start
+  * @param [in] 	- input: Number of the job, for the report
+  * @retval 		- Status the job ended with
+  * Note			- None
+  */
+static nt_job_status_t Test_Run_Job(nt_job_t *job, uint64 input){
+	nt_job_t before;
+	test_cost_t cost;
+	uint64 cycles, job_cycles = 0;
+	nt_job_status_t status = job->status;
+	while(NT_JOB_BUSY == status){
+		before = *job;
+		status = NT_Job_Step(job);
+		memset(&cost, 0, sizeof(cost));
+		Test_Check(Test_Replay_Slice(&before, job, &cost), "replay of a slice", input);
+		cycles = Test_Cycles(&cost);
+		job_cycles += cycles;
+		Test_Phases[before.phase].slices++;
+		if(cycles > Test_Phases[before.phase].worst_cycles){
+			Test_Phases[before.phase].worst_cycles = cycles;
+			Test_Phases[before.phase].worst = cost;
+			Test_Phases[before.phase].input = input;
+		}
+		else{ /* Do Nothing */ }
+		if((NT_PHASE_RHO == before.phase) && (job->rho_steps > Test_Worst_Rho_Steps)){
+			Test_Worst_Rho_Steps = job->rho_steps;
+			Test_Worst_Rho_Input = before.current;
+		}
+		else{ /* Do Nothing */ }
+	}
+	if(job_cycles > Test_Worst_Job_Cycles){
+		Test_Worst_Job_Cycles = job_cycles;
+		Test_Worst_Job_Input = input;
+	}
+	else{ /* Do Nothing */ }
+	return status;
+}
+
+static void Test_Factor(uint64 n){
+	nt_job_t job;
+	unsigned __int128 product = 1;
+	uint8 index, power;
+	NT_Job_Start(&job, NT_OP_FACTOR, n, 0, 0);
+	Test_Check(NT_JOB_DONE == Test_Run_Job(&job, n), "factorization within NT_RHO_STEP_BUDGET", n);
+	for(index = 0; index < job.factors_count; index++){
+		Test_Check(Test_Is_Prime(job.factors[index].prime), "prime factor", n);
+		for(power = 0; power < job.factors[index].exponent; power++){
+			product *= job.factors[index].prime;
+		}
+	}
+	Test_Check((n < 2) || (product == n), "product of the factors", n);
+}
+
+static void Test_Prime(uint64 n){
+	nt_job_t job;
+	NT_Job_Start(&job, NT_OP_PRIME, n, 0, 0);
+	Test_Run_Job(&job, n);
+	Test_Check(job.result == Test_Is_Prime(n), "prime test", n);
+}
+
+static void Test_PowMod_Job(uint64 base, uint64 exp, uint64 m){
+	nt_job_t job;
+	test_cost_t cost = {0};
+	NT_Job_Start(&job, NT_OP_POWMOD, base, exp, m);
+	Test_Run_Job(&job, m);
+	Test_Check(job.result == Test_PowMod(base, exp, m, &cost), "modular exponentiation", m);
+}
+
+static void Test_Print_Phase(const test_phase_t *phase){
+	printf("  %-26s %9llu %11llu %8llu %9llu %9llu %10llu %9llu.%03llu\n", phase->name,
+			(unsigned long long)phase->slices,
+			(unsigned long long)(phase->worst.mulmods + phase->worst.short_mulmods),
+			(unsigned long long)phase->worst.ladder_steps, (unsigned long long)phase->worst.divisions,
+			(unsigned long long)phase->worst.gcd_steps, (unsigned long long)phase->worst_cycles,
+			(unsigned long long)(Test_Cycles_To_Us(phase->worst_cycles) / 1000),
+			(unsigned long long)(Test_Cycles_To_Us(phase->worst_cycles) % 1000));
+}
+
+int main(void){
+	/* Largest primes below 2^32 and 2^64, so the rho and Miller-Rabin slices have full length operands */
+	const uint64 p1 = 4294967291ULL, p2 = 4294967279ULL, top_prime = 18446744073709551557ULL;
+	test_cost_t cost = {0};
+	uint64 p, q, worst_step_cycles;
+	uint32 index;
+	nt_phase_t phase;
+
+	Test_Factor(p1 * p2);
+	Test_Factor(p1 * p1);
+	Test_Factor(top_prime);
+	Test_Factor(18446744073709551615ULL);		// 3 5 17 257 641 65537 6700417
+	Test_Factor(9223372036854775808ULL);		// 2^63
+	Test_Factor(3825123056546413051ULL);		// Strong pseudoprime to the bases 2...23
+	Test_Factor(2147483647ULL * 2147483629ULL);
+	Test_Factor(1000003ULL * 1000033ULL * 1000037ULL);
+	Test_Prime(top_prime);
+	Test_Prime(3825123056546413051ULL);
+	Test_Prime(p1 * p2);
+	Test_PowMod_Job(top_prime - 1, 0xFFFFFFFFFFFFFFFFULL, top_prime);
+	Test_PowMod_Job(3, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL);
+	Test_PowMod_Job(7, 1000000007ULL, 4294967291ULL);
+
+	for(index = 0; index < TEST_SEMIPRIMES; index++){
+		p = Test_Random_Prime(1ULL << 31, 1ULL << 32);
+		q = Test_Random_Prime(1ULL << 31, 1ULL << 32);
+		Test_Factor(p * q);
+	}
+	for(index = 0; index < TEST_RANDOM_NUMBERS; index++){
+		p = Test_Next_Random();
+		Test_Factor(p);
+		Test_Prime(p | 1);
+	}
+
+	printf("Worst slice of every phase, Cortex-M3 at %lu MHz\n", TEST_FCPU_KHZ / 1000);
+	printf("  %-26s %9s %11s %8s %9s %9s %10s %13s\n", "phase", "slices", "NT_MulMod", "steps", "divisions",
+			"GCD steps", "cycles", "ms");
+	for(phase = NT_PHASE_POWMOD; phase < NT_PHASE_DONE; phase++){
+		Test_Print_Phase(&Test_Phases[phase]);
+	}
+
+	/* Worst rho iteration: four NT_MulMod with 64 steps each and its share of a GCD */
+	cost.mulmods = 4;
+	cost.ladder_steps = 4 * 64;
+	cost.rho_steps = 1;
+	cost.gcd_steps = 128 / NT_RHO_GCD_BATCH;
+	worst_step_cycles = Test_Cycles(&cost);
+	printf("NT_MulMod with a 64-bit modulus: %lu cycles, rho iteration: %llu cycles\n",
+			TEST_CYCLES_MULMOD_CALL + (64 * TEST_CYCLES_LADDER_STEP), (unsigned long long)worst_step_cycles);
+	printf("Most rho iterations for one cofactor: %llu (%llu), NT_RHO_STEP_BUDGET %lu is %llu s at the worst\n",
+			(unsigned long long)Test_Worst_Rho_Steps, (unsigned long long)Test_Worst_Rho_Input, NT_RHO_STEP_BUDGET,
+			(unsigned long long)Test_Cycles_To_Us(worst_step_cycles * NT_RHO_STEP_BUDGET) / 1000000ULL);
+	printf("Longest job: %llu, %llu ms\n", (unsigned long long)Test_Worst_Job_Input,
+			(unsigned long long)Test_Cycles_To_Us(Test_Worst_Job_Cycles) / 1000ULL);
+	Test_Check(NT_RHO_STEP_BUDGET > Test_Worst_Rho_Steps, "NT_RHO_STEP_BUDGET above the most rho iterations", Test_Worst_Rho_Steps);
+
+	printf("test_number_theory: %u checks, %u failed\n", Test_Checks, Test_Failures);
+	return (0 == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : test_nvic.c 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "nvic_driver.h"
+
+/*
+ * Checks the NVIC driver against a fake NVIC for every IRQ 0...42: the one bit written to the set and clear
+ * registers, the priority byte for every grouping, and that nothing is written for IRQs out of range.
+ * The fake keeps what every write to ISER/ICER/ISPR/ICPR put in the registers, like the write-1 registers
+ * of the core they read as written until the next write.
+ */
+
+#define TEST_REGS				4			// ISER, ICER, ISPR, ICPR
+#define TEST_WORDS				3
+
+/* Fake core, what nvic_driver.c sees behind NVIC and SCB */
+NVIC_TypeDef	SIM_NVIC;
+SCB_TypeDef		SIM_SCB;
+uint32			SIM_Primask;
+uint32			SIM_Basepri;
+
+static uint32 Test_Written[TEST_REGS][TEST_WORDS];	// Bits written since the last Test_Clear
+static uint32 Test_Writes;							// Calls of NVIC_REGISTER_WRITTEN and CPU_SYNC_BARRIER
+static uint32 Test_Failures;
+static uint32 Test_Checks;
+
+#define TEST_CHECK(_COND_, ...)	do{ Test_Checks++; if(!(_COND_)){ Test_Failures++; printf(__VA_ARGS__); printf("\n"); } }while(0)
+
+/**=============================================
+  * @Fn				- SIM_Sync
+  * @brief 			- Fake of the simulator hook, collects the bits written to the set and clear registers
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The registers read 0 again afterwards
+  */
+void SIM_Sync(void){
+	vuint32_t *pRegs[TEST_REGS] = {SIM_NVIC.ISER, SIM_NVIC.ICER, SIM_NVIC.ISPR, SIM_NVIC.ICPR};
+	uint8 reg, word;
+	for(reg = 0; reg < TEST_REGS; reg++){
+		for(word = 0; word < TEST_WORDS; word++){
+			Test_Written[reg][word] |= pRegs[reg][word];
+			pRegs[reg][word] = 0;
+		}
+	}
+	Test_Writes++;
+}
+
+/**=============================================
+  * @Fn				- Test_Clear
+  * @brief 			- Resets the fake NVIC and SCB
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void Test_Clear(void){
+	memset(&SIM_NVIC, 0, sizeof(SIM_NVIC));
+	memset(&SIM_SCB, 0, sizeof(SIM_SCB));
+	memset(Test_Written, 0, sizeof(Test_Written));
+	Test_Writes = 0;
+}
+
+/**=============================================
+  * @Fn				- Test_Only_Bit
+  * @brief 			- Checks that one register got exactly the bit of an IRQ and the others nothing
+  * @param [in] 	- reg: Register written, 0 ISER, 1 ICER, 2 ISPR, 3 ICPR
+  * @param [in] 	- irq: IRQ number
+  * @param [in] 	- pName: Name of the driver function
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void Test_Only_Bit(uint8 reg, uint8 irq, const char *pName){
+	uint8 index, word;
+	uint32 expected;
+	TEST_CHECK(0 != Test_Writes, "%s(%u): write not followed by the hook", pName, irq);
+	for(index = 0; index < TEST_REGS; index++){
+		for(word = 0; word < TEST_WORDS; word++){
+			expected = ((index == reg) && (word == (irq / 32))) ? (1UL << (irq % 32)) : 0;
+			TEST_CHECK(expected == Test_Written[index][word], "%s(%u): register %u word %u is 0x%08X, expected 0x%08X",
+					pName, irq, index, word, Test_Written[index][word], expected);
+		}
+	}
+}
+
+/**=============================================
+  * @Fn				- Test_Bits
+  * @brief 			- Enable, disable, set and clear pending for every IRQ, and the pending and active reads
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void Test_Bits(void){
+	uint8 irq, other;
+	for(irq = 0; irq < NVIC_IRQ_NUM; irq++){
+		Test_Clear();
+		MCAL_NVIC_Enable(irq);
+		Test_Only_Bit(0, irq, "MCAL_NVIC_Enable");
+		Test_Clear();
+		MCAL_NVIC_Disable(irq);
+		Test_Only_Bit(1, irq, "MCAL_NVIC_Disable");
+		Test_Clear();
+		MCAL_NVIC_Set_Pending(irq);
+		Test_Only_Bit(2, irq, "MCAL_NVIC_Set_Pending");
+		Test_Clear();
+		MCAL_NVIC_Clear_Pending(irq);
+		Test_Only_Bit(3, irq, "MCAL_NVIC_Clear_Pending");
+
+		/* Reads see only their own bit */
+		Test_Clear();
+		SIM_NVIC.ISPR[irq / 32] = 1UL << (irq % 32);
+		SIM_NVIC.IABR[irq / 32] = 1UL << (irq % 32);
+		for(other = 0; other < NVIC_IRQ_NUM; other++){
+			TEST_CHECK((other == irq) == MCAL_NVIC_Is_Pending(other), "MCAL_NVIC_Is_Pending(%u) with IRQ %u pending", other, irq);
+			TEST_CHECK((other == irq) == MCAL_NVIC_Is_Active(other), "MCAL_NVIC_Is_Active(%u) with IRQ %u active", other, irq);
+		}
+	}
+
+	/* IRQs the F103x8 does not have write nothing */
+	for(irq = NVIC_IRQ_NUM; irq != 0; irq++){
+		Test_Clear();
+		MCAL_NVIC_Enable(irq);
+		MCAL_NVIC_Disable(irq);
+		MCAL_NVIC_Set_Pending(irq);
+		MCAL_NVIC_Clear_Pending(irq);
+		MCAL_NVIC_Set_Priority(irq, 1, 1);
+		SIM_Sync();
+		TEST_CHECK(0 == memcmp(Test_Written, (uint32[TEST_REGS][TEST_WORDS]){{0}}, sizeof(Test_Written)), "IRQ %u out of range was written", irq);
+		TEST_CHECK(0 == memcmp((const void*)SIM_NVIC.IP, (uint8[80]){0}, sizeof(SIM_NVIC.IP)), "IRQ %u out of range set a priority", irq);
+		SIM_NVIC.ISPR[0] = 0xFFFFFFFFUL;
+		SIM_NVIC.IABR[0] = 0xFFFFFFFFUL;
+		TEST_CHECK(0 == MCAL_NVIC_Is_Pending(irq), "MCAL_NVIC_Is_Pending(%u) out of range", irq);
+		TEST_CHECK(0 == MCAL_NVIC_Is_Active(irq), "MCAL_NVIC_Is_Active(%u) out of range", irq);
+	}
+}
+
+/**=============================================
+  * @Fn				- Test_Reference_Priority
+  * @brief 			- Priority byte as the Cortex-M3 manual lays it out
+  * @param [in] 	- group: PRIGROUP, the preemption priority is bits 7...group+1, the subpriority bits group...0
+  * @param [in] 	- preempt: Preemption priority
+  * @param [in] 	- sub: Subpriority
+  * @param [out] 	- None
+  * @retval 		- Priority byte, bits 3...0 are not implemented
+  * Note			- With PRIGROUP below 3 the subpriority field lies in bits that are not implemented,
+  * 				  the 4 implemented bits are all preemption priority
+  */
+static uint8 Test_Reference_Priority(uint8 group, uint8 preempt, uint8 sub){
+	uint8 split = group + 1;
+	uint8 value;
+	if(4 > split){
+		value = (uint8)((preempt & 0x0F) << 4);
+	}
+	else{
+		value = (uint8)(((preempt & ((1U << (8 - split)) - 1)) << split) | ((sub & ((1U << (split - 4)) - 1)) << 4));
+	}
+	return value;
+}
+
+/**=============================================
+  * @Fn				- Test_Priorities
+  * @brief 			- Priority bytes and their order for every grouping, IRQ and system handler
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void Test_Priorities(void){
+	static const uint8 Systems[3] = {NVIC_SYSTEM_SVCALL, NVIC_SYSTEM_PENDSV, NVIC_SYSTEM_SYSTICK};
+	uint8 group, irq, preempt, sub, index, levels;
+	uint8 expected;
+	uint32 aircr;
+
+	for(group = 0; group < 8; group++){
+		Test_Clear();
+		MCAL_NVIC_Set_Priority_Grouping(group);
+		aircr = SIM_SCB.AIRCR;
+		TEST_CHECK(NVIC_AIRCR_VECTKEY == (aircr & 0xFFFF0000UL), "grouping %u: AIRCR 0x%08X without VECTKEY", group, aircr);
+		TEST_CHECK((uint32)group == ((aircr >> 8) & 7UL), "grouping %u: PRIGROUP field is %u", group, (uint32)((aircr >> 8) & 7UL));
+		TEST_CHECK(0 == (aircr & 0x0000F8FFUL), "grouping %u: AIRCR 0x%08X sets bits besides PRIGROUP", group, aircr);
+
+		for(irq = 0; irq < NVIC_IRQ_NUM; irq++){
+			for(preempt = 0; preempt < 16; preempt++){
+				for(sub = 0; sub < 16; sub++){
+					MCAL_NVIC_Set_Priority(irq, preempt, sub);
+					expected = Test_Reference_Priority(group, preempt, sub);
+					TEST_CHECK(expected == SIM_NVIC.IP[irq], "grouping %u IRQ %u (%u, %u): IP is 0x%02X, expected 0x%02X",
+							group, irq, preempt, sub, SIM_NVIC.IP[irq], expected);
+				}
+			}
+
+			/* Only the byte of the IRQ is written */
+			memset((void*)SIM_NVIC.IP, 0xA5, sizeof(SIM_NVIC.IP));
+			MCAL_NVIC_Set_Priority(irq, 0, 0);
+			for(index = 0; index < sizeof(SIM_NVIC.IP); index++){
+				TEST_CHECK((index == irq) || (0xA5 == SIM_NVIC.IP[index]), "grouping %u IRQ %u: IP of IRQ %u written", group, irq, index);
+			}
+		}
+
+		/* The core compares bits 7...group+1, a lower preemption priority preempts whatever the subpriorities */
+		levels = (3 > group) ? 16 : (uint8)(1U << (7 - group));
+		for(preempt = 1; preempt < levels; preempt++){
+			MCAL_NVIC_Set_Priority(0, preempt - 1, 15);
+			MCAL_NVIC_Set_Priority(1, preempt, 0);
+			TEST_CHECK((SIM_NVIC.IP[0] >> (group + 1)) < (SIM_NVIC.IP[1] >> (group + 1)),
+					"grouping %u: preemption priority %u does not preempt %u", group, preempt - 1, preempt);
+		}
+		/* Equal preemption priorities do not preempt, the subpriority only orders pending interrupts */
+		MCAL_NVIC_Set_Priority(0, 1, 0);
+		MCAL_NVIC_Set_Priority(1, 1, 15);
+		TEST_CHECK((SIM_NVIC.IP[0] >> (group + 1)) == (SIM_NVIC.IP[1] >> (group + 1)), "grouping %u: subpriority changes the preemption", group);
+		TEST_CHECK(SIM_NVIC.IP[0] <= SIM_NVIC.IP[1], "grouping %u: subpriority 0 is not taken first", group);
+
+		for(index = 0; index < 3; index++){
+			memset((void*)SIM_SCB.SHP, 0, sizeof(SIM_SCB.SHP));
+			MCAL_NVIC_Set_System_Priority(Systems[index], 2, 1);
+			expected = Test_Reference_Priority(group, 2, 1);
+			TEST_CHECK(expected == SIM_SCB.SHP[Systems[index] - 4], "grouping %u exception %u: SHP is 0x%02X, expected 0x%02X",
+					group, Systems[index], SIM_SCB.SHP[Systems[index] - 4], expected);
+		}
+		memset((void*)SIM_SCB.SHP, 0, sizeof(SIM_SCB.SHP));
+		for(index = 0; index < 16; index++){
+			if((NVIC_SYSTEM_SVCALL != index) && (NVIC_SYSTEM_PENDSV != index) && (NVIC_SYSTEM_SYSTICK != index)){
+				MCAL_NVIC_Set_System_Priority(index, 2, 1);
+			}
+			else{ /* Do Nothing */ }
+		}
+		TEST_CHECK(0 == memcmp((const void*)SIM_SCB.SHP, (uint8[12]){0}, sizeof(SIM_SCB.SHP)), "grouping %u: fixed exception got a priority", group);
+	}
+}
+
+int main(void){
+	Test_Bits();
+	Test_Priorities();
+	printf("test_nvic: %u checks, %u failed\n", Test_Checks, Test_Failures);
+	return (0 == Test_Failures) ? 0 : 1;
+}
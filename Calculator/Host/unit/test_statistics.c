@@ -0,0 +1,191 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : test_statistics.c 			                         */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "statistics.h"
+
+/*
+ * Feeds streams of TEST_SAMPLES samples to the Q.16 Welford accumulator of the statistics mode and compares
+ * the mean, variance and standard deviation with a double precision two pass reference at every power of 10.
+ * The errors are in units of the last place of the shown values, the LCD shows 2 decimals.
+ * Then fills an accumulator to STAT_COUNT_MAX with 0 and 999999 in turn, the largest sum and M2 it can hold, checks
+ * the exact mean and variance there, and that one more sample is refused with STAT_FULL and changes nothing.
+ */
+
+#define TEST_SAMPLES			1000000UL
+#define TEST_SAMPLE_MAX			999999UL
+#define TEST_Q16				65536.0
+#define TEST_Q8					256.0
+
+/* Largest errors accepted, well below the 0.01 the LCD shows */
+#define TEST_MEAN_MAX_ERROR		(1.0 / TEST_Q16)			// One unit of Q.16
+#define TEST_VAR_MAX_REL_ERROR	1e-8						// Relative, or TEST_VAR_MAX_ERROR if that is more
+#define TEST_VAR_MAX_ERROR		(4.0 / TEST_Q16)
+#define TEST_SD_MAX_ERROR		(0.5 / TEST_Q8 + 1e-6)		// Rounded to the nearest unit of Q.8
+
+typedef uint32 (*test_stream_t)(uint32 index);
+
+static uint32 Test_Samples[TEST_SAMPLES];
+static uint32 Test_Random;
+static uint32 Test_Failures;
+
+/**=============================================
+  * @Fn				- Test_Next_Random
+  * @brief 			- Park-Miller style generator, the same streams on every run
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Next random number
+  * Note			- None
+  */
+static uint32 Test_Next_Random(void){
+	Test_Random = (uint32)(((uint64)Test_Random * 48271UL) % 2147483647UL);
+	return Test_Random;
+}
+
+static uint32 Stream_Uniform(uint32 index){ (void)index; return Test_Next_Random() % (TEST_SAMPLE_MAX + 1); }
+static uint32 Stream_Constant(uint32 index){ (void)index; return 777777; }
+static uint32 Stream_Narrow_High(uint32 index){ (void)index; return 999000 + (Test_Next_Random() % 1000); }
+static uint32 Stream_Extremes(uint32 index){ return (0 == (index & 1)) ? 0 : TEST_SAMPLE_MAX; }
+static uint32 Stream_Ramp(uint32 index){ return index % (TEST_SAMPLE_MAX + 1); }
+static uint32 Stream_Step(uint32 index){ return (index < (TEST_SAMPLES / 2)) ? 10 : 999990; }
+static uint32 Stream_Small(uint32 index){ (void)index; return Test_Next_Random() % 4; }
+static uint32 Stream_Bell(uint32 index){
+	uint32 sum = 0, draw;
+	(void)index;
+	for(draw = 0; draw < 12; draw++){
+		sum += Test_Next_Random() % 83334;
+	}
+	return sum;
+}
+
+static const struct{
+	const char *name;
+	test_stream_t pfNext;
+}Test_Streams[] = {
+	{"uniform 0...999999",	Stream_Uniform},
+	{"constant 777777",		Stream_Constant},
+	{"999000...999999",		Stream_Narrow_High},
+	{"0 and 999999",		Stream_Extremes},
+	{"ramp",				Stream_Ramp},
+	{"step 10 to 999990",	Stream_Step},
+	{"uniform 0...3",		Stream_Small},
+	{"bell around 500000",	Stream_Bell},
+};
+
+/**=============================================
+  * @Fn				- Test_Reference
+  * @brief 			- Two pass mean and population variance of the first samples
+  * @param [in] 	- count: Number of samples
+  * @param [out] 	- pMean: Mean
+  * @param [out] 	- pVariance: Population variance
+  * @retval 		- None
+  * Note			- Long double, exact enough to judge a Q.16 result
+  */
+static void Test_Reference(uint32 count, double *pMean, double *pVariance){
+	long double sum = 0, squares = 0, mean, deviation;
+	uint32 index;
+	for(index = 0; index < count; index++){
+		sum += Test_Samples[index];
+	}
+	mean = sum / count;
+	for(index = 0; index < count; index++){
+		deviation = Test_Samples[index] - mean;
+		squares += deviation * deviation;
+	}
+	*pMean = (double)mean;
+	*pVariance = (double)(squares / count);
+}
+
+/**=============================================
+  * @Fn				- Test_Stream
+  * @brief 			- Runs one stream and prints its errors at every power of 10
+  * @param [in] 	- index: Stream of Test_Streams
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void Test_Stream(uint32 index){
+	stat_accumulator_t acc;
+	double mean, variance, sd;
+	double mean_error, var_error, sd_error;
+	double worst_mean = 0, worst_var = 0, worst_sd = 0;
+	uint32 count, next_check = 1;
+	uint8 failed = 0;
+
+	Test_Random = 12345 + index;
+	Stat_Reset(&acc);
+	printf("%s\n", Test_Streams[index].name);
+	printf("  %8s %16s %12s %20s %12s %10s\n", "n", "mean", "error", "variance", "error", "sd error");
+	for(count = 1; count <= TEST_SAMPLES; count++){
+		Test_Samples[count - 1] = Test_Streams[index].pfNext(count - 1);
+		Stat_Add_Sample(&acc, Test_Samples[count - 1]);
+		if(count == next_check){
+			next_check *= 10;
+			Test_Reference(count, &mean, &variance);
+			sd = sqrt(variance);
+			mean_error = fabs((acc.mean_q / TEST_Q16) - mean);
+			var_error = fabs((acc.variance_q / TEST_Q16) - variance);
+			sd_error = fabs((Stat_Get_Std_Dev(&acc) / TEST_Q8) - sd);
+			printf("  %8u %16.4f %12.6f %20.4f %12.6f %10.6f\n", count, mean, mean_error, variance, var_error, sd_error);
+
+			worst_mean = (mean_error > worst_mean) ? mean_error : worst_mean;
+			worst_sd = (sd_error > worst_sd) ? sd_error : worst_sd;
+			worst_var = (var_error > worst_var) ? var_error : worst_var;
+			if(((TEST_VAR_MAX_REL_ERROR * variance) < var_error) && (TEST_VAR_MAX_ERROR < var_error)){
+				failed = 1;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+	}
+	failed |= ((TEST_MEAN_MAX_ERROR < worst_mean) || (TEST_SD_MAX_ERROR < worst_sd)) ? 1 : 0;
+	printf("  worst: mean %.6f, variance %.6f, sd %.6f%s\n", worst_mean, worst_var, worst_sd, (1 == failed) ? "  FAILED" : "");
+	Test_Failures += failed;
+}
+
+/**=============================================
+  * @Fn				- Test_Full
+  * @brief 			- Fills an accumulator to STAT_COUNT_MAX with the extremes and adds one more sample
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Mean 499999.5 and variance 499999.5^2 are exact in Q.16, so they are compared exactly
+  */
+static void Test_Full(void){
+	stat_accumulator_t acc, before;
+	sint64 mean_q = (sint64)((2 * 499999 + 1) * (TEST_Q16 / 2));
+	sint64 variance_q = (sint64)(((sint64)499999 * 499999 + 499999) * TEST_Q16) + (sint64)(TEST_Q16 / 4);
+	uint32 count, refused = 0;
+	uint8 failed = 0;
+
+	Stat_Reset(&acc);
+	for(count = 0; count < STAT_COUNT_MAX; count++){
+		refused += (STAT_OK != Stat_Add_Sample(&acc, (0 == (count & 1)) ? 0 : TEST_SAMPLE_MAX)) ? 1 : 0;
+	}
+	before = acc;
+	failed = ((0 != refused) || (acc.mean_q != mean_q) || (acc.variance_q != variance_q)) ? 1 : 0;
+	failed |= (STAT_FULL != Stat_Add_Sample(&acc, 5)) ? 1 : 0;
+	failed |= (0 != memcmp(&acc, &before, sizeof(acc))) ? 1 : 0;
+	printf("full at %lu: %u refused before, mean %.4f, variance %.4f, one more %s%s\n", STAT_COUNT_MAX, refused,
+			acc.mean_q / TEST_Q16, acc.variance_q / TEST_Q16,
+			(0 == memcmp(&acc, &before, sizeof(acc))) ? "refused" : "taken", (1 == failed) ? "  FAILED" : "");
+	Test_Failures += failed;
+}
+
+int main(void){
+	uint32 index;
+	for(index = 0; index < (sizeof(Test_Streams) / sizeof(Test_Streams[0])); index++){
+		Test_Stream(index);
+	}
+	Test_Full();
+	printf("test_statistics: %u streams of %lu samples and a full accumulator, %u failed\n",
+			(uint32)(sizeof(Test_Streams) / sizeof(Test_Streams[0])), TEST_SAMPLES, Test_Failures);
+	return (0 == Test_Failures) ? 0 : 1;
+}
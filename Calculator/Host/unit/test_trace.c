@@ -0,0 +1,196 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : test_trace.c 			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "trace.h"
+
+/* The decoder of tools/, without its main */
+#define TRACE_DECODE_NO_MAIN
+#include "../tools/trace_decode.c"
+
+/*
+ * Round trip of the trace: records go through Trace_Record, the ring buffer and a fake UART onto a wire,
+ * the decoder turns the wire back into text, which must be the text of the records in order.
+ * The fake UART sends only when the test lets it, so the ring wraps and overflows.
+ */
+
+#define TEST_WIRE_SIZE		8192
+#define TEST_TEXT_SIZE		16384
+
+uint32 SIM_Basepri;
+
+static uint8 Test_Wire[TEST_WIRE_SIZE];
+static uint32 Test_Wire_Length;
+static const uint8 *Test_Sending;
+static uint16 Test_Sending_Length;
+static void (*Test_pfDone)(void);
+static uint32 Test_Time;
+static char Test_Expected[TEST_TEXT_SIZE];
+static uint32 Test_Expected_Length;
+static uint32 Test_Checks, Test_Failures;
+
+/* Fakes of the drivers trace.c uses */
+void SIM_Sync(void){}
+uint8 MCAL_UART_Init(UART_config_t *_cfg){ return UART_OK; }
+uint32 MCAL_STK_Get_Tick(void){ return Test_Time; }
+
+uint8 MCAL_UART_Send_Async(const uint8 *pData, uint16 length, void (*pfDone)(void)){
+	if(NULL != Test_Sending){
+		return UART_BUSY;
+	}
+	else{ /* Do Nothing */ }
+	Test_Sending = pData;
+	Test_Sending_Length = length;
+	Test_pfDone = pfDone;
+	return UART_OK;
+}
+
+/**=============================================
+  * @Fn				- Test_UART_Send
+  * @brief 			- Finishes the transfers of the fake UART, the callback may start the next ones
+  * @param [in] 	- transfers: Number of transfers to finish
+  * @retval 		- None
+  * Note			- The bytes are copied when the transfer ends, so a record overwritten while it is sent is seen
+  */
+static void Test_UART_Send(uint32 transfers){
+	void (*pfDone)(void);
+	while((0 != transfers) && (NULL != Test_Sending)){
+		memcpy(&Test_Wire[Test_Wire_Length], Test_Sending, Test_Sending_Length);
+		Test_Wire_Length += Test_Sending_Length;
+		pfDone = Test_pfDone;
+		Test_Sending = NULL;
+		pfDone();
+		transfers--;
+	}
+}
+
+static void Test_Expect(const char *text){
+	Test_Expected_Length += snprintf(&Test_Expected[Test_Expected_Length], TEST_TEXT_SIZE - Test_Expected_Length,
+			"%10u ms  %s\n", Test_Time, text);
+}
+
+static void Test_Record(uint8 id, uint16 arg, const char *text){
+	Trace_Record(id, arg);
+	if(NULL != text){
+		Test_Expect(text);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Test_Round_Trip
+  * @brief 			- Decodes the wire and compares it with the expected text, then clears both
+  * @param [in] 	- name: Name of the case
+  * @retval 		- None
+  * Note			- None
+  */
+static void Test_Round_Trip(const char *name){
+	static char decoded[TEST_TEXT_SIZE];
+	FILE *pOut = fmemopen(decoded, sizeof(decoded), "w");
+	uint32 problems = Trace_Decode(Test_Wire, Test_Wire_Length, pOut, 1);
+	fclose(pOut);
+	Test_Checks++;
+	if((0 != problems) || (0 != strcmp(decoded, Test_Expected))){
+		Test_Failures++;
+		printf("  FAILED: %s, %u problems\n--- decoded\n%s--- expected\n%s", name, problems, decoded, Test_Expected);
+	}
+	else{ /* Do Nothing */ }
+	Test_Wire_Length = 0;
+	Test_Expected_Length = 0;
+	Test_Expected[0] = '\0';
+}
+
+static void Test_Resync(void){
+	static const uint8 bytes[] = {
+		0x00, 0x13, 0x37,											// Noise before the first record
+		TRACE_SYNC, TRACE_ID_KEY, '+', 0, 0x10, 0x27, 0, 0,			// key + at 10000 ms
+		TRACE_SYNC, 0x7F, 0x34, 0x12, 0, 0, 0, 0,					// Unknown id
+		TRACE_SYNC, TRACE_ID_STATE, 0xFF, TRACE_SRC_NUMBERING, 1, 0, 0, 0,
+		TRACE_SYNC, TRACE_ID_KEY										// Cut off
+	};
+	static const char expected[] =
+		"(3 bytes skipped)\n"
+		"key +\n"
+		"unknown record 0x7F, arg 4660\n"
+		"numbering state stopped\n"
+		"(2 bytes skipped)\n";
+	static char decoded[256];
+	FILE *pOut = fmemopen(decoded, sizeof(decoded), "w");
+	uint32 problems = Trace_Decode(bytes, sizeof(bytes), pOut, 0);
+	fclose(pOut);
+	Test_Checks++;
+	if((3 != problems) || (0 != strcmp(decoded, expected))){
+		Test_Failures++;
+		printf("  FAILED: resync, %u problems\n%s", problems, decoded);
+	}
+	else{ /* Do Nothing */ }
+}
+
+int main(void){
+	char text[48];
+	uint32 index;
+
+	/* Every record id, sent one by one */
+	Test_Time = 0;
+	Trace_Init();
+	Test_Expect("boot");
+	Test_Time = 5;
+	Test_Record(TRACE_ID_KEY, 7, "key 7");
+	Test_Record(TRACE_ID_KEY, 'x', "key x");
+	Test_Time = 70000;
+	Test_Record(TRACE_ID_STATE, (TRACE_SRC_CALCULATOR << 8) | 2, "calculator state 2");
+	Test_Record(TRACE_ID_STATE, (TRACE_SRC_NUMBER_THEORY << 8) | 0xFF, "number theory state stopped");
+	Test_Record(TRACE_ID_MODE, 3, "mode 3 selected");
+	Test_Time = 0xFFFFFFF0UL;
+	Test_Record(TRACE_ID_STACK, 1536, "stack past its limit, 1536 bytes used");
+	Test_Record(TRACE_ID_RESUME, 65535, "resumed in 65535 ms");
+	Test_UART_Send(100);
+	Test_Round_Trip("every record id");
+
+	/* Records pile up while the UART is busy and go out as the ring wraps */
+	Test_Time = 100;
+	for(index = 0; index < 300; index++){
+		snprintf(text, sizeof(text), "key %u", index % 10);
+		Test_Record(TRACE_ID_KEY, index % 10, text);
+		Test_Time++;
+		if(0 == (index % 25)){
+			/* Less than a ring full waits, the chunks are split at the end of the ring */
+			Test_UART_Send(100);
+		}
+		else{ /* Do Nothing */ }
+	}
+	Test_UART_Send(100);
+	Test_Round_Trip("ring wrap");
+
+	/* A full ring drops records and tells how many before the next one that fits */
+	Test_Time = 200;
+	Test_Record(TRACE_ID_KEY, 1, "key 1");
+	for(index = 1; index < (TRACE_BUFFER_RECORDS + 20); index++){
+		/* The first record is being sent, the ring holds TRACE_BUFFER_RECORDS */
+		Test_Record(TRACE_ID_MODE, index, NULL);
+		if(index < TRACE_BUFFER_RECORDS){
+			snprintf(text, sizeof(text), "mode %u selected", index);
+			Test_Expect(text);
+		}
+		else{ /* Do Nothing */ }
+	}
+	Test_UART_Send(100);
+	Test_Time = 300;
+	Test_Record(TRACE_ID_KEY, '=', NULL);
+	Test_Expect("20 records lost");
+	Test_Expect("key =");
+	Test_UART_Send(100);
+	Test_Round_Trip("overflow");
+
+	Test_Resync();
+
+	printf("test_trace: %u checks, %u failed\n", Test_Checks, Test_Failures);
+	return (0 == Test_Failures) ? 0 : 1;
+}
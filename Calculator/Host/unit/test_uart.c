@@ -0,0 +1,327 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : test_uart.c 			                             	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "uart_driver.h"
+#include "console.h"
+
+/*
+ * Sustained throughput of the UART driver against the USART and DMA model of the simulator, without the rest
+ * of the firmware. A stream of 64 KB is sent by the board, received by the board and echoed back, at 115200 baud
+ * and at the highest baud rate of UART_PCLK. The buffers are those of the console: the receiver reads the circular
+ * buffer of CONSOLE_RX_SIZE bytes when the driver calls back, like Console_Process on EVENT_SERIAL, and sends in
+ * two batches of CONSOLE_TX_BATCH bytes that take turns. Every byte is checked, a byte is lost if it never arrives
+ * or if it was overwritten before it was read.
+ * Handlers and the receiver take no time, so the throughput is the one of the line and the DMA. Stalls of the
+ * core, like a flash page erase, hold them back.
+ * First, MCAL_UART_Init must refuse a baud rate of 0 or above UART_BAUD_MAX and leave BRR as it was.
+ */
+
+#define TEST_STREAM_SIZE	65536UL
+#define TEST_FAST_BAUD		UART_BAUD_MAX
+
+/* Register blocks the driver and the model share */
+NVIC_TypeDef		SIM_NVIC;
+GPIO_TypeDef		SIM_GPIO[7];
+RCC_TypeDef			SIM_RCC;
+USART_TypeDef		SIM_USART3;
+DMA_TypeDef			SIM_DMA1;
+DMA_Channel_TypeDef	SIM_DMA1_Channel[7];
+uint64 SIM_Cycles;
+
+void DMA1_Channel2_IRQHandler(void);
+void DMA1_Channel3_IRQHandler(void);
+void USART3_IRQHandler(void);
+
+static uint64 Test_Pending;				// Exceptions pended by the model, one bit each
+static uint64 Test_Stall_Until;			// Handlers and the receiver wait until then
+static uint64 Test_Stall_Period;		// 0 for no stalls
+static uint8 Test_Echo;					// Received bytes are sent back
+
+static uint8 Test_RX[CONSOLE_RX_SIZE];
+static uint16 Test_Read;
+static volatile uint8 Test_Notified;
+static uint32 Test_Received;
+static uint32 Test_First_Wrong;			// Index of the first received byte that did not match, TEST_STREAM_SIZE if none
+
+static uint8 Test_TX[2][CONSOLE_TX_BATCH];
+static uint8 Test_TX_Active, Test_TX_Fill;
+static volatile uint8 Test_TX_Sending;
+static uint32 Test_Queued;
+
+static uint32 Test_Checks, Test_Failures;
+
+/* Fakes of the drivers and the simulator core */
+void MCAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_PinConfig_t *PinConfig){}
+void MCAL_NVIC_Enable(uint8 irq){}
+void SIM_Sync(void){}
+void SIM_Pend(uint8 exception){ Test_Pending |= 1ULL << exception; }
+
+void SIM_Fatal(const char *pText){
+	printf("sim: %s\n", pText);
+	exit(1);
+}
+
+/* Byte number index of the stream */
+static uint8 Test_Byte(uint32 index){
+	return (uint8)((index * 2654435761UL) >> 24);
+}
+
+static void Test_Received_Callback(uint16 position){
+	Test_Notified = 1;
+}
+
+static void Test_Sent(void){
+	Test_TX_Sending = 0;
+}
+
+/**=============================================
+  * @Fn				- Test_Flush
+  * @brief 			- Sends the filled batch if the other one is not being sent
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Same as Console_Flush
+  */
+static void Test_Flush(void){
+	if((0 == Test_TX_Sending) && (0 != Test_TX_Fill)){
+		Test_TX_Sending = 1;
+		if(UART_OK == MCAL_UART_Send_Async(Test_TX[Test_TX_Active], Test_TX_Fill, Test_Sent)){
+			Test_TX_Active ^= 1;
+			Test_TX_Fill = 0;
+		}
+		else{
+			Test_TX_Sending = 0;
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Test_Main
+  * @brief 			- Main loop of the board: reads what arrived and fills the batches
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- A byte that does not match the stream was overwritten before it was read, the stream is broken there
+  */
+static void Test_Main(void){
+	uint16 position = MCAL_UART_Receive_Position();
+	Test_Notified = 0;
+	while((Test_Read != position) && ((0 == Test_Echo) || (CONSOLE_TX_BATCH > Test_TX_Fill))){
+		if((Test_Byte(Test_Received) != Test_RX[Test_Read]) && (TEST_STREAM_SIZE == Test_First_Wrong)){
+			Test_First_Wrong = Test_Received;
+		}
+		else{ /* Do Nothing */ }
+		if(1 == Test_Echo){
+			Test_TX[Test_TX_Active][Test_TX_Fill++] = Test_RX[Test_Read];
+		}
+		else{ /* Do Nothing */ }
+		Test_Received++;
+		Test_Read = (Test_Read + 1) % CONSOLE_RX_SIZE;
+	}
+	if(Test_Read != position){
+		/* Both batches are full, go on once one is sent */
+		Test_Notified = 1;
+	}
+	else{ /* Do Nothing */ }
+	while((0 == Test_Echo) && (TEST_STREAM_SIZE > Test_Queued) && (CONSOLE_TX_BATCH > Test_TX_Fill)){
+		Test_TX[Test_TX_Active][Test_TX_Fill++] = Test_Byte(Test_Queued++);
+	}
+	Test_Flush();
+}
+
+/**=============================================
+  * @Fn				- Test_Run
+  * @brief 			- Runs the model, the handlers and the main loop until the line is quiet or a time limit
+  * @param [in] 	- limit: Cycles since the start at most
+  * @retval 		- Cycles of the last thing that happened
+  * Note			- Every Test_Stall_Period cycles the core stalls SIM_FLASH_ERASE_CYCLES long
+  */
+static uint64 Test_Run(uint64 limit){
+	uint64 next, last = 0;
+	uint8 exception;
+	while(SIM_Cycles < limit){
+		next = SIM_UART_Next();
+		if((0 != Test_Pending) || (1 == Test_Notified)){
+			next = (Test_Stall_Until > SIM_Cycles) ? Test_Stall_Until : SIM_Cycles;
+		}
+		else if(SIM_NEVER == next){
+			break;
+		}
+		else{ /* Do Nothing */ }
+		SIM_Cycles = (next > SIM_Cycles) ? next : SIM_Cycles;
+		SIM_UART_Run();
+		if((0 != Test_Stall_Period) && (SIM_Cycles >= (Test_Stall_Until + Test_Stall_Period))){
+			Test_Stall_Until = SIM_Cycles + SIM_FLASH_ERASE_CYCLES;
+		}
+		else{ /* Do Nothing */ }
+		if(SIM_Cycles < Test_Stall_Until){
+			continue;
+		}
+		else{ /* Do Nothing */ }
+		for(exception = 0; exception < 64; exception++){
+			if(0 != (Test_Pending & (1ULL << exception))){
+				Test_Pending &= ~(1ULL << exception);
+				if(SIM_EXCEPTION_IRQ(DMA1_CHANNEL2_IRQ) == exception){
+					DMA1_Channel2_IRQHandler();
+				}
+				else if(SIM_EXCEPTION_IRQ(DMA1_CHANNEL3_IRQ) == exception){
+					DMA1_Channel3_IRQHandler();
+				}
+				else if(SIM_EXCEPTION_IRQ(USART3_IRQ) == exception){
+					USART3_IRQHandler();
+				}
+				else{ /* Do Nothing */ }
+				SIM_UART_Handled(exception);
+			}
+			else{ /* Do Nothing */ }
+		}
+		Test_Main();
+		last = SIM_Cycles;
+	}
+	return last;
+}
+
+/**=============================================
+  * @Fn				- Test_Stream
+  * @brief 			- Streams TEST_STREAM_SIZE bytes and checks that none is lost
+  * @param [in] 	- name: Name of the case
+  * @param [in] 	- baud_rate: Baud rate of both sides
+  * @param [in] 	- direction: 't' the board sends, 'r' the board receives, 'e' the board echoes what it receives
+  * @param [in] 	- stall_ms: Period of the flash erase stalls, 0 for none
+  * @param [in] 	- expect_loss: 1 if bytes must be lost, checks that the test sees it
+  * @retval 		- None
+  * Note			- The input is queued at once, the host sends back to back
+  */
+static void Test_Stream(const char *name, uint32 baud_rate, char direction, uint32 stall_ms, uint8 expect_loss){
+	static uint8 input[TEST_STREAM_SIZE];
+	UART_config_t cfg = {baud_rate, UART_STOP_BITS_1};
+	const uint8 *pCaptured;
+	uint32 captured, index, intact;
+	uint64 start, end;
+	double seconds, line;
+
+	memset(&SIM_USART3, 0, sizeof(SIM_USART3));
+	memset(&SIM_DMA1, 0, sizeof(SIM_DMA1));
+	memset(SIM_DMA1_Channel, 0, sizeof(SIM_DMA1_Channel));
+	SIM_UART_Reset();
+	SIM_Cycles = 0;
+	Test_Pending = 0;
+	Test_Stall_Until = 0;
+	Test_Stall_Period = SIM_MS_TO_CYCLES(stall_ms);
+	Test_Echo = ('e' == direction) ? 1 : 0;
+	Test_Read = 0;
+	Test_Notified = 0;
+	Test_Received = 0;
+	Test_First_Wrong = TEST_STREAM_SIZE;
+	Test_TX_Active = 0;
+	Test_TX_Fill = 0;
+	Test_TX_Sending = 0;
+	Test_Queued = ('t' == direction) ? 0 : TEST_STREAM_SIZE;
+
+	(void)MCAL_UART_Init(&cfg);
+	MCAL_UART_Receive_Start(Test_RX, CONSOLE_RX_SIZE, Test_Received_Callback);
+	start = SIM_Cycles;
+	if('t' != direction){
+		for(index = 0; index < TEST_STREAM_SIZE; index++){
+			input[index] = Test_Byte(index);
+		}
+		SIM_UART_Send(input, TEST_STREAM_SIZE);
+	}
+	else{
+		Test_Notified = 1;
+	}
+	end = Test_Run(SIM_MS_TO_CYCLES(60000));
+
+	/* Bytes of the stream that made it in order: up to the first one lost or overwritten */
+	if('r' == direction){
+		intact = (Test_First_Wrong < Test_Received) ? Test_First_Wrong : Test_Received;
+	}
+	else{
+		pCaptured = SIM_UART_Received(&captured);
+		for(intact = 0; (intact < captured) && (Test_Byte(intact) == pCaptured[intact]); intact++){
+		}
+		intact = (Test_First_Wrong < intact) ? Test_First_Wrong : intact;
+	}
+	intact = (0 != SIM_UART_Lost()) ? 0 : intact;
+
+	/* The line runs at UART_PCLK / BRR, 10 bits per byte */
+	line = (double)UART_PCLK / SIM_USART3.BRR / 10.0;
+	seconds = (double)(end - start) / STK_FCPU;
+	printf("  %-28s %6u baud: %5u bytes/s, %5.1f%% of the line, ", name, baud_rate,
+			(uint32)(TEST_STREAM_SIZE / seconds), 100.0 * TEST_STREAM_SIZE / line / seconds);
+	if(TEST_STREAM_SIZE == intact){
+		printf("no byte lost\n");
+	}
+	else{
+		printf("bytes lost from byte %u\n", intact);
+	}
+	Test_Checks++;
+	if(((0 == expect_loss) && (TEST_STREAM_SIZE != intact)) || ((1 == expect_loss) && (TEST_STREAM_SIZE == intact))){
+		Test_Failures++;
+		printf("  FAILED: %s\n", name);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Test_Baud_Limits
+  * @brief 			- Checks the baud rates MCAL_UART_Init takes and refuses
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- A refused rate must not touch BRR, the model stops the simulation on a BRR below 16
+  */
+static void Test_Baud_Limits(void){
+	static const struct{
+		uint32 baud_rate;
+		uint8 status;
+		uint32 brr;				// BRR after the call, 0x1234 is what the test left there
+	}cases[] = {
+		{115200UL,				UART_OK,		69},
+		{UART_BAUD_MAX,			UART_OK,		16},
+		{UART_BAUD_MAX + 1UL,	UART_BAD_BAUD,	0x1234},
+		{UART_PCLK,				UART_BAD_BAUD,	0x1234},
+		{0,						UART_BAD_BAUD,	0x1234}
+	};
+	UART_config_t cfg;
+	uint8 index, status;
+	for(index = 0; index < (sizeof(cases) / sizeof(cases[0])); index++){
+		SIM_USART3.BRR = 0x1234;
+		cfg.baud_rate = cases[index].baud_rate;
+		cfg.stop_bits = UART_STOP_BITS_1;
+		status = MCAL_UART_Init(&cfg);
+		Test_Checks++;
+		if((cases[index].status != status) || (cases[index].brr != SIM_USART3.BRR)){
+			Test_Failures++;
+			printf("  FAILED: %u baud gave status %u and BRR %u\n", cases[index].baud_rate, status, SIM_USART3.BRR);
+		}
+		else{ /* Do Nothing */ }
+	}
+	printf("  baud rates: 1 to %lu taken, 0 and above refused\n", UART_BAUD_MAX);
+}
+
+int main(void){
+	printf("test_uart: %lu bytes each, receive buffer %u bytes, %u byte batches\n",
+			TEST_STREAM_SIZE, CONSOLE_RX_SIZE, CONSOLE_TX_BATCH);
+	Test_Baud_Limits();
+	Test_Stream("board sends", 115200UL, 't', 0, 0);
+	Test_Stream("board sends", TEST_FAST_BAUD, 't', 0, 0);
+	Test_Stream("board receives", 115200UL, 'r', 0, 0);
+	Test_Stream("board receives", TEST_FAST_BAUD, 'r', 0, 0);
+	Test_Stream("board echoes", 115200UL, 'e', 0, 0);
+	Test_Stream("board echoes", TEST_FAST_BAUD, 'e', 0, 0);
+	/* A page erase every 100 ms: 20 ms of 11520 bytes/s fit the receive buffer, 20 ms of 50000 bytes/s do not */
+	Test_Stream("receives, erase every 100 ms", 115200UL, 'r', 100, 0);
+	Test_Stream("receives, erase every 100 ms", TEST_FAST_BAUD, 'r', 100, 1);
+
+	printf("test_uart: %u checks, %u failed\n", Test_Checks, Test_Failures);
+	return (0 == Test_Failures) ? 0 : 1;
+}
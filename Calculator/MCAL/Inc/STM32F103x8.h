@@ -15,6 +15,14 @@
 #include <stdlib.h>
 #include "Platform_Types.h"
 
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#ifndef HOST_SIMULATION
+#define HOST_SIMULATION		0		// 1 builds the sources for the simulator in Host/ against simulated register blocks,
+									// set from the command line of the host build
+#endif
+
 //----------------------------------------------
 // Section: Base addresses for Memories
 //----------------------------------------------
@@ -33,6 +41,8 @@
 #define NVIC_BASE							0xE000E100UL
 #define SCB_BASE							0xE000ED00UL
 #define STK_BASE							0xE000E010UL
+#define DWT_BASE							0xE0001000UL
+#define DEMCR_ADDRESS						0xE000EDFCUL	// Debug exception and monitor control register
 
 
 //----------------------------------------------
@@ -42,6 +52,14 @@
 	/* RCC: */
 #define RCC_BASE	0x40021000UL
 
+	/* Flash memory interface: */
+#define FLASH_R_BASE	0x40022000UL
+
+	/* DMA: */
+#define DMA1_BASE			0x40020000UL
+#define DMA1_CHANNEL2_BASE	0x4002001CUL
+#define DMA1_CHANNEL3_BASE	0x40020030UL
+
 //----------------------------------------------
 // Section: Base addresses for APB2 Peripherals
 //----------------------------------------------
@@ -68,6 +86,9 @@
 // Section: Base addresses for APB1 Peripherals
 //----------------------------------------------
 
+	/* USART: */
+#define USART3_BASE	0x40004800UL
+
 
 
 //======================================================//
@@ -110,6 +131,12 @@ typedef struct{
 	vuint32_t BFAR;
 }SCB_TypeDef;
 
+		/* DWT */
+typedef struct{
+	vuint32_t CTRL;
+	vuint32_t CYCCNT;
+}DWT_TypeDef;
+
 		/* STK */
 typedef struct{
 	vuint32_t CTRL;
@@ -143,6 +170,44 @@ typedef struct{
 	vuint32_t CSR;
 }RCC_TypeDef;
 
+		/* FLASH */
+typedef struct{
+	vuint32_t ACR;
+	vuint32_t KEYR;
+	vuint32_t OPTKEYR;
+	vuint32_t SR;
+	vuint32_t CR;
+	vuint32_t AR;
+	uint32	  RESERVED;
+	vuint32_t OBR;
+	vuint32_t WRPR;
+}FLASH_TypeDef;
+
+		/* DMA */
+typedef struct{
+	vuint32_t ISR;
+	vuint32_t IFCR;
+}DMA_TypeDef;
+
+typedef struct{
+	vuint32_t CCR;
+	vuint32_t CNDTR;
+	vuint32_t CPAR;
+	vuint32_t CMAR;
+	uint32	  RESERVED;
+}DMA_Channel_TypeDef;
+
+		/* USART */
+typedef struct{
+	vuint32_t SR;
+	vuint32_t DR;
+	vuint32_t BRR;
+	vuint32_t CR1;
+	vuint32_t CR2;
+	vuint32_t CR3;
+	vuint32_t GTPR;
+}USART_TypeDef;
+
 		/* EXTI */
 typedef struct{
 	vuint32_t IMR;
@@ -168,9 +233,62 @@ typedef struct{
 // Section: Peripheral instants
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 
+#if HOST_SIMULATION == 1
+/* Register blocks and core state of the host build, the simulator models the peripherals behind them
+ * The virtual clock only advances inside the SIM_ hooks, interrupts are taken there and when they are unmasked */
+extern NVIC_TypeDef			SIM_NVIC;
+extern SCB_TypeDef			SIM_SCB;
+extern STK_TypeDef			SIM_STK;
+extern DWT_TypeDef			SIM_DWT;
+extern vuint32_t			SIM_DEMCR;
+extern GPIO_TypeDef			SIM_GPIO[7];
+extern RCC_TypeDef			SIM_RCC;
+extern FLASH_TypeDef		SIM_FLASH;
+extern AFIO_TypeDef			SIM_AFIO;
+extern EXTI_TypeDef			SIM_EXTI;
+extern USART_TypeDef		SIM_USART3;
+extern DMA_TypeDef			SIM_DMA1;
+extern DMA_Channel_TypeDef	SIM_DMA1_Channel[7];
+extern uint32				SIM_Primask;
+extern uint32				SIM_Basepri;
+void SIM_Wait_For_Interrupt(void);
+void SIM_Busy_Wait(void);
+void SIM_GPIO_Written(GPIO_TypeDef *GPIOx);
+void SIM_Sync(void);
+
+#define NVIC		(&SIM_NVIC)
+#define SCB			(&SIM_SCB)
+#define STK			(&SIM_STK)
+#define DWT			(&SIM_DWT)
+#define DEMCR		SIM_DEMCR
+
+#define GPIOA		(&SIM_GPIO[0])
+#define GPIOB		(&SIM_GPIO[1])
+#define GPIOC		(&SIM_GPIO[2])
+#define GPIOD		(&SIM_GPIO[3])
+#define GPIOE		(&SIM_GPIO[4])
+#define GPIOF		(&SIM_GPIO[5])
+#define GPIOG		(&SIM_GPIO[6])
+
+#define RCC			(&SIM_RCC)
+
+#define FLASH		(&SIM_FLASH)
+
+#define USART3		(&SIM_USART3)
+
+#define DMA1			(&SIM_DMA1)
+#define DMA1_Channel2	(&SIM_DMA1_Channel[1])
+#define DMA1_Channel3	(&SIM_DMA1_Channel[2])
+
+#define EXTI		(&SIM_EXTI)
+
+#define AFIO		(&SIM_AFIO)
+#else
 #define NVIC		((NVIC_TypeDef*)NVIC_BASE)
 #define SCB			((SCB_TypeDef* )SCB_BASE )
 #define STK			((STK_TypeDef* )STK_BASE )
+#define DWT			((DWT_TypeDef* )DWT_BASE )
+#define DEMCR		(*((vuint32_t*)DEMCR_ADDRESS))
 
 #define GPIOA		((GPIO_TypeDef*)GPIOA_BASE)
 #define GPIOB		((GPIO_TypeDef*)GPIOB_BASE)
@@ -182,9 +300,18 @@ typedef struct{
 
 #define RCC			((RCC_TypeDef*)RCC_BASE)
 
+#define FLASH		((FLASH_TypeDef*)FLASH_R_BASE)
+
+#define USART3		((USART_TypeDef*)USART3_BASE)
+
+#define DMA1			((DMA_TypeDef*)DMA1_BASE)
+#define DMA1_Channel2	((DMA_Channel_TypeDef*)DMA1_CHANNEL2_BASE)
+#define DMA1_Channel3	((DMA_Channel_TypeDef*)DMA1_CHANNEL3_BASE)
+
 #define EXTI		((EXTI_TypeDef*)EXTI_BASE)
 
 #define AFIO		((AFIO_TypeDef*)AFIO_BASE)
+#endif /* HOST_SIMULATION */
 
 //======================================================//
 
@@ -202,12 +329,84 @@ typedef struct{
 
 #define RCC_AFIO_CLK_EN()	(RCC->APB2ENR |= (1<<0))
 
+#define RCC_USART3_CLK_EN()	(RCC->APB1ENR |= (1<<18))
+
+#define RCC_DMA1_CLK_EN()	(RCC->AHBENR |= (1<<0))
+
+/* Reset flags of RCC->CSR, kept until RMVF is written */
+#define RCC_CSR_RMVF		(1UL<<24)
+#define RCC_CSR_PINRSTF		(1UL<<26)	// NRST pin, also set by the resets the core drives on the pin
+#define RCC_CSR_PORRSTF		(1UL<<27)	// Power on or power down, the F103 reports a brown-out this way
+#define RCC_CSR_SFTRSTF		(1UL<<28)
+#define RCC_CSR_IWDGRSTF	(1UL<<29)
+#define RCC_CSR_WWDGRSTF	(1UL<<30)
+#define RCC_CSR_LPWRRSTF	(1UL<<31)
+
 //======================================================//
 
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 // Section: NVIC IRQ enable/disable Macros
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 
+#define DMA1_CHANNEL2_IRQ			12
+#define DMA1_CHANNEL3_IRQ			13
+#define USART3_IRQ					39
+
+#define NVIC_IRQ12_DMA1_CH2_ENABLE()	(NVIC->ISER[DMA1_CHANNEL2_IRQ / 32] = (1UL << (DMA1_CHANNEL2_IRQ % 32)))
+#define NVIC_IRQ12_DMA1_CH2_DISABLE()	(NVIC->ICER[DMA1_CHANNEL2_IRQ / 32] = (1UL << (DMA1_CHANNEL2_IRQ % 32)))
+#define NVIC_IRQ13_DMA1_CH3_ENABLE()	(NVIC->ISER[DMA1_CHANNEL3_IRQ / 32] = (1UL << (DMA1_CHANNEL3_IRQ % 32)))
+#define NVIC_IRQ13_DMA1_CH3_DISABLE()	(NVIC->ICER[DMA1_CHANNEL3_IRQ / 32] = (1UL << (DMA1_CHANNEL3_IRQ % 32)))
+
+#define NVIC_IRQ39_USART3_ENABLE()		(NVIC->ISER[USART3_IRQ / 32] = (1UL << (USART3_IRQ % 32)))
+#define NVIC_IRQ39_USART3_DISABLE()		(NVIC->ICER[USART3_IRQ / 32] = (1UL << (USART3_IRQ % 32)))
+
+#if HOST_SIMULATION == 1
+#define GLOBAL_IRQ_SAVE(_PRIMASK_)		((_PRIMASK_) = SIM_Primask, SIM_Primask = 1)
+#define GLOBAL_IRQ_RESTORE(_PRIMASK_)	(SIM_Primask = (_PRIMASK_), SIM_Sync())
+#define GLOBAL_IRQ_DISABLE()			(SIM_Primask = 1)
+#define GLOBAL_IRQ_ENABLE()				(SIM_Primask = 0, SIM_Sync())
+#define CPU_WAIT_FOR_INTERRUPT()		SIM_Wait_For_Interrupt()
+#define CPU_BUSY_WAIT()					SIM_Busy_Wait()
+#define GPIO_OUTPUT_WRITTEN(_GPIOx_)	SIM_GPIO_Written(_GPIOx_)
+#define NVIC_REGISTER_WRITTEN()			SIM_Sync()
+#define CPU_GET_SP(_SP_)				((_SP_) = (uint32)__builtin_frame_address(0))
+/* Kept together so the simulator can carry them over a reset, see SIM_Retain_Save */
+#define SECTION_NOINIT					__attribute__((section("sim_noinit")))
+#define SECTION_RAMFUNC
+#define CPU_SYNC_BARRIER()				SIM_Sync()
+#else
+/* Mask all interrupts and keep the previous mask in _PRIMASK_, restore it with GLOBAL_IRQ_RESTORE */
+#define GLOBAL_IRQ_SAVE(_PRIMASK_)		__asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (_PRIMASK_) : : "memory")
+#define GLOBAL_IRQ_RESTORE(_PRIMASK_)	__asm volatile ("msr primask, %0" : : "r" (_PRIMASK_) : "memory")
+#define GLOBAL_IRQ_DISABLE()			__asm volatile ("cpsid i" : : : "memory")
+#define GLOBAL_IRQ_ENABLE()				__asm volatile ("cpsie i" : : : "memory")
+
+/* Sleeps until an interrupt is pending, also wakes up while interrupts are masked */
+#define CPU_WAIT_FOR_INTERRUPT()		__asm volatile ("wfi" : : : "memory")
+
+/* Body of a loop polling a register, lets the host build advance its virtual clock */
+#define CPU_BUSY_WAIT()
+
+/* Follows every write to the outputs of a port, lets the host build apply BSRR/BRR and watch the pins */
+#define GPIO_OUTPUT_WRITTEN(_GPIOx_)
+
+/* Follows every write to the set, clear and trigger registers of the NVIC, the host build applies it at once */
+#define NVIC_REGISTER_WRITTEN()
+
+/* Reads the stack pointer in use */
+#define CPU_GET_SP(_SP_)				__asm volatile ("mov %0, sp" : "=r" (_SP_))
+
+/* Variable left out of the startup initialization, keeps its value over a reset, see .noinit in the linker script */
+#define SECTION_NOINIT					__attribute__((section(".noinit")))
+
+/* Function copied to SRAM with .data by the startup, runs without flash wait states
+ * SRAM is out of reach of a BL from flash, so callers load the full address */
+#define SECTION_RAMFUNC					__attribute__((section(".RamFunc"), long_call, noinline))
+
+/* Waits until memory accesses and the pipeline see the previous writes */
+#define CPU_SYNC_BARRIER()				__asm volatile ("dsb\n\tisb" : : : "memory")
+#endif /* HOST_SIMULATION */
+
 
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 // Section: Generic macros
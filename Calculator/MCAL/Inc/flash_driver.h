@@ -0,0 +1,90 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : flash_driver.h			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#ifndef MCAL_INC_FLASH_DRIVER_H_
+#define MCAL_INC_FLASH_DRIVER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "STM32F103x8.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref FLASH_SIZE_define
+#define FLASH_PAGE_SIZE			1024UL		// Bytes erased together
+#define FLASH_ERASED_HALF_WORD	0xFFFFU
+
+// @ref FLASH_STATUS_define
+#define FLASH_OK				0x00U
+#define FLASH_ERROR				0x01U		// Programming or write protection error
+
+#define FLASH_KEY1				0x45670123UL
+#define FLASH_KEY2				0xCDEF89ABUL
+
+#define FLASH_SR_BSY			(1UL<<0)
+#define FLASH_SR_PGERR			(1UL<<2)
+#define FLASH_SR_WRPRTERR		(1UL<<4)
+#define FLASH_SR_EOP			(1UL<<5)
+
+#define FLASH_CR_PG				(1UL<<0)
+#define FLASH_CR_PER			(1UL<<1)
+#define FLASH_CR_STRT			(1UL<<6)
+#define FLASH_CR_LOCK			(1UL<<7)
+
+/*
+ * =============================================
+ * APIs Supported by "Flash"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Unlock
+  * @brief 			- Unlocks the flash memory for erasing and programming
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Call MCAL_FLASH_Lock when done
+  */
+void MCAL_FLASH_Unlock(void);
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Lock
+  * @brief 			- Locks the flash memory against erasing and programming
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_FLASH_Lock(void);
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Erase_Page
+  * @brief 			- Erases one page of the flash memory
+  * @param [in] 	- address: Any address inside the page
+  * @param [out] 	- None
+  * @retval 		- Status @ref FLASH_STATUS_define
+  * Note			- Flash must be unlocked, the CPU stalls on flash reads while the page is erased (about 20 ms)
+  */
+uint8 MCAL_FLASH_Erase_Page(uint32 address);
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Write_Half_Word
+  * @brief 			- Programs one erased half word of the flash memory
+  * @param [in] 	- address: Half word aligned address
+  * @param [in] 	- data: Value to be programmed
+  * @param [out] 	- None
+  * @retval 		- Status @ref FLASH_STATUS_define
+  * Note			- Flash must be unlocked, the half word must read FLASH_ERASED_HALF_WORD before programming
+  */
+uint8 MCAL_FLASH_Write_Half_Word(uint32 address, uint16 data);
+
+#endif /* MCAL_INC_FLASH_DRIVER_H_ */
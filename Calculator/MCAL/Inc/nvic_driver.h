@@ -0,0 +1,160 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : nvic_driver.h			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#ifndef MCAL_INC_NVIC_DRIVER_H_
+#define MCAL_INC_NVIC_DRIVER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "STM32F103x8.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define NVIC_IRQ_NUM				43		// IRQs 0...42 of the F103x8, position in the vector table after the 16 system exceptions
+#define NVIC_PRIO_BITS				4		// Priority bits implemented by the F103, the high bits of every priority byte
+
+// @ref NVIC_PRIGROUP_define
+/* Split of the 4 priority bits into preemption priority and subpriority */
+#define NVIC_PRIGROUP_16_PREEMPT	3		// 4 preemption bits, no subpriority
+#define NVIC_PRIGROUP_8_PREEMPT		4		// 3 preemption bits, 1 subpriority bit
+#define NVIC_PRIGROUP_4_PREEMPT		5		// 2 preemption bits, 2 subpriority bits
+#define NVIC_PRIGROUP_2_PREEMPT		6		// 1 preemption bit, 3 subpriority bits
+#define NVIC_PRIGROUP_NO_PREEMPT	7		// No preemption, 4 subpriority bits
+
+// @ref NVIC_SYSTEM_define
+/* Exception numbers of the system handlers with a settable priority */
+#define NVIC_SYSTEM_SVCALL			11
+#define NVIC_SYSTEM_PENDSV			14
+#define NVIC_SYSTEM_SYSTICK			15
+
+#define NVIC_AIRCR_VECTKEY			(0x05FAUL<<16)
+#define NVIC_AIRCR_PRIGROUP_POS		8
+#define NVIC_AIRCR_PRIGROUP_MASK	(7UL<<NVIC_AIRCR_PRIGROUP_POS)
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#define NVIC_CRITICAL_PRIORITY		1		// Highest preemption priority masked by NVIC_CRITICAL_ENTER with NVIC_PRIGROUP_16_PREEMPT,
+											// priority 0 keeps running inside the critical sections
+
+/* Masks the interrupts of preemption priority NVIC_CRITICAL_PRIORITY and lower, keeps the previous mask in _SAVED_
+ * Interrupts above the level must not use what the critical section protects. Restore with NVIC_CRITICAL_EXIT */
+#if HOST_SIMULATION == 1
+#define NVIC_CRITICAL_ENTER(_SAVED_)	((_SAVED_) = SIM_Basepri, SIM_Basepri = ((0 == SIM_Basepri) || ((NVIC_CRITICAL_PRIORITY << (8 - NVIC_PRIO_BITS)) < SIM_Basepri)) ? \
+											(NVIC_CRITICAL_PRIORITY << (8 - NVIC_PRIO_BITS)) : SIM_Basepri)
+#define NVIC_CRITICAL_EXIT(_SAVED_)		(SIM_Basepri = (_SAVED_), SIM_Sync())
+#else
+#define NVIC_CRITICAL_ENTER(_SAVED_)	__asm volatile ("mrs %0, basepri\n\tmsr basepri_max, %1" : "=&r" (_SAVED_) : \
+											"r" (NVIC_CRITICAL_PRIORITY << (8 - NVIC_PRIO_BITS)) : "memory")
+#define NVIC_CRITICAL_EXIT(_SAVED_)		__asm volatile ("msr basepri, %0" : : "r" (_SAVED_) : "memory")
+#endif
+
+/*
+ * =============================================
+ * APIs Supported by "NVIC"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Enable
+  * @brief 			- Enables an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_NVIC_Enable(uint8 irq);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Disable
+  * @brief 			- Disables an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- A handler already running finishes
+  */
+void MCAL_NVIC_Disable(uint8 irq);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Set_Pending
+  * @brief 			- Pends an interrupt from software
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The handler runs once the interrupt is enabled and its priority allows it
+  */
+void MCAL_NVIC_Set_Pending(uint8 irq);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Clear_Pending
+  * @brief 			- Removes the pending state of an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_NVIC_Clear_Pending(uint8 irq);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Is_Pending
+  * @brief 			- Reads the pending state of an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- 1 if pending, else 0
+  * Note			- None
+  */
+uint8 MCAL_NVIC_Is_Pending(uint8 irq);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Is_Active
+  * @brief 			- Reads if the handler of an interrupt is running or preempted
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- 1 if active, else 0
+  * Note			- None
+  */
+uint8 MCAL_NVIC_Is_Active(uint8 irq);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Set_Priority_Grouping
+  * @brief 			- Selects how the priority bits split into preemption priority and subpriority
+  * @param [in] 	- group: Priority grouping @ref NVIC_PRIGROUP_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Set once before the priorities, they are encoded for the grouping in use
+  */
+void MCAL_NVIC_Set_Priority_Grouping(uint8 group);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Set_Priority
+  * @brief 			- Sets the priority of an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [in] 	- preempt: Preemption priority, 0 is the highest, only an interrupt with a higher one nests
+  * @param [in] 	- sub: Subpriority, orders pending interrupts of the same preemption priority
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Values wider than the bits of the grouping in use are cut
+  */
+void MCAL_NVIC_Set_Priority(uint8 irq, uint8 preempt, uint8 sub);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Set_System_Priority
+  * @brief 			- Sets the priority of a system handler
+  * @param [in] 	- exception: Exception number @ref NVIC_SYSTEM_define
+  * @param [in] 	- preempt: Preemption priority, 0 is the highest
+  * @param [in] 	- sub: Subpriority
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Same encoding as MCAL_NVIC_Set_Priority
+  */
+void MCAL_NVIC_Set_System_Priority(uint8 exception, uint8 preempt, uint8 sub);
+
+#endif /* MCAL_INC_NVIC_DRIVER_H_ */
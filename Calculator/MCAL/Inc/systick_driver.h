@@ -36,6 +36,7 @@ typedef struct{
 
 // @ref stk_cpu_freq_define
 #define STK_FCPU				8000000UL
+#define STK_TICK_HZ				1000UL		// Rate of the system tick started by MCAL_STK_Tick_Init
 
 // @ref stk_interrupt_config_define
 #define STK_INTERRUPT_ENABLED	0x02UL
@@ -122,7 +123,39 @@ void MCAL_STK_Delay(uint32 delay_ticks);
   * @param [out] 	- None
   * @retval 		- None
   * Note			- User must define the frequency of the SysTick timer in @ref stk_cpu_freq_define
+  * 				  Once the tick runs, delay_ms must be below 536000 at 8 MHz
   */
 void MCAL_STK_Delay1ms(uint32 delay_ms);
 
+/**=============================================
+  * @Fn				- MCAL_STK_Tick_Init
+  * @brief 			- Starts the SysTick timer as a periodic 1 ms system tick
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Once the tick runs, MCAL_STK_Delay1ms sleeps until the tick count is reached instead of reconfiguring the timer
+  * 				  A callback set by MCAL_STK_SetCallback is still called on every tick
+  */
+void MCAL_STK_Tick_Init(void);
+
+/**=============================================
+  * @Fn				- MCAL_STK_Get_Tick
+  * @brief 			- Returns the number of milliseconds since MCAL_STK_Tick_Init
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Tick count, wraps around after 49 days
+  * Note			- Compare tick counts by subtracting them, so the wrap around does not matter
+  */
+uint32 MCAL_STK_Get_Tick(void);
+
+/**=============================================
+  * @Fn				- MCAL_STK_Get_Cycles
+  * @brief 			- Returns the number of CPU clock cycles since MCAL_STK_Tick_Init
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Cycle count, wraps around after 536 seconds at 8 MHz
+  * Note			- Interrupts must be enabled, the count is read again if a tick comes while reading it
+  */
+uint32 MCAL_STK_Get_Cycles(void);
+
 #endif /* MCAL_INC_SYSTICK_DRIVER_H_ */
@@ -0,0 +1,144 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : uart_driver.h			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#ifndef MCAL_INC_UART_DRIVER_H_
+#define MCAL_INC_UART_DRIVER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "STM32F103x8.h"
+#include "gpio_driver.h"
+#include "nvic_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint32 baud_rate;
+	uint8  stop_bits;		// @ref UART_STOP_BITS_define
+}UART_config_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref UART_STOP_BITS_define
+#define UART_STOP_BITS_1		0x00U
+#define UART_STOP_BITS_2		0x02U
+
+// @ref UART_STATUS_define
+#define UART_OK					0x00U
+#define UART_BUSY				0x01U	// A transmission is still running
+#define UART_BAD_BAUD			0x02U	// Baud rate of 0 or above UART_BAUD_MAX, the UART was left as it was
+
+#define UART_SR_IDLE			(1UL<<4)
+#define UART_CR1_RE				(1UL<<2)
+#define UART_CR1_TE				(1UL<<3)
+#define UART_CR1_IDLEIE			(1UL<<4)
+#define UART_CR1_UE				(1UL<<13)
+#define UART_CR2_STOP_POS		12
+#define UART_CR3_DMAR			(1UL<<6)
+#define UART_CR3_DMAT			(1UL<<7)
+
+#define DMA_CCR_EN				(1UL<<0)
+#define DMA_CCR_TCIE			(1UL<<1)
+#define DMA_CCR_HTIE			(1UL<<2)
+#define DMA_CCR_DIR				(1UL<<4)	// Read from memory
+#define DMA_CCR_CIRC			(1UL<<5)
+#define DMA_CCR_MINC			(1UL<<7)
+#define DMA_CCR_PL_HIGH			(2UL<<12)
+#define DMA_ISR_GIF(_CH_)		(1UL<<(((_CH_) - 1) * 4))
+#define DMA_ISR_TCIF(_CH_)		(2UL<<(((_CH_) - 1) * 4))
+#define DMA_ISR_HTIF(_CH_)		(4UL<<(((_CH_) - 1) * 4))
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+
+// @ref UART_PINS_define
+/* USART3 on PB10/PB11, the USART1 pins are used by the LCD and its remapped pins by the keypad */
+#define UART_INSTANCE			USART3
+#define UART_PORT				GPIOB
+#define UART_TX_PIN				GPIO_PIN_10
+#define UART_RX_PIN				GPIO_PIN_11
+#define UART_PCLK				8000000UL	// Clock of the APB bus of the USART
+#define UART_BAUD_MAX			(UART_PCLK / 16UL)	// Divider of 1.0, the mantissa of BRR would be 0 above it
+
+// @ref UART_DMA_define
+/* Fixed by the DMA request mapping of USART3 */
+#define UART_DMA				DMA1
+#define UART_DMA_TX				DMA1_Channel2
+#define UART_DMA_TX_CH			2
+#define UART_DMA_RX				DMA1_Channel3
+#define UART_DMA_RX_CH			3
+
+/*
+ * =============================================
+ * APIs Supported by "UART"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- MCAL_UART_Init
+  * @brief 			- Initializes the UART pins, frame format and baud rate
+  * @param [in] 	- _cfg: Pointer to struct containing UART configuration
+  * @param [out] 	- None
+  * @retval 		- Status @ref UART_STATUS_define, UART_BAD_BAUD if the baud rate is 0 or above UART_BAUD_MAX
+  * Note			- 8 data bits, no parity, the baud rate is rounded to the nearest divider of UART_PCLK
+  */
+uint8 MCAL_UART_Init(UART_config_t *_cfg);
+
+/**=============================================
+  * @Fn				- MCAL_UART_Send_Async
+  * @brief 			- Starts sending a buffer in the background
+  * @param [in] 	- pData: Buffer to be sent, kept by the caller until pfDone is called
+  * @param [in] 	- length: Number of bytes, more than 0
+  * @param [in] 	- pfDone: Called from the interrupt once the last byte left the buffer, may be NULL
+  * @param [out] 	- None
+  * @retval 		- Status @ref UART_STATUS_define
+  * Note			- The DMA reads the bytes straight from pData, pfDone may start the next transmission
+  */
+uint8 MCAL_UART_Send_Async(const uint8 *pData, uint16 length, void (*pfDone)(void));
+
+/**=============================================
+  * @Fn				- MCAL_UART_Receive_Start
+  * @brief 			- Starts receiving into a circular buffer in the background
+  * @param [in] 	- pBuffer: Buffer written by the DMA, kept by the caller while receiving
+  * @param [in] 	- size: Size of the buffer in bytes, more than 0
+  * @param [in] 	- pfReceived: Called from the interrupt with the write position when the line goes idle
+  * 				  and when the DMA reaches the middle or the end of the buffer, may be NULL
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Bytes from the caller's read position up to the write position are new,
+  * 				  the caller must read them before size more bytes arrive
+  */
+void MCAL_UART_Receive_Start(uint8 *pBuffer, uint16 size, void (*pfReceived)(uint16 position));
+
+/**=============================================
+  * @Fn				- MCAL_UART_Receive_Position
+  * @brief 			- Reads the position the next received byte is written at
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Write position inside the receive buffer
+  * Note			- Lets the caller poll instead of waiting for pfReceived
+  */
+uint16 MCAL_UART_Receive_Position(void);
+
+/**=============================================
+  * @Fn				- MCAL_UART_Is_Busy
+  * @brief 			- Checks if a transmission is running
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- 1 if busy, 0 if a new transmission can start
+  * Note			- None
+  */
+uint8 MCAL_UART_Is_Busy(void);
+
+#endif /* MCAL_INC_UART_DRIVER_H_ */
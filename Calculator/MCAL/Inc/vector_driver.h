@@ -0,0 +1,79 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : vector_driver.h			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#ifndef MCAL_INC_VECTOR_DRIVER_H_
+#define MCAL_INC_VECTOR_DRIVER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "STM32F103x8.h"
+#include "nvic_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint32 flash_cycles;	// Pending the interrupt to the first instruction of a handler in flash
+	uint32 ram_cycles;		// Same for a handler in SRAM
+}VECT_Latency_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define VECT_TABLE_ENTRIES		76			// Entries of g_pfnVectors, stack pointer and exceptions before the IRQs
+#define VECT_IRQ(_IRQ_)			(16 + (_IRQ_))	// Entry of an IRQ number
+
+#define DEMCR_TRCENA			(1UL<<24)
+#define DWT_CTRL_CYCCNTENA		(1UL<<0)
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#define VECT_TEST_IRQ			36			// SPI2, unused, borrowed by MCAL_VECT_Measure_Latency
+
+/*
+ * =============================================
+ * APIs Supported by "VECT"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- MCAL_VECT_Init
+  * @brief 			- Copies the vector table to SRAM and points VTOR at it
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Call before any interrupt is enabled, the table is placed by .ram_vectors in the linker script
+  */
+void MCAL_VECT_Init(void);
+
+/**=============================================
+  * @Fn				- MCAL_VECT_Set_Handler
+  * @brief 			- Installs a handler in the SRAM vector table
+  * @param [in] 	- entry: Entry of the table, VECT_IRQ(IRQ number) for interrupts
+  * @param [in] 	- pfHandler: Handler to be installed
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- MCAL_VECT_Init must be called first, mark hot handlers with SECTION_RAMFUNC
+  */
+void MCAL_VECT_Set_Handler(uint8 entry, void (*pfHandler)(void));
+
+/**=============================================
+  * @Fn				- MCAL_VECT_Measure_Latency
+  * @brief 			- Counts the cycles from pending an interrupt to the first instruction of its handler
+  * @param [in] 	- None
+  * @param [out] 	- pLatency: Pointer to the cycles with the handler in flash and in SRAM
+  * @retval 		- None
+  * Note			- Uses the DWT cycle counter and VECT_TEST_IRQ, the vector table must be in SRAM
+  * 				  Flash has no wait states up to 24 MHz, so both are the same at the 8 MHz clock
+  */
+void MCAL_VECT_Measure_Latency(VECT_Latency_t *pLatency);
+
+#endif /* MCAL_INC_VECTOR_DRIVER_H_ */
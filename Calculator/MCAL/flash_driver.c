@@ -0,0 +1,95 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : flash_driver.c			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "flash_driver.h"
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Wait
+  * @brief 			- Waits for the current flash operation and reads its result
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Status @ref FLASH_STATUS_define
+  * Note			- Error and end of operation flags are cleared
+  */
+static uint8 MCAL_FLASH_Wait(void){
+	uint32 status;
+	/* Polled at least once, so the host build sees every operation that was started */
+	do{
+		CPU_BUSY_WAIT();
+	}while(FLASH_SR_BSY == (FLASH->SR & FLASH_SR_BSY));
+	status = FLASH->SR;
+
+	/* Flags are cleared by writing 1 */
+	FLASH->SR = FLASH_SR_PGERR | FLASH_SR_WRPRTERR | FLASH_SR_EOP;
+	return (0 != (status & (FLASH_SR_PGERR | FLASH_SR_WRPRTERR))) ? FLASH_ERROR : FLASH_OK;
+}
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Unlock
+  * @brief 			- Unlocks the flash memory for erasing and programming
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Call MCAL_FLASH_Lock when done
+  */
+void MCAL_FLASH_Unlock(void){
+	if(FLASH_CR_LOCK == (FLASH->CR & FLASH_CR_LOCK)){
+		FLASH->KEYR = FLASH_KEY1;
+		FLASH->KEYR = FLASH_KEY2;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Lock
+  * @brief 			- Locks the flash memory against erasing and programming
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_FLASH_Lock(void){
+	FLASH->CR |= FLASH_CR_LOCK;
+}
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Erase_Page
+  * @brief 			- Erases one page of the flash memory
+  * @param [in] 	- address: Any address inside the page
+  * @param [out] 	- None
+  * @retval 		- Status @ref FLASH_STATUS_define
+  * Note			- Flash must be unlocked, the CPU stalls on flash reads while the page is erased (about 20 ms)
+  */
+uint8 MCAL_FLASH_Erase_Page(uint32 address){
+	uint8 status;
+	FLASH->CR |= FLASH_CR_PER;
+	FLASH->AR = address;
+	FLASH->CR |= FLASH_CR_STRT;
+	status = MCAL_FLASH_Wait();
+	FLASH->CR &= ~FLASH_CR_PER;
+	return status;
+}
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Write_Half_Word
+  * @brief 			- Programs one erased half word of the flash memory
+  * @param [in] 	- address: Half word aligned address
+  * @param [in] 	- data: Value to be programmed
+  * @param [out] 	- None
+  * @retval 		- Status @ref FLASH_STATUS_define
+  * Note			- Flash must be unlocked, the half word must read FLASH_ERASED_HALF_WORD before programming
+  */
+uint8 MCAL_FLASH_Write_Half_Word(uint32 address, uint16 data){
+	uint8 status;
+	FLASH->CR |= FLASH_CR_PG;
+	*((vuint16_t*)address) = data;
+	status = MCAL_FLASH_Wait();
+	FLASH->CR &= ~FLASH_CR_PG;
+	return status;
+}
@@ -179,6 +179,7 @@ void MCAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16 PinNumber, uint8 Value){
 		1: Reset the corresponding ODRx bit*/
 		GPIOx->BRR = (uint32)PinNumber;
 	}
+	GPIO_OUTPUT_WRITTEN(GPIOx);
 }
 
 /**=============================================
@@ -191,6 +192,7 @@ void MCAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16 PinNumber, uint8 Value){
  */
 void MCAL_GPIO_WritePort(GPIO_TypeDef *GPIOx, uint16 Value){
 	GPIOx->ODR = (uint32)Value;
+	GPIO_OUTPUT_WRITTEN(GPIOx);
 }
 
 /**=============================================
@@ -203,6 +205,7 @@ void MCAL_GPIO_WritePort(GPIO_TypeDef *GPIOx, uint16 Value){
  */
 void MCAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16 PinNumber){
 	GPIOx->ODR ^= (uint32)PinNumber;
+	GPIO_OUTPUT_WRITTEN(GPIOx);
 }
 
 /**=============================================
@@ -0,0 +1,185 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : nvic_driver.c			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "nvic_driver.h"
+
+#define NVIC_REG(_IRQ_)		((_IRQ_) / 32)
+#define NVIC_BIT(_IRQ_)		(1UL << ((_IRQ_) % 32))
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Encode_Priority
+  * @brief 			- Builds the priority byte for the grouping in use
+  * @param [in] 	- preempt: Preemption priority
+  * @param [in] 	- sub: Subpriority
+  * @param [out] 	- None
+  * @retval 		- Priority byte, only its NVIC_PRIO_BITS high bits are implemented
+  * Note			- None
+  */
+static uint8 MCAL_NVIC_Encode_Priority(uint8 preempt, uint8 sub){
+	uint8 group = (uint8)((SCB->AIRCR & NVIC_AIRCR_PRIGROUP_MASK) >> NVIC_AIRCR_PRIGROUP_POS);
+	uint8 preempt_bits = 7 - group;
+	uint8 sub_bits;
+	if(NVIC_PRIO_BITS < preempt_bits){
+		preempt_bits = NVIC_PRIO_BITS;
+	}
+	else{ /* Do Nothing */ }
+	sub_bits = NVIC_PRIO_BITS - preempt_bits;
+
+	preempt &= (uint8)((1U << preempt_bits) - 1);
+	sub &= (uint8)((1U << sub_bits) - 1);
+	return (uint8)(((preempt << sub_bits) | sub) << (8 - NVIC_PRIO_BITS));
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Enable
+  * @brief 			- Enables an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_NVIC_Enable(uint8 irq){
+	if(NVIC_IRQ_NUM > irq){
+		NVIC->ISER[NVIC_REG(irq)] = NVIC_BIT(irq);
+		NVIC_REGISTER_WRITTEN();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Disable
+  * @brief 			- Disables an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- A handler already running finishes
+  */
+void MCAL_NVIC_Disable(uint8 irq){
+	if(NVIC_IRQ_NUM > irq){
+		NVIC->ICER[NVIC_REG(irq)] = NVIC_BIT(irq);
+
+		/* Interrupt cannot be taken once the write completed */
+		CPU_SYNC_BARRIER();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Set_Pending
+  * @brief 			- Pends an interrupt from software
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The handler runs once the interrupt is enabled and its priority allows it
+  */
+void MCAL_NVIC_Set_Pending(uint8 irq){
+	if(NVIC_IRQ_NUM > irq){
+		NVIC->ISPR[NVIC_REG(irq)] = NVIC_BIT(irq);
+		NVIC_REGISTER_WRITTEN();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Clear_Pending
+  * @brief 			- Removes the pending state of an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_NVIC_Clear_Pending(uint8 irq){
+	if(NVIC_IRQ_NUM > irq){
+		NVIC->ICPR[NVIC_REG(irq)] = NVIC_BIT(irq);
+		NVIC_REGISTER_WRITTEN();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Is_Pending
+  * @brief 			- Reads the pending state of an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- 1 if pending, else 0
+  * Note			- None
+  */
+uint8 MCAL_NVIC_Is_Pending(uint8 irq){
+	uint8 pending = 0;
+	if(NVIC_IRQ_NUM > irq){
+		pending = (0 != (NVIC->ISPR[NVIC_REG(irq)] & NVIC_BIT(irq))) ? 1 : 0;
+	}
+	else{ /* Do Nothing */ }
+	return pending;
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Is_Active
+  * @brief 			- Reads if the handler of an interrupt is running or preempted
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [out] 	- None
+  * @retval 		- 1 if active, else 0
+  * Note			- None
+  */
+uint8 MCAL_NVIC_Is_Active(uint8 irq){
+	uint8 active = 0;
+	if(NVIC_IRQ_NUM > irq){
+		active = (0 != (NVIC->IABR[NVIC_REG(irq)] & NVIC_BIT(irq))) ? 1 : 0;
+	}
+	else{ /* Do Nothing */ }
+	return active;
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Set_Priority_Grouping
+  * @brief 			- Selects how the priority bits split into preemption priority and subpriority
+  * @param [in] 	- group: Priority grouping @ref NVIC_PRIGROUP_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Set once before the priorities, they are encoded for the grouping in use
+  */
+void MCAL_NVIC_Set_Priority_Grouping(uint8 group){
+	/* AIRCR ignores writes without the key, the other writable bits reset the core and are left 0 */
+	SCB->AIRCR = NVIC_AIRCR_VECTKEY | (((uint32)group << NVIC_AIRCR_PRIGROUP_POS) & NVIC_AIRCR_PRIGROUP_MASK);
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Set_Priority
+  * @brief 			- Sets the priority of an interrupt
+  * @param [in] 	- irq: IRQ number, less than NVIC_IRQ_NUM
+  * @param [in] 	- preempt: Preemption priority, 0 is the highest, only an interrupt with a higher one nests
+  * @param [in] 	- sub: Subpriority, orders pending interrupts of the same preemption priority
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Values wider than the bits of the grouping in use are cut
+  */
+void MCAL_NVIC_Set_Priority(uint8 irq, uint8 preempt, uint8 sub){
+	if(NVIC_IRQ_NUM > irq){
+		NVIC->IP[irq] = MCAL_NVIC_Encode_Priority(preempt, sub);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Set_System_Priority
+  * @brief 			- Sets the priority of a system handler
+  * @param [in] 	- exception: Exception number @ref NVIC_SYSTEM_define
+  * @param [in] 	- preempt: Preemption priority, 0 is the highest
+  * @param [in] 	- sub: Subpriority
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Same encoding as MCAL_NVIC_Set_Priority
+  */
+void MCAL_NVIC_Set_System_Priority(uint8 exception, uint8 preempt, uint8 sub){
+	/* SHP starts at exception 4, the memory management fault */
+	if((NVIC_SYSTEM_SVCALL == exception) || (NVIC_SYSTEM_PENDSV == exception) || (NVIC_SYSTEM_SYSTICK == exception)){
+		SCB->SHP[exception - 4] = MCAL_NVIC_Encode_Priority(preempt, sub);
+	}
+	else{ /* Do Nothing */ }
+}
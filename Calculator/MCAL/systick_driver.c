@@ -11,6 +11,8 @@
 
 static void (*STK_Callback)(void);
 static uint8 Running_Mode; // Flag to determine the SysTick running mode
+static volatile uint32 STK_Ticks; // Milliseconds counted by the system tick
+static uint8 STK_Tick_Running; // 1 if the SysTick timer runs as the system tick
 
 /**=============================================
   * @Fn				- MCAL_STK_Config
@@ -131,7 +133,9 @@ void MCAL_STK_Delay(uint32 delay_ticks){
 	MCAL_STK_StartTimer();
 
 	/* Wait for flag to be set */
-	while( ( (STK->CTRL >> 16) & 0x01UL ) == 0);
+	while( ( (STK->CTRL >> 16) & 0x01UL ) == 0){
+		CPU_BUSY_WAIT();
+	}
 
 	/* Stop timer */
 	MCAL_STK_StopTimer();
@@ -148,17 +152,98 @@ void MCAL_STK_Delay(uint32 delay_ticks){
   * @param [out] 	- None
   * @retval 		- None
   * Note			- User must define the frequency of the SysTick timer in @ref stk_cpu_freq_define
+  * 				  Once the tick runs, delay_ms must be below 536000 at 8 MHz
   */
 void MCAL_STK_Delay1ms(uint32 delay_ms){
 	uint32 index;
 	uint32 ms_delay_time = ((STK_FCPU/1000UL)-1);
-	for(index = 0; index < delay_ms; index++){
-		MCAL_STK_Delay(ms_delay_time);
+	uint32 start, cycles, elapsed;
+	if(1 == STK_Tick_Running){
+		/* Timed in cycles so the delay is delay_ms and not up to one tick more */
+		start = MCAL_STK_Get_Cycles();
+		cycles = delay_ms * (STK_FCPU / 1000UL);
+		elapsed = 0;
+		while(elapsed < cycles){
+			if((cycles - elapsed) > (STK->LOAD + 1)){
+				/* The next tick wakes the core up before the delay is over */
+				CPU_WAIT_FOR_INTERRUPT();
+			}
+			else{
+				/* Less than one tick is left, it would be overslept */
+				CPU_BUSY_WAIT();
+			}
+			elapsed = MCAL_STK_Get_Cycles() - start;
+		}
+	}
+	else{
+		for(index = 0; index < delay_ms; index++){
+			MCAL_STK_Delay(ms_delay_time);
+		}
 	}
 }
 
+/**=============================================
+  * @Fn				- MCAL_STK_Tick_Init
+  * @brief 			- Starts the SysTick timer as a periodic 1 ms system tick
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Once the tick runs, MCAL_STK_Delay1ms sleeps until the tick count is reached instead of reconfiguring the timer
+  * 				  A callback set by MCAL_STK_SetCallback is still called on every tick
+  */
+void MCAL_STK_Tick_Init(void){
+	STK_config_t tick_cfg;
+	tick_cfg.running_mode = STK_PERIODIC_MODE;
+	tick_cfg.clock_config = STK_CLK_AHB;
+	tick_cfg.interrupt_config = STK_INTERRUPT_ENABLED;
+	tick_cfg.reload_value = (STK_FCPU / STK_TICK_HZ) - 1;
+	tick_cfg.Callback_Function = STK_Callback;
+	MCAL_STK_Config(&tick_cfg);
+	STK_Ticks = 0;
+	STK_Tick_Running = 1;
+	MCAL_STK_StartTimer();
+}
+
+/**=============================================
+  * @Fn				- MCAL_STK_Get_Tick
+  * @brief 			- Returns the number of milliseconds since MCAL_STK_Tick_Init
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Tick count, wraps around after 49 days
+  * Note			- Compare tick counts by subtracting them, so the wrap around does not matter
+  */
+uint32 MCAL_STK_Get_Tick(void){
+	return STK_Ticks;
+}
+
+/**=============================================
+  * @Fn				- MCAL_STK_Get_Cycles
+  * @brief 			- Returns the number of CPU clock cycles since MCAL_STK_Tick_Init
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Cycle count, wraps around after 536 seconds at 8 MHz
+  * Note			- Interrupts must be enabled, the count is read again if a tick comes while reading it
+  */
+uint32 MCAL_STK_Get_Cycles(void){
+	uint32 ticks, value;
+	do{
+		ticks = STK_Ticks;
+		value = STK->VAL;
+	}while(ticks != STK_Ticks);
+	return (ticks * (STK->LOAD + 1)) + (STK->LOAD - value);
+}
+
+/* Runs every millisecond, kept in SRAM next to the SRAM vector table */
+void SysTick_Handler(void) SECTION_RAMFUNC;
+
 void SysTick_Handler(void){
 
+	/* Count the system tick */
+	if(1 == STK_Tick_Running){
+		STK_Ticks++;
+	}
+	else{ /* Do Nothing */ }
+
 	/* If SysTick running mode is one shot, disable the SysTick timer */
 	if(STK_ONE_SHOT_MODE == Running_Mode){
 		MCAL_STK_StopTimer();
@@ -0,0 +1,188 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : uart_driver.c			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "uart_driver.h"
+
+static volatile uint8 UART_TX_Busy;
+static void (*UART_TX_Callback)(void);
+static uint16 UART_RX_Size;
+static void (*UART_RX_Callback)(uint16 position);
+
+/**=============================================
+  * @Fn				- MCAL_UART_Init
+  * @brief 			- Initializes the UART pins, frame format and baud rate
+  * @param [in] 	- _cfg: Pointer to struct containing UART configuration
+  * @param [out] 	- None
+  * @retval 		- Status @ref UART_STATUS_define, UART_BAD_BAUD if the baud rate is 0 or above UART_BAUD_MAX
+  * Note			- 8 data bits, no parity, the baud rate is rounded to the nearest divider of UART_PCLK
+  */
+uint8 MCAL_UART_Init(UART_config_t *_cfg){
+	GPIO_PinConfig_t Pin_Cfg;
+
+	if((0 == _cfg->baud_rate) || (UART_BAUD_MAX < _cfg->baud_rate)){
+		return UART_BAD_BAUD;
+	}
+	else{ /* Do Nothing */ }
+
+	RCC_GPIOB_CLK_EN();
+	RCC_USART3_CLK_EN();
+	RCC_DMA1_CLK_EN();
+
+	Pin_Cfg.GPIO_PinNumber = UART_TX_PIN;
+	Pin_Cfg.GPIO_MODE = GPIO_MODE_OUTPUT_AF_PP;
+	Pin_Cfg.GPIO_OUTPUT_SPEED = GPIO_SPEED_10M;
+	MCAL_GPIO_Init(UART_PORT, &Pin_Cfg);
+
+	Pin_Cfg.GPIO_PinNumber = UART_RX_PIN;
+	Pin_Cfg.GPIO_MODE = GPIO_MODE_INPUT_PU;
+	MCAL_GPIO_Init(UART_PORT, &Pin_Cfg);
+
+	UART_INSTANCE->CR1 = 0;
+	UART_INSTANCE->CR2 = ((uint32)(_cfg->stop_bits & UART_STOP_BITS_2)) << UART_CR2_STOP_POS;
+	UART_INSTANCE->CR3 = UART_CR3_DMAT;
+	UART_INSTANCE->BRR = (UART_PCLK + (_cfg->baud_rate / 2)) / _cfg->baud_rate;
+	UART_INSTANCE->CR1 = UART_CR1_UE | UART_CR1_TE | UART_CR1_RE;
+
+	UART_DMA_TX->CCR = 0;
+	UART_DMA_TX->CPAR = (uint32)&UART_INSTANCE->DR;
+	UART_TX_Busy = 0;
+	MCAL_NVIC_Enable(DMA1_CHANNEL2_IRQ);
+	return UART_OK;
+}
+
+/**=============================================
+  * @Fn				- MCAL_UART_Send_Async
+  * @brief 			- Starts sending a buffer in the background
+  * @param [in] 	- pData: Buffer to be sent, kept by the caller until pfDone is called
+  * @param [in] 	- length: Number of bytes, more than 0
+  * @param [in] 	- pfDone: Called from the interrupt once the last byte left the buffer, may be NULL
+  * @param [out] 	- None
+  * @retval 		- Status @ref UART_STATUS_define
+  * Note			- The DMA reads the bytes straight from pData, pfDone may start the next transmission
+  */
+uint8 MCAL_UART_Send_Async(const uint8 *pData, uint16 length, void (*pfDone)(void)){
+	if(0 != UART_TX_Busy){
+		return UART_BUSY;
+	}
+	else{ /* Do Nothing */ }
+	UART_TX_Busy = 1;
+	UART_TX_Callback = pfDone;
+
+	/* Channel must be disabled while it is reloaded */
+	UART_DMA_TX->CCR = 0;
+	UART_DMA_TX->CMAR = (uint32)pData;
+	UART_DMA_TX->CNDTR = length;
+	UART_DMA_TX->CCR = DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_TCIE | DMA_CCR_EN;
+	return UART_OK;
+}
+
+/**=============================================
+  * @Fn				- MCAL_UART_Is_Busy
+  * @brief 			- Checks if a transmission is running
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- 1 if busy, 0 if a new transmission can start
+  * Note			- None
+  */
+uint8 MCAL_UART_Is_Busy(void){
+	return UART_TX_Busy;
+}
+
+/**=============================================
+  * @Fn				- MCAL_UART_Receive_Start
+  * @brief 			- Starts receiving into a circular buffer in the background
+  * @param [in] 	- pBuffer: Buffer written by the DMA, kept by the caller while receiving
+  * @param [in] 	- size: Size of the buffer in bytes, more than 0
+  * @param [in] 	- pfReceived: Called from the interrupt with the write position when the line goes idle
+  * 				  and when the DMA reaches the middle or the end of the buffer, may be NULL
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Bytes from the caller's read position up to the write position are new,
+  * 				  the caller must read them before size more bytes arrive
+  */
+void MCAL_UART_Receive_Start(uint8 *pBuffer, uint16 size, void (*pfReceived)(uint16 position)){
+	UART_RX_Size = size;
+	UART_RX_Callback = pfReceived;
+
+	UART_DMA_RX->CCR = 0;
+	UART_DMA_RX->CPAR = (uint32)&UART_INSTANCE->DR;
+	UART_DMA_RX->CMAR = (uint32)pBuffer;
+	UART_DMA_RX->CNDTR = size;
+	UART_DMA_RX->CCR = DMA_CCR_PL_HIGH | DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_EN;
+
+	/* Clear a pending idle flag by reading SR then DR */
+	(void)UART_INSTANCE->SR;
+	(void)UART_INSTANCE->DR;
+	UART_INSTANCE->CR3 |= UART_CR3_DMAR;
+	UART_INSTANCE->CR1 |= UART_CR1_IDLEIE;
+	MCAL_NVIC_Enable(DMA1_CHANNEL3_IRQ);
+	MCAL_NVIC_Enable(USART3_IRQ);
+}
+
+/**=============================================
+  * @Fn				- MCAL_UART_Receive_Position
+  * @brief 			- Reads the position the next received byte is written at
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Write position inside the receive buffer
+  * Note			- Lets the caller poll instead of waiting for pfReceived
+  */
+uint16 MCAL_UART_Receive_Position(void){
+	uint16 position = UART_RX_Size - (uint16)UART_DMA_RX->CNDTR;
+
+	/* Counter reloads to size at the end of the buffer */
+	return (position == UART_RX_Size) ? 0 : position;
+}
+
+/**=============================================
+  * @Fn				- MCAL_UART_Received
+  * @brief 			- Tells the receiver the current write position
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called from the idle line and the receive DMA interrupts
+  */
+static void MCAL_UART_Received(void){
+	if(NULL != UART_RX_Callback){
+		UART_RX_Callback(MCAL_UART_Receive_Position());
+	}
+	else{ /* Do Nothing */ }
+}
+
+void DMA1_Channel2_IRQHandler(void){
+	if(0 != (UART_DMA->ISR & DMA_ISR_TCIF(UART_DMA_TX_CH))){
+		UART_DMA->IFCR = DMA_ISR_GIF(UART_DMA_TX_CH);
+		UART_DMA_TX->CCR = 0;
+		UART_TX_Busy = 0;
+
+		/* Buffer is free, the callback may start the next transmission */
+		if(NULL != UART_TX_Callback){
+			UART_TX_Callback();
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+void DMA1_Channel3_IRQHandler(void){
+	if(0 != (UART_DMA->ISR & (DMA_ISR_HTIF(UART_DMA_RX_CH) | DMA_ISR_TCIF(UART_DMA_RX_CH)))){
+		UART_DMA->IFCR = DMA_ISR_GIF(UART_DMA_RX_CH);
+		MCAL_UART_Received();
+	}
+	else{ /* Do Nothing */ }
+}
+
+void USART3_IRQHandler(void){
+	if(UART_SR_IDLE == (UART_INSTANCE->SR & UART_SR_IDLE)){
+		/* Idle flag is cleared by reading SR then DR, the DMA already took the data */
+		(void)UART_INSTANCE->DR;
+		MCAL_UART_Received();
+	}
+	else{ /* Do Nothing */ }
+}
@@ -0,0 +1,117 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : vector_driver.c			                             */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "vector_driver.h"
+
+/* Symbols of the startup and the linker script */
+extern uint32 g_pfnVectors[VECT_TABLE_ENTRIES];
+extern uint32 _sram_vectors[VECT_TABLE_ENTRIES];
+
+static volatile uint32 VECT_Entry_Cycle;	// Cycle counter read by the latency handlers
+
+static void VECT_Latency_Handler_RAM(void) SECTION_RAMFUNC;
+
+/**=============================================
+  * @Fn				- VECT_Latency_Handler
+  * @brief 			- Handler of VECT_TEST_IRQ run from flash
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Reads the cycle counter first
+  */
+static void VECT_Latency_Handler(void){
+	VECT_Entry_Cycle = DWT->CYCCNT;
+}
+
+/**=============================================
+  * @Fn				- VECT_Latency_Handler_RAM
+  * @brief 			- Handler of VECT_TEST_IRQ run from SRAM
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Reads the cycle counter first
+  */
+static void VECT_Latency_Handler_RAM(void){
+	VECT_Entry_Cycle = DWT->CYCCNT;
+}
+
+/**=============================================
+  * @Fn				- VECT_Measure
+  * @brief 			- Pends VECT_TEST_IRQ with a handler and counts the cycles until it runs
+  * @param [in] 	- pfHandler: Handler to be measured
+  * @param [out] 	- None
+  * @retval 		- Cycles from the write to STIR to the cycle counter read in the handler
+  * Note			- None
+  */
+static uint32 VECT_Measure(void (*pfHandler)(void)){
+	uint32 start;
+	MCAL_VECT_Set_Handler(VECT_IRQ(VECT_TEST_IRQ), pfHandler);
+	MCAL_NVIC_Enable(VECT_TEST_IRQ);
+	start = DWT->CYCCNT;
+	NVIC->STIR = VECT_TEST_IRQ;
+	CPU_SYNC_BARRIER();
+	MCAL_NVIC_Disable(VECT_TEST_IRQ);
+	return VECT_Entry_Cycle - start;
+}
+
+/**=============================================
+  * @Fn				- MCAL_VECT_Init
+  * @brief 			- Copies the vector table to SRAM and points VTOR at it
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Call before any interrupt is enabled, the table is placed by .ram_vectors in the linker script
+  */
+void MCAL_VECT_Init(void){
+	uint8 entry;
+	for(entry = 0; entry < VECT_TABLE_ENTRIES; entry++){
+		_sram_vectors[entry] = g_pfnVectors[entry];
+	}
+	CPU_SYNC_BARRIER();
+	SCB->VTOR = (uint32)_sram_vectors;
+	CPU_SYNC_BARRIER();
+}
+
+/**=============================================
+  * @Fn				- MCAL_VECT_Set_Handler
+  * @brief 			- Installs a handler in the SRAM vector table
+  * @param [in] 	- entry: Entry of the table, VECT_IRQ(IRQ number) for interrupts
+  * @param [in] 	- pfHandler: Handler to be installed
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- MCAL_VECT_Init must be called first, mark hot handlers with SECTION_RAMFUNC
+  */
+void MCAL_VECT_Set_Handler(uint8 entry, void (*pfHandler)(void)){
+	if(VECT_TABLE_ENTRIES > entry){
+		_sram_vectors[entry] = (uint32)pfHandler;
+		CPU_SYNC_BARRIER();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_VECT_Measure_Latency
+  * @brief 			- Counts the cycles from pending an interrupt to the first instruction of its handler
+  * @param [in] 	- None
+  * @param [out] 	- pLatency: Pointer to the cycles with the handler in flash and in SRAM
+  * @retval 		- None
+  * Note			- Uses the DWT cycle counter and VECT_TEST_IRQ, the vector table must be in SRAM
+  * 				  Flash has no wait states up to 24 MHz, so both are the same at the 8 MHz clock
+  */
+void MCAL_VECT_Measure_Latency(VECT_Latency_t *pLatency){
+	uint32 default_handler = _sram_vectors[VECT_IRQ(VECT_TEST_IRQ)];
+	DEMCR |= DEMCR_TRCENA;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA;
+
+	pLatency->flash_cycles = VECT_Measure(VECT_Latency_Handler);
+	pLatency->ram_cycles = VECT_Measure(VECT_Latency_Handler_RAM);
+
+	/* Give the borrowed entry back */
+	_sram_vectors[VECT_IRQ(VECT_TEST_IRQ)] = default_handler;
+}
@@ -29,9 +29,15 @@ typedef signed char			sint8;
 typedef unsigned char		uint8;
 typedef signed short		sint16;
 typedef unsigned short		uint16;
+#if defined(HOST_SIMULATION) && (HOST_SIMULATION == 1)
+/* long is 64 bits on the host, the register blocks and records keep their size with int */
+typedef signed int			sint32;
+typedef unsigned int		uint32;
+#else
 typedef signed long			sint32;
-typedef signed long long	sint64;
 typedef unsigned long		uint32;
+#endif
+typedef signed long long	sint64;
 typedef unsigned long long	uint64;
 typedef unsigned long		uint8_least;
 typedef unsigned long		uint16_least;
@@ -45,7 +51,11 @@ typedef void*				VoidPtr;
 typedef const void*			ConstVoidPtr;
 typedef volatile unsigned char	vuint8_t;
 typedef volatile unsigned short	vuint16_t;
+#if defined(HOST_SIMULATION) && (HOST_SIMULATION == 1)
+typedef volatile unsigned int	vuint32_t;
+#else
 typedef volatile unsigned long	vuint32_t;
+#endif
 #ifndef TRUE
 #define TRUE	1
 #endif
@@ -0,0 +1,87 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : arena.c 			                         	     	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "arena.h"
+
+static uint64 Arena_Memory[(ARENA_SIZE + ARENA_ALIGN - 1) / ARENA_ALIGN] SECTION_NOINIT;	// uint64 keeps the blocks aligned
+static uint16 Arena_Used;
+static uint16 Arena_Peak;
+
+/**=============================================
+  * @Fn				- Arena_Alloc
+  * @brief 			- Takes a zeroed block from the arena
+  * @param [in] 	- size: Size of the block in bytes
+  * @retval 		- Pointer to the block, NULL if the arena is full
+  * Note			- Blocks are only freed all at once by Arena_Reset
+  */
+void *Arena_Alloc(uint16 size){
+	uint8 *pBlock;
+	size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+	if(size > (sizeof(Arena_Memory) - Arena_Used)){
+		return NULL;
+	}
+	else{ /* Do Nothing */ }
+	pBlock = ((uint8*)Arena_Memory) + Arena_Used;
+	Arena_Used += size;
+	if(Arena_Used > Arena_Peak){
+		Arena_Peak = Arena_Used;
+	}
+	else{ /* Do Nothing */ }
+	memset(pBlock, 0, size);
+	return pBlock;
+}
+
+/**=============================================
+  * @Fn				- Arena_Resume
+  * @brief 			- Takes the first block of the arena again without clearing it
+  * @param [in] 	- size: Size of the block in bytes
+  * @retval 		- Pointer to the block
+  * Note			- The arena is kept in .noinit, after a warm restart the block holds what the mode left in it
+  */
+void *Arena_Resume(uint16 size){
+	Arena_Used = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+	if(Arena_Used > Arena_Peak){
+		Arena_Peak = Arena_Used;
+	}
+	else{ /* Do Nothing */ }
+	return Arena_Memory;
+}
+
+/**=============================================
+  * @Fn				- Arena_Get_Memory
+  * @brief 			- Returns the memory of the arena
+  * @param [in] 	- None
+  * @retval 		- Pointer to ARENA_SIZE bytes
+  * Note			- Lets the caller check the arena survived a warm restart
+  */
+const uint8 *Arena_Get_Memory(void){
+	return (const uint8*)Arena_Memory;
+}
+
+/**=============================================
+  * @Fn				- Arena_Reset
+  * @brief 			- Frees every block of the arena
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Called when a mode exits, pointers to the blocks must not be used after it
+  */
+void Arena_Reset(void){
+	Arena_Used = 0;
+}
+
+/**=============================================
+  * @Fn				- Arena_Get_Peak
+  * @brief 			- Reads the most bytes the arena held since start up
+  * @param [in] 	- None
+  * @retval 		- Peak use in bytes, including alignment
+  * Note			- None
+  */
+uint16 Arena_Get_Peak(void){
+	return Arena_Peak;
+}
@@ -0,0 +1,87 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : arena.h 			                         	     	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef ARENA_H_
+#define ARENA_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "Platform_Types.h"
+#include "STM32F103x8.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#if HOST_SIMULATION == 1
+#define ARENA_SIZE				48			// Pointers of the host build take 8 bytes
+#else
+#define ARENA_SIZE				40			// Bytes shared by the modes, only one mode runs at a time, numbering_work_t needs 40
+#endif
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define ARENA_ALIGN				8			// Every block may hold uint64
+
+/* Stops the build if a working set does not fit the arena */
+#define ARENA_CHECK(_TYPE_)		_Static_assert(sizeof(_TYPE_) <= ARENA_SIZE, #_TYPE_ " does not fit ARENA_SIZE")
+
+/*
+ * =============================================
+ * APIs Supported by "arena"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Arena_Alloc
+  * @brief 			- Takes a zeroed block from the arena
+  * @param [in] 	- size: Size of the block in bytes
+  * @retval 		- Pointer to the block, NULL if the arena is full
+  * Note			- Blocks are only freed all at once by Arena_Reset
+  */
+void *Arena_Alloc(uint16 size);
+
+/**=============================================
+  * @Fn				- Arena_Resume
+  * @brief 			- Takes the first block of the arena again without clearing it
+  * @param [in] 	- size: Size of the block in bytes
+  * @retval 		- Pointer to the block
+  * Note			- The arena is kept in .noinit, after a warm restart the block holds what the mode left in it
+  */
+void *Arena_Resume(uint16 size);
+
+/**=============================================
+  * @Fn				- Arena_Get_Memory
+  * @brief 			- Returns the memory of the arena
+  * @param [in] 	- None
+  * @retval 		- Pointer to ARENA_SIZE bytes
+  * Note			- Lets the caller check the arena survived a warm restart
+  */
+const uint8 *Arena_Get_Memory(void);
+
+/**=============================================
+  * @Fn				- Arena_Reset
+  * @brief 			- Frees every block of the arena
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Called when a mode exits, pointers to the blocks must not be used after it
+  */
+void Arena_Reset(void);
+
+/**=============================================
+  * @Fn				- Arena_Get_Peak
+  * @brief 			- Reads the most bytes the arena held since start up
+  * @param [in] 	- None
+  * @retval 		- Peak use in bytes, including alignment
+  * Note			- None
+  */
+uint16 Arena_Get_Peak(void);
+
+#endif /* ARENA_H_ */
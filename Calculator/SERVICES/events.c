@@ -0,0 +1,220 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : events.c 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "events.h"
+
+#define EVENTS_QUEUE_MASK	(EVENTS_QUEUE_SIZE - 1)
+
+/* Interrupts only write the head, the main loop only writes the tail */
+static event_t Events_Queue[EVENTS_QUEUE_SIZE];
+static volatile uint8 Events_Head;
+static volatile uint8 Events_Tail;
+static event_t Events_Delivered = {EVENT_NONE, 'F'};
+
+/* Timers counted by the system tick, 0 if stopped */
+static volatile uint32 Events_Timer_Period;
+static volatile uint32 Events_Timer_Count;
+static volatile uint32 Events_Hold_Count;
+
+/* Statistics of the current window */
+static uint32 Events_Window_Start;
+static uint32 Events_Idle_Cycles;
+static uint32 Events_Wakeups;
+static uint32 Events_Count;
+static volatile uint16 Events_Dropped;
+static events_stats_t Events_Stats;
+
+/**=============================================
+  * @Fn				- Events_Update_Stats
+  * @brief 			- Closes the statistics window once EVENTS_STATS_WINDOW_MS has passed
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void Events_Update_Stats(void){
+	uint32 elapsed = MCAL_STK_Get_Tick() - Events_Window_Start;
+	uint32 window_cycles;
+	if(EVENTS_STATS_WINDOW_MS <= elapsed){
+		window_cycles = elapsed * (STK_FCPU / 1000UL);
+		Events_Idle_Cycles = (Events_Idle_Cycles > window_cycles) ? window_cycles : Events_Idle_Cycles;
+		Events_Stats.idle_percent = Events_Idle_Cycles / (window_cycles / 100UL);
+		Events_Stats.wakeups_per_second = (Events_Wakeups * 1000UL) / elapsed;
+		Events_Stats.events_per_second = (Events_Count * 1000UL) / elapsed;
+		Events_Stats.dropped = Events_Dropped;
+		Events_Window_Start += elapsed;
+		Events_Idle_Cycles = 0;
+		Events_Wakeups = 0;
+		Events_Count = 0;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Events_Post
+  * @brief 			- Adds an event to the end of the queue
+  * @param [in] 	- type: Type of the event @ref event_type_t
+  * @param [in] 	- data: Data of the event
+  * @retval 		- Status @ref EVENTS_STATUS_define
+  * Note			- May be called from an interrupt below priority 0, the event is dropped if the queue is full
+  */
+uint8 Events_Post(uint8 type, uint8 data){
+	uint32 basepri;
+	uint8 next;
+	uint8 status = EVENTS_OK;
+	NVIC_CRITICAL_ENTER(basepri);
+	next = (Events_Head + 1) & EVENTS_QUEUE_MASK;
+	if(next != Events_Tail){
+		Events_Queue[Events_Head].type = type;
+		Events_Queue[Events_Head].data = data;
+		Events_Head = next;
+	}
+	else{
+		Events_Dropped++;
+		status = EVENTS_QUEUE_FULL;
+	}
+	NVIC_CRITICAL_EXIT(basepri);
+	return status;
+}
+
+/**=============================================
+  * @Fn				- Events_Wait
+  * @brief 			- Sleeps until the queue has an event and makes it the current event
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The core sleeps with WFI while the queue is empty, sleeping time and wakeups are counted
+  */
+void Events_Wait(void){
+	uint32 start;
+	while(Events_Head == Events_Tail){
+		start = MCAL_STK_Get_Cycles();
+		/* Interrupts are masked so an event posted after the check still wakes the core up */
+		GLOBAL_IRQ_DISABLE();
+		if(Events_Head == Events_Tail){
+			CPU_WAIT_FOR_INTERRUPT();
+		}
+		else{ /* Do Nothing */ }
+		GLOBAL_IRQ_ENABLE();
+		Events_Idle_Cycles += MCAL_STK_Get_Cycles() - start;
+		Events_Wakeups++;
+		Events_Update_Stats();
+	}
+	Events_Delivered = Events_Queue[Events_Tail];
+	Events_Tail = (Events_Tail + 1) & EVENTS_QUEUE_MASK;
+	Events_Count++;
+}
+
+/**=============================================
+  * @Fn				- Events_Current
+  * @brief 			- Returns the event being delivered to the handlers
+  * @param [in] 	- None
+  * @retval 		- Current event
+  * Note			- None
+  */
+const event_t *Events_Current(void){
+	return &Events_Delivered;
+}
+
+/**=============================================
+  * @Fn				- Events_Key
+  * @brief 			- Returns the key of the current event
+  * @param [in] 	- None
+  * @retval 		- Pressed key, or F if the current event is not a key event
+  * Note			- Takes the place of polling the keypad in the state handlers
+  */
+uint8 Events_Key(void){
+	return (EVENT_KEY == Events_Delivered.type) ? Events_Delivered.data : 'F';
+}
+
+/**=============================================
+  * @Fn				- Events_Tick
+  * @brief 			- Counts the timers of the events service
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- To be called from the 1 ms system tick interrupt
+  */
+void Events_Tick(void){
+	if(0 != Events_Timer_Period){
+		Events_Timer_Count++;
+		if(Events_Timer_Period <= Events_Timer_Count){
+			Events_Timer_Count = 0;
+			Events_Post(EVENT_TIMER, 0);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+
+	if(0 != Events_Hold_Count){
+		Events_Hold_Count--;
+		if(0 == Events_Hold_Count){
+			Events_Post(EVENT_DISPLAY_DONE, 0);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Events_Timer_Start
+  * @brief 			- Posts an EVENT_TIMER every period
+  * @param [in] 	- period_ms: Period of the timer events in milliseconds
+  * @retval 		- None
+  * Note			- Only one timer, starting it again changes its period
+  */
+void Events_Timer_Start(uint32 period_ms){
+	uint32 basepri;
+	/* Events_Tick reads both from the tick interrupt */
+	NVIC_CRITICAL_ENTER(basepri);
+	Events_Timer_Count = 0;
+	Events_Timer_Period = period_ms;
+	NVIC_CRITICAL_EXIT(basepri);
+}
+
+/**=============================================
+  * @Fn				- Events_Timer_Stop
+  * @brief 			- Stops the timer events
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void Events_Timer_Stop(void){
+	Events_Timer_Period = 0;
+}
+
+/**=============================================
+  * @Fn				- Events_Display_Hold
+  * @brief 			- Posts one EVENT_DISPLAY_DONE once the screen was shown for some time
+  * @param [in] 	- time_ms: Time in milliseconds, 0 cancels a pending hold
+  * @retval 		- None
+  * Note			- None
+  */
+void Events_Display_Hold(uint32 time_ms){
+	Events_Hold_Count = time_ms;
+}
+
+/**=============================================
+  * @Fn				- Events_Get_Stats
+  * @brief 			- Reads the idle and wakeup statistics of the last window
+  * @param [out] 	- pStats: Pointer to the statistics
+  * @retval 		- None
+  * Note			- Statistics are updated every EVENTS_STATS_WINDOW_MS @ref EVENTS_QUEUE_define
+  */
+void Events_Get_Stats(events_stats_t *pStats){
+	*pStats = Events_Stats;
+}
+
+/**=============================================
+  * @Fn				- Events_Pending
+  * @brief 			- Checks if the queue has events waiting
+  * @param [in] 	- None
+  * @retval 		- 1 if an event waits, 0 if Events_Wait would sleep
+  * Note			- None
+  */
+uint8 Events_Pending(void){
+	return (Events_Head != Events_Tail) ? 1 : 0;
+}
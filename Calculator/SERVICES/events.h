@@ -0,0 +1,153 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : events.h 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef EVENTS_H_
+#define EVENTS_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Platform_Types.h"
+#include "systick_driver.h"
+#include "nvic_driver.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref EVENTS_QUEUE_define
+#define EVENTS_QUEUE_SIZE			16		// Power of two, one entry is kept free to tell a full queue from an empty one
+#define EVENTS_STATS_WINDOW_MS		1000	// Idle and wakeup statistics are updated once per window
+
+// @ref EVENTS_STATUS_define
+#define EVENTS_OK					0x00U
+#define EVENTS_QUEUE_FULL			0x01U	// The event was dropped
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	EVENT_NONE,
+	EVENT_KEY,				// data: key as returned by keypad_Scan
+	EVENT_TIMER,			// Period of Events_Timer_Start has passed
+	EVENT_DISPLAY_DONE,		// Time of Events_Display_Hold has passed
+	EVENT_CONTINUE,			// Posted by a handler that has more work to do, or to run a state that was just entered
+	EVENT_SERIAL,			// Serial console received requests or finished sending replies
+	events_types_max
+}event_type_t;
+
+typedef struct{
+	uint8 type;		// @ref event_type_t
+	uint8 data;
+}event_t;
+
+typedef struct{
+	uint8  idle_percent;			// Time spent sleeping in the last window
+	uint16 wakeups_per_second;		// Times the core woke up, mostly system ticks
+	uint16 events_per_second;		// Events delivered to the handlers
+	uint16 dropped;					// Events lost because the queue was full, since start up
+}events_stats_t;
+
+/*
+ * =============================================
+ * APIs Supported by "events"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Events_Post
+  * @brief 			- Adds an event to the end of the queue
+  * @param [in] 	- type: Type of the event @ref event_type_t
+  * @param [in] 	- data: Data of the event
+  * @retval 		- Status @ref EVENTS_STATUS_define
+  * Note			- May be called from an interrupt below priority 0, the event is dropped if the queue is full
+  */
+uint8 Events_Post(uint8 type, uint8 data);
+
+/**=============================================
+  * @Fn				- Events_Wait
+  * @brief 			- Sleeps until the queue has an event and makes it the current event
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The core sleeps with WFI while the queue is empty, sleeping time and wakeups are counted
+  */
+void Events_Wait(void);
+
+/**=============================================
+  * @Fn				- Events_Current
+  * @brief 			- Returns the event being delivered to the handlers
+  * @param [in] 	- None
+  * @retval 		- Current event
+  * Note			- None
+  */
+const event_t *Events_Current(void);
+
+/**=============================================
+  * @Fn				- Events_Key
+  * @brief 			- Returns the key of the current event
+  * @param [in] 	- None
+  * @retval 		- Pressed key, or F if the current event is not a key event
+  * Note			- Takes the place of polling the keypad in the state handlers
+  */
+uint8 Events_Key(void);
+
+/**=============================================
+  * @Fn				- Events_Tick
+  * @brief 			- Counts the timers of the events service
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- To be called from the 1 ms system tick interrupt
+  */
+void Events_Tick(void);
+
+/**=============================================
+  * @Fn				- Events_Timer_Start
+  * @brief 			- Posts an EVENT_TIMER every period
+  * @param [in] 	- period_ms: Period of the timer events in milliseconds
+  * @retval 		- None
+  * Note			- Only one timer, starting it again changes its period
+  */
+void Events_Timer_Start(uint32 period_ms);
+
+/**=============================================
+  * @Fn				- Events_Timer_Stop
+  * @brief 			- Stops the timer events
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void Events_Timer_Stop(void);
+
+/**=============================================
+  * @Fn				- Events_Display_Hold
+  * @brief 			- Posts one EVENT_DISPLAY_DONE once the screen was shown for some time
+  * @param [in] 	- time_ms: Time in milliseconds, 0 cancels a pending hold
+  * @retval 		- None
+  * Note			- None
+  */
+void Events_Display_Hold(uint32 time_ms);
+
+/**=============================================
+  * @Fn				- Events_Get_Stats
+  * @brief 			- Reads the idle and wakeup statistics of the last window
+  * @param [out] 	- pStats: Pointer to the statistics
+  * @retval 		- None
+  * Note			- Statistics are updated every EVENTS_STATS_WINDOW_MS @ref EVENTS_QUEUE_define
+  */
+void Events_Get_Stats(events_stats_t *pStats);
+
+/**=============================================
+  * @Fn				- Events_Pending
+  * @brief 			- Checks if the queue has events waiting
+  * @param [in] 	- None
+  * @retval 		- 1 if an event waits, 0 if Events_Wait would sleep
+  * Note			- None
+  */
+uint8 Events_Pending(void);
+
+#endif /* EVENTS_H_ */
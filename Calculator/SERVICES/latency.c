@@ -0,0 +1,134 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : latency.c 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "latency.h"
+
+#define LATENCY_KEYS_MASK		(LATENCY_KEYS - 1)
+
+/* Cycle counter when each posted key was seen down, the main loop handles them in the same order */
+static uint32 Latency_Down_Cycles[LATENCY_KEYS];
+static volatile uint8 Latency_Down_Head;
+static volatile uint8 Latency_Down_Tail;
+
+static uint8 Latency_Measuring;				// 1 while a key waits for its result to be shown
+static uint8 Latency_Class;					// @ref LATENCY_CLASS_define
+static uint32 Latency_Start_Cycles;			// Key down of the measured key
+static uint32 Latency_Start_Strobes;		// LCD strobe count when the key was taken by the main loop
+static latency_histogram_t Latency_Histograms[LATENCY_CLASSES];
+
+/**=============================================
+  * @Fn				- Latency_End
+  * @brief 			- Adds the measured key to the histogram of its class
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void Latency_End(void){
+	latency_histogram_t *pHistogram = &Latency_Histograms[Latency_Class];
+	uint32 latency_us;
+	uint32 upper = LATENCY_BIN0_US;
+	uint8 bin = 0;
+	Latency_Measuring = 0;
+	if(0xFFFF == pHistogram->count){
+		return;
+	}
+	else{ /* Do Nothing */ }
+
+	if(Latency_Start_Strobes == LCD_Get_Strobe_Count()){
+		pHistogram->no_update++;
+	}
+	else{
+		latency_us = (LCD_Get_Strobe_Cycles() - Latency_Start_Cycles) / (STK_FCPU / 1000000UL);
+		while(((LATENCY_BINS - 1) > bin) && (upper <= latency_us)){
+			upper <<= 1;
+			bin++;
+		}
+		pHistogram->bins[bin]++;
+		pHistogram->count++;
+		pHistogram->max_us = (latency_us > pHistogram->max_us) ? latency_us : pHistogram->max_us;
+	}
+}
+
+/**=============================================
+  * @Fn				- Latency_Key_Down
+  * @brief 			- Timestamps a key the keypad scan just saw pressed
+  * @param [in] 	- status: Status of Events_Post for the key @ref EVENTS_STATUS_define
+  * @retval 		- None
+  * Note			- Called from the system tick right after the key is posted, use the LATENCY_KEY_DOWN macro
+  * 				  The key closed up to KEYPAD_SCAN_PERIOD_MS before the scan saw it
+  */
+void Latency_Key_Down(uint8 status){
+	uint8 next = (Latency_Down_Head + 1) & LATENCY_KEYS_MASK;
+	if((EVENTS_OK == status) && (next != Latency_Down_Tail)){
+		Latency_Down_Cycles[Latency_Down_Head] = MCAL_STK_Get_Cycles();
+		Latency_Down_Head = next;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Latency_Key_Start
+  * @brief 			- Starts measuring the key the main loop is about to handle
+  * @param [in] 	- key: Key of the EVENT_KEY
+  * @retval 		- None
+  * Note			- A key still measured is ended first, use the LATENCY_KEY_START macro
+  */
+void Latency_Key_Start(uint8 key){
+	if(1 == Latency_Measuring){
+		Latency_End();
+	}
+	else{ /* Do Nothing */ }
+
+	if(Latency_Down_Head != Latency_Down_Tail){
+		Latency_Start_Cycles = Latency_Down_Cycles[Latency_Down_Tail];
+		Latency_Down_Tail = (Latency_Down_Tail + 1) & LATENCY_KEYS_MASK;
+		Latency_Start_Strobes = LCD_Get_Strobe_Count();
+		if(9 >= key){
+			Latency_Class = LATENCY_DIGIT;
+		}
+		else if(('+' == key) || ('-' == key) || ('x' == key) || ('/' == key)){
+			Latency_Class = LATENCY_OPERATOR;
+		}
+		else if('=' == key){
+			Latency_Class = LATENCY_EQUALS;
+		}
+		else{
+			Latency_Class = LATENCY_CLEAR;
+		}
+		Latency_Measuring = 1;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Latency_Event_Done
+  * @brief 			- Ends the measured key once the main loop has nothing left to do
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Called after every event, work continued with EVENT_CONTINUE counts for the key
+  * 				  The last LCD enable strobe since the key is the time the result was shown
+  */
+void Latency_Event_Done(void){
+	if((1 == Latency_Measuring) && (0 == Events_Pending())){
+		Latency_End();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Latency_Get_Histogram
+  * @brief 			- Reads the histogram of a class of keys
+  * @param [in] 	- class: Class of keys @ref LATENCY_CLASS_define
+  * @param [out] 	- pHistogram: Pointer to the histogram
+  * @retval 		- None
+  * Note			- None
+  */
+void Latency_Get_Histogram(uint8 class, latency_histogram_t *pHistogram){
+	*pHistogram = Latency_Histograms[class];
+}
@@ -0,0 +1,109 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : latency.h 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Platform_Types.h"
+#include "systick_driver.h"
+#include "nvic_driver.h"
+#include "lcd_driver.h"
+#include "events.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#ifndef LATENCY_ENABLE
+#define LATENCY_ENABLE			1			// 1 measures the time from every key to the LCD showing its result
+#endif
+#define LATENCY_BINS			16			// Bin 0 is below LATENCY_BIN0_US, every next bin is twice as wide
+#define LATENCY_BIN0_US			128UL		// Power of two
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref LATENCY_CLASS_define
+/* Keys are measured apart, a result takes longer to show than an echoed digit */
+#define LATENCY_DIGIT			0
+#define LATENCY_OPERATOR		1			// + - x /
+#define LATENCY_EQUALS			2
+#define LATENCY_CLEAR			3			// C and any other key
+#define LATENCY_CLASSES			4
+
+#define LATENCY_KEYS			EVENTS_QUEUE_SIZE	// Keys waiting for the main loop, no more fit in the event queue
+
+#if LATENCY_ENABLE == 1
+#define LATENCY_KEY_DOWN(_STATUS_)	Latency_Key_Down(_STATUS_)
+#define LATENCY_KEY_START(_KEY_)	Latency_Key_Start(_KEY_)
+#define LATENCY_EVENT_DONE()		Latency_Event_Done()
+#else
+#define LATENCY_KEY_DOWN(_STATUS_)
+#define LATENCY_KEY_START(_KEY_)
+#define LATENCY_EVENT_DONE()
+#endif
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint16 count;					// Keys measured, stops at 0xFFFF
+	uint16 no_update;				// Keys that did not change the LCD
+	uint32 max_us;
+	uint16 bins[LATENCY_BINS];		// Keys per bin, bin n holds LATENCY_BIN0_US << (n - 1) up to LATENCY_BIN0_US << n
+}latency_histogram_t;
+
+/*
+ * =============================================
+ * APIs Supported by "latency"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Latency_Key_Down
+  * @brief 			- Timestamps a key the keypad scan just saw pressed
+  * @param [in] 	- status: Status of Events_Post for the key @ref EVENTS_STATUS_define
+  * @retval 		- None
+  * Note			- Called from the system tick right after the key is posted, use the LATENCY_KEY_DOWN macro
+  * 				  The key closed up to KEYPAD_SCAN_PERIOD_MS before the scan saw it
+  */
+void Latency_Key_Down(uint8 status);
+
+/**=============================================
+  * @Fn				- Latency_Key_Start
+  * @brief 			- Starts measuring the key the main loop is about to handle
+  * @param [in] 	- key: Key of the EVENT_KEY
+  * @retval 		- None
+  * Note			- A key still measured is ended first, use the LATENCY_KEY_START macro
+  */
+void Latency_Key_Start(uint8 key);
+
+/**=============================================
+  * @Fn				- Latency_Event_Done
+  * @brief 			- Ends the measured key once the main loop has nothing left to do
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Called after every event, work continued with EVENT_CONTINUE counts for the key
+  * 				  The last LCD enable strobe since the key is the time the result was shown
+  */
+void Latency_Event_Done(void);
+
+/**=============================================
+  * @Fn				- Latency_Get_Histogram
+  * @brief 			- Reads the histogram of a class of keys
+  * @param [in] 	- class: Class of keys @ref LATENCY_CLASS_define
+  * @param [out] 	- pHistogram: Pointer to the histogram
+  * @retval 		- None
+  * Note			- None
+  */
+void Latency_Get_Histogram(uint8 class, latency_histogram_t *pHistogram);
+
+#endif /* LATENCY_H_ */
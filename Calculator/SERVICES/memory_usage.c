@@ -0,0 +1,96 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : memory_usage.c 			                         	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "memory_usage.h"
+
+/* Symbols of the linker script, only their addresses are used */
+extern uint32 _end;
+extern uint32 _estack;
+extern uint32 _Min_Stack_Size;
+
+/* Kept by _sbrk in sysmem.c */
+extern uint8 *__sbrk_heap_end;
+extern uint8 *__sbrk_heap_peak;
+extern uint32 __sbrk_calls;
+extern uint32 __sbrk_failures;
+
+static volatile uint8 Mem_Stack_Overflow;
+
+/**=============================================
+  * @Fn				- Mem_Stack_Limit
+  * @brief 			- Returns the lowest address the stack may use
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Stack limit address
+  * Note			- None
+  */
+static uint32 Mem_Stack_Limit(void){
+	return (uint32)&_estack - (uint32)&_Min_Stack_Size;
+}
+
+/**=============================================
+  * @Fn				- Mem_Get_Usage
+  * @brief 			- Reads the high water marks of the stack and heap
+  * @param [in] 	- None
+  * @param [out] 	- pUsage: Pointer to the usage
+  * @retval 		- None
+  * Note			- Scans the painted words between the heap and the stack, takes about 2 cycles per free byte
+  */
+void Mem_Get_Usage(mem_usage_t *pUsage){
+	uint32 heap_start = (uint32)&_end;
+	uint32 heap_peak = (NULL == __sbrk_heap_peak) ? heap_start : (uint32)__sbrk_heap_peak;
+	uint32 *pWord = (uint32*)((heap_peak + 3) & ~3UL);
+
+	/* Words still painted above the heap peak were never reached by the stack */
+	while(((uint32)pWord < (uint32)&_estack) && (MEM_PAINT_PATTERN == *pWord)){
+		pWord++;
+	}
+
+	pUsage->stack_limit = (uint32)&_Min_Stack_Size;
+	pUsage->stack_peak = (uint32)&_estack - (uint32)pWord;
+	pUsage->heap_used = (NULL == __sbrk_heap_end) ? 0 : ((uint32)__sbrk_heap_end - heap_start);
+	pUsage->heap_peak = heap_peak - heap_start;
+	pUsage->never_used = (uint32)pWord - heap_peak;
+	pUsage->sbrk_calls = __sbrk_calls;
+	pUsage->sbrk_failures = __sbrk_failures;
+	pUsage->stack_overflow = (pUsage->stack_peak > pUsage->stack_limit) ? 1 : Mem_Stack_Overflow;
+}
+
+/**=============================================
+  * @Fn				- Mem_Check_Stack
+  * @brief 			- Checks that the stack stayed above its limit
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called from the system tick through MEM_STACK_CHECK, the first overflow is traced with TRACE_ID_STACK
+  */
+void Mem_Check_Stack(void){
+	uint32 sp;
+	uint32 limit = Mem_Stack_Limit();
+	const uint32 *pGuard = (const uint32*)(limit - (MEM_GUARD_WORDS * 4));
+	uint8 index;
+	uint8 overflow;
+
+	/* Stack pointer of the interrupt, or guard words below the limit written since reset,
+	 * guard words given to the heap are left out */
+	CPU_GET_SP(sp);
+	overflow = (sp < limit) ? 1 : 0;
+	for(index = 0; index < MEM_GUARD_WORDS; index++){
+		if(((uint32)&pGuard[index] >= (uint32)__sbrk_heap_peak) && (MEM_PAINT_PATTERN != pGuard[index])){
+			overflow = 1;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	if((1 == overflow) && (0 == Mem_Stack_Overflow)){
+		Mem_Stack_Overflow = 1;
+		TRACE(TRACE_ID_STACK, (uint16)((uint32)&_estack - sp));
+	}
+	else{ /* Do Nothing */ }
+}
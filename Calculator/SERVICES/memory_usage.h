@@ -0,0 +1,78 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : memory_usage.h 			                         	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef MEMORY_USAGE_H_
+#define MEMORY_USAGE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Platform_Types.h"
+#include "STM32F103x8.h"
+#include "trace.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#ifndef MEM_STACK_CHECK_ENABLE
+#define MEM_STACK_CHECK_ENABLE	1			// 1 checks the stack limit on every system tick
+#endif
+#define MEM_GUARD_WORDS			4			// Painted words just below the stack limit checked by the tick
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define MEM_PAINT_PATTERN		0xDEADBEEFUL	// Written by Reset_Handler from the heap start to the stack top, keep both the same
+
+#if MEM_STACK_CHECK_ENABLE == 1
+#define MEM_STACK_CHECK()		Mem_Check_Stack()
+#else
+#define MEM_STACK_CHECK()
+#endif
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint32 stack_limit;			// Stack reserved by _Min_Stack_Size in the linker script
+	uint32 stack_peak;			// Deepest the stack went since reset
+	uint32 heap_used;			// Heap given by _sbrk now
+	uint32 heap_peak;			// Most heap given by _sbrk since reset
+	uint32 never_used;			// Bytes between the heap peak and the stack peak never written
+	uint32 sbrk_calls;
+	uint32 sbrk_failures;		// Calls refused because the heap would reach the stack
+	uint8  stack_overflow;		// 1 if the stack went past its limit
+}mem_usage_t;
+
+/*
+ * =============================================
+ * APIs Supported by "memory_usage"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Mem_Get_Usage
+  * @brief 			- Reads the high water marks of the stack and heap
+  * @param [in] 	- None
+  * @param [out] 	- pUsage: Pointer to the usage
+  * @retval 		- None
+  * Note			- Scans the painted words between the heap and the stack, takes about 2 cycles per free byte
+  */
+void Mem_Get_Usage(mem_usage_t *pUsage);
+
+/**=============================================
+  * @Fn				- Mem_Check_Stack
+  * @brief 			- Checks that the stack stayed above its limit
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called from the system tick through MEM_STACK_CHECK, the first overflow is traced with TRACE_ID_STACK
+  */
+void Mem_Check_Stack(void);
+
+#endif /* MEMORY_USAGE_H_ */
@@ -0,0 +1,294 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : replay.c 			                         	     	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "replay.h"
+
+#define REPLAY_LATENCY_MASK		(REPLAY_LATENCY_KEYS - 1)
+#define REPLAY_DELTA_MAX		0xFFFFUL
+
+static uint8 Replay_Recording[REPLAY_RECORD_KEYS * REPLAY_KEY_BYTES];
+static uint16 Replay_Recorded;				// Bytes of Replay_Recording in use
+static const uint8 *Replay_Source;			// Recording being replayed
+static uint16 Replay_Source_Length;
+static uint16 Replay_Position;				// Byte of Replay_Source of the next key
+static volatile uint8 Replay_Mode;			// @ref REPLAY_MODE_define
+static uint32 Replay_Start_Tick;			// Tick the session started
+static uint32 Replay_Last_Tick;				// Tick of the last recorded key
+static uint32 Replay_Due_Tick;				// Tick the next key is replayed or generated
+static uint16 Replay_Storm_Left;
+static uint16 Replay_Storm_Period;
+static uint32 Replay_Random;
+static const uint8 Replay_Storm_Keys[REPLAY_STORM_KEY_COUNT] = REPLAY_STORM_KEYS;
+
+/* Cycle counter when each posted key was queued, the main loop handles them in the same order */
+static uint32 Replay_Post_Cycles[REPLAY_LATENCY_KEYS];
+static volatile uint8 Replay_Post_Head;
+static volatile uint8 Replay_Post_Tail;
+static uint64 Replay_Latency_Sum;			// Cycles
+static uint32 Replay_Latency_Max;			// Cycles
+static replay_report_t Replay_Report;
+
+/**=============================================
+  * @Fn				- Replay_Begin
+  * @brief 			- Clears the report and starts a session
+  * @param [in] 	- mode: Session @ref REPLAY_MODE_define
+  * @retval 		- None
+  * Note			- Must be called inside a critical section
+  */
+static void Replay_Begin(uint8 mode){
+	Replay_Start_Tick = MCAL_STK_Get_Tick();
+	Replay_Latency_Sum = 0;
+	Replay_Latency_Max = 0;
+	Replay_Report.keys = 0;
+	Replay_Report.dropped = 0;
+	Replay_Report.handled = 0;
+	Replay_Report.session_ms = 0;
+	Replay_Mode = mode;
+}
+
+/**=============================================
+  * @Fn				- Replay_Delta
+  * @brief 			- Reads the time before a key of the recording being replayed
+  * @param [in] 	- position: Byte of the key
+  * @retval 		- Milliseconds since the previous key
+  * Note			- None
+  */
+static uint32 Replay_Delta(uint16 position){
+	return (uint32)Replay_Source[position + 1] | ((uint32)Replay_Source[position + 2] << 8);
+}
+
+/**=============================================
+  * @Fn				- Replay_Storm_Next
+  * @brief 			- Picks the next key of the key storm
+  * @param [in] 	- None
+  * @retval 		- Key out of Replay_Storm_Keys
+  * Note			- xorshift32, the same seed gives the same keys
+  */
+static uint8 Replay_Storm_Next(void){
+	Replay_Random ^= Replay_Random << 13;
+	Replay_Random ^= Replay_Random >> 17;
+	Replay_Random ^= Replay_Random << 5;
+	return Replay_Storm_Keys[Replay_Random % REPLAY_STORM_KEY_COUNT];
+}
+
+/**=============================================
+  * @Fn				- Replay_Boot
+  * @brief 			- Starts the session selected by REPLAY_BOOT_MODE
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Use the REPLAY_BOOT macro so it can be removed from the build
+  */
+void Replay_Boot(void){
+#if REPLAY_BOOT_MODE == REPLAY_RECORDING
+	Replay_Record_Start();
+#elif REPLAY_BOOT_MODE == REPLAY_STORM
+	Replay_Storm_Start(REPLAY_STORM_PERIOD_MS, REPLAY_STORM_COUNT, REPLAY_STORM_SEED);
+#endif
+}
+
+/**=============================================
+  * @Fn				- Replay_Record_Start
+  * @brief 			- Starts recording the keys of the keypad
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The previous recording and report are cleared, keys past REPLAY_RECORD_KEYS are not kept
+  */
+void Replay_Record_Start(void){
+	uint32 basepri;
+	NVIC_CRITICAL_ENTER(basepri);
+	Replay_Recorded = 0;
+	Replay_Begin(REPLAY_RECORDING);
+	Replay_Last_Tick = Replay_Start_Tick;
+	NVIC_CRITICAL_EXIT(basepri);
+}
+
+/**=============================================
+  * @Fn				- Replay_Play_Start
+  * @brief 			- Starts replaying a recording in place of the keypad
+  * @param [in] 	- pStream: Recording, kept by the caller until the replay is done
+  * @param [in] 	- length: Bytes of the recording, a multiple of REPLAY_KEY_BYTES
+  * @retval 		- None
+  * Note			- The keypad is ignored until the last key was replayed
+  */
+void Replay_Play_Start(const uint8 *pStream, uint16 length){
+	uint32 basepri;
+	NVIC_CRITICAL_ENTER(basepri);
+	Replay_Source = pStream;
+	Replay_Source_Length = length - (length % REPLAY_KEY_BYTES);
+	Replay_Position = 0;
+	Replay_Begin((0 != Replay_Source_Length) ? REPLAY_PLAYING : REPLAY_IDLE);
+	Replay_Due_Tick = Replay_Start_Tick + ((0 != Replay_Source_Length) ? Replay_Delta(0) : 0);
+	NVIC_CRITICAL_EXIT(basepri);
+}
+
+/**=============================================
+  * @Fn				- Replay_Storm_Start
+  * @brief 			- Starts generating keys in place of the keypad
+  * @param [in] 	- period_ms: Time between two keys, more than 0
+  * @param [in] 	- count: Number of keys
+  * @param [in] 	- seed: Start of the random sequence, not 0
+  * @retval 		- None
+  * Note			- Keys are picked from REPLAY_STORM_KEYS
+  */
+void Replay_Storm_Start(uint16 period_ms, uint16 count, uint32 seed){
+	uint32 basepri;
+	NVIC_CRITICAL_ENTER(basepri);
+	Replay_Storm_Period = period_ms;
+	Replay_Storm_Left = count;
+	Replay_Random = seed;
+	Replay_Begin((0 != count) ? REPLAY_STORM : REPLAY_IDLE);
+	Replay_Due_Tick = Replay_Start_Tick + period_ms;
+	NVIC_CRITICAL_EXIT(basepri);
+}
+
+/**=============================================
+  * @Fn				- Replay_Stop
+  * @brief 			- Ends the session, the keypad is used again
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The recording and report are kept
+  */
+void Replay_Stop(void){
+	Replay_Mode = REPLAY_IDLE;
+}
+
+/**=============================================
+  * @Fn				- Replay_Get_Recording
+  * @brief 			- Returns the last recording
+  * @param [in] 	- None
+  * @param [out] 	- pLength: Bytes of the recording
+  * @retval 		- Recording, can be passed to Replay_Play_Start once the recording stopped
+  * Note			- None
+  */
+const uint8 *Replay_Get_Recording(uint16 *pLength){
+	*pLength = Replay_Recorded;
+	return Replay_Recording;
+}
+
+/**=============================================
+  * @Fn				- Replay_Get_Report
+  * @brief 			- Reads the results of the session
+  * @param [in] 	- None
+  * @param [out] 	- pReport: Pointer to the results
+  * @retval 		- None
+  * Note			- None
+  */
+void Replay_Get_Report(replay_report_t *pReport){
+	uint32 basepri;
+	NVIC_CRITICAL_ENTER(basepri);
+	Replay_Report.mode = Replay_Mode;
+	Replay_Report.latency_max_us = Replay_Latency_Max / (STK_FCPU / 1000000UL);
+	Replay_Report.latency_avg_us = (0 != Replay_Report.handled) ?
+			(uint32)((Replay_Latency_Sum / Replay_Report.handled) / (STK_FCPU / 1000000UL)) : 0;
+	*pReport = Replay_Report;
+	NVIC_CRITICAL_EXIT(basepri);
+}
+
+/**=============================================
+  * @Fn				- Replay_Key
+  * @brief 			- Records the key of the keypad, or replaces it with the replayed key due now
+  * @param [in] 	- key: Key returned by keypad_Scan, F if none or if the keypad was not scanned
+  * @retval 		- Key to be posted, F if none
+  * Note			- To be called from the 1 ms system tick, use the REPLAY_KEY macro
+  */
+uint8 Replay_Key(uint8 key){
+	uint32 now = MCAL_STK_Get_Tick();
+	uint32 delta;
+	if(REPLAY_RECORDING == Replay_Mode){
+		if('F' != key){
+			Replay_Report.keys++;
+			if(sizeof(Replay_Recording) >= ((uint32)Replay_Recorded + REPLAY_KEY_BYTES)){
+				delta = now - Replay_Last_Tick;
+				delta = (REPLAY_DELTA_MAX < delta) ? REPLAY_DELTA_MAX : delta;
+				Replay_Recording[Replay_Recorded] = key;
+				Replay_Recording[Replay_Recorded + 1] = (uint8)delta;
+				Replay_Recording[Replay_Recorded + 2] = (uint8)(delta >> 8);
+				Replay_Recorded += REPLAY_KEY_BYTES;
+			}
+			else{ /* Do Nothing */ }
+			Replay_Last_Tick = now;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(REPLAY_PLAYING == Replay_Mode){
+		key = 'F';
+		if(0 <= (sint32)(now - Replay_Due_Tick)){
+			key = Replay_Source[Replay_Position];
+			Replay_Position += REPLAY_KEY_BYTES;
+			Replay_Report.keys++;
+			if(Replay_Source_Length > Replay_Position){
+				Replay_Due_Tick += Replay_Delta(Replay_Position);
+			}
+			else{
+				Replay_Mode = REPLAY_IDLE;
+			}
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(REPLAY_STORM == Replay_Mode){
+		key = 'F';
+		if(0 <= (sint32)(now - Replay_Due_Tick)){
+			key = Replay_Storm_Next();
+			Replay_Due_Tick += Replay_Storm_Period;
+			Replay_Report.keys++;
+			Replay_Storm_Left--;
+			if(0 == Replay_Storm_Left){
+				Replay_Mode = REPLAY_IDLE;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+	return key;
+}
+
+/**=============================================
+  * @Fn				- Replay_Posted
+  * @brief 			- Timestamps a posted key or counts it as dropped
+  * @param [in] 	- status: Status of Events_Post @ref EVENTS_STATUS_define
+  * @retval 		- None
+  * Note			- To be called right after the key is posted, use the REPLAY_POSTED macro
+  */
+void Replay_Posted(uint8 status){
+	uint8 next = (Replay_Post_Head + 1) & REPLAY_LATENCY_MASK;
+	if(EVENTS_OK != status){
+		Replay_Report.dropped++;
+	}
+	else if(next != Replay_Post_Tail){
+		Replay_Post_Cycles[Replay_Post_Head] = MCAL_STK_Get_Cycles();
+		Replay_Post_Head = next;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Replay_Handled
+  * @brief 			- Measures the latency of the key the main loop just handled
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- To be called by the main loop after the handler of an EVENT_KEY, use the REPLAY_HANDLED macro
+  */
+void Replay_Handled(void){
+	uint32 basepri;
+	uint32 latency;
+	if(Replay_Post_Head != Replay_Post_Tail){
+		latency = MCAL_STK_Get_Cycles() - Replay_Post_Cycles[Replay_Post_Tail];
+		Replay_Post_Tail = (Replay_Post_Tail + 1) & REPLAY_LATENCY_MASK;
+
+		/* The tick updates the counts of the same report */
+		NVIC_CRITICAL_ENTER(basepri);
+		Replay_Latency_Sum += latency;
+		Replay_Latency_Max = (latency > Replay_Latency_Max) ? latency : Replay_Latency_Max;
+		Replay_Report.handled++;
+		Replay_Report.session_ms = MCAL_STK_Get_Tick() - Replay_Start_Tick;
+		NVIC_CRITICAL_EXIT(basepri);
+	}
+	else{ /* Do Nothing */ }
+}
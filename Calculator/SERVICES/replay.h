@@ -0,0 +1,178 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : replay.h 			                         	     	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Platform_Types.h"
+#include "systick_driver.h"
+#include "nvic_driver.h"
+#include "events.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#ifndef REPLAY_ENABLE
+#define REPLAY_ENABLE			0			// 1 records or replays the keys, 0 removes every REPLAY call from the build
+#endif
+#ifndef REPLAY_BOOT_MODE
+#define REPLAY_BOOT_MODE		REPLAY_RECORDING	// Session started by REPLAY_BOOT, REPLAY_RECORDING or REPLAY_STORM @ref REPLAY_MODE_define
+#endif
+#define REPLAY_RECORD_KEYS		128			// Keys kept by a recording, REPLAY_KEY_BYTES each
+/* Keys picked by a key storm, coded like the keypad gives them, 'C' is left out so the mode is not left */
+#define REPLAY_STORM_KEYS		{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, '+', '-', 'x', '/', '='}
+#define REPLAY_STORM_KEY_COUNT	15			// Keys in REPLAY_STORM_KEYS
+#define REPLAY_STORM_PERIOD_MS	20			// Time between two keys of the boot key storm
+#define REPLAY_STORM_COUNT		1000		// Keys of the boot key storm
+#define REPLAY_STORM_SEED		0x2545F491UL	// Same seed, same keys
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref REPLAY_MODE_define
+#define REPLAY_IDLE				0x00U
+#define REPLAY_RECORDING		0x01U		// Keys of the keypad are kept with their time
+#define REPLAY_PLAYING			0x02U		// Keys of a recording take the place of the keypad
+#define REPLAY_STORM			0x03U		// Generated keys at a fixed rate take the place of the keypad
+
+/* A recording is a stream of 3 byte keys: key, then the milliseconds since the previous key (or the start),
+ * little endian, 0xFFFF if longer */
+#define REPLAY_KEY_BYTES		3
+#define REPLAY_LATENCY_KEYS		EVENTS_QUEUE_SIZE	// Keys waiting for the main loop, no more fit in the event queue
+
+#if REPLAY_ENABLE == 1
+#define REPLAY_BOOT()			Replay_Boot()
+#define REPLAY_KEY(_KEY_)		Replay_Key(_KEY_)
+#define REPLAY_POSTED(_STATUS_)	Replay_Posted(_STATUS_)
+#define REPLAY_HANDLED()		Replay_Handled()
+#else
+#define REPLAY_BOOT()
+#define REPLAY_KEY(_KEY_)		(_KEY_)
+#define REPLAY_POSTED(_STATUS_)	(void)(_STATUS_)
+#define REPLAY_HANDLED()
+#endif
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint8  mode;				// @ref REPLAY_MODE_define, REPLAY_IDLE once a replay or storm is done
+	uint16 keys;				// Keys recorded, replayed or generated
+	uint16 dropped;				// Keys lost because the event queue was full
+	uint16 handled;				// Keys the main loop finished handling
+	uint32 latency_max_us;		// Longest time from a key to the end of its handling, the LCD is written by then
+	uint32 latency_avg_us;
+	uint32 session_ms;			// Start of the session to the last handled key
+}replay_report_t;
+
+/*
+ * =============================================
+ * APIs Supported by "replay"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Replay_Boot
+  * @brief 			- Starts the session selected by REPLAY_BOOT_MODE
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Use the REPLAY_BOOT macro so it can be removed from the build
+  */
+void Replay_Boot(void);
+
+/**=============================================
+  * @Fn				- Replay_Record_Start
+  * @brief 			- Starts recording the keys of the keypad
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The previous recording and report are cleared, keys past REPLAY_RECORD_KEYS are not kept
+  */
+void Replay_Record_Start(void);
+
+/**=============================================
+  * @Fn				- Replay_Play_Start
+  * @brief 			- Starts replaying a recording in place of the keypad
+  * @param [in] 	- pStream: Recording, kept by the caller until the replay is done
+  * @param [in] 	- length: Bytes of the recording, a multiple of REPLAY_KEY_BYTES
+  * @retval 		- None
+  * Note			- The keypad is ignored until the last key was replayed
+  */
+void Replay_Play_Start(const uint8 *pStream, uint16 length);
+
+/**=============================================
+  * @Fn				- Replay_Storm_Start
+  * @brief 			- Starts generating keys in place of the keypad
+  * @param [in] 	- period_ms: Time between two keys, more than 0
+  * @param [in] 	- count: Number of keys
+  * @param [in] 	- seed: Start of the random sequence, not 0
+  * @retval 		- None
+  * Note			- Keys are picked from REPLAY_STORM_KEYS
+  */
+void Replay_Storm_Start(uint16 period_ms, uint16 count, uint32 seed);
+
+/**=============================================
+  * @Fn				- Replay_Stop
+  * @brief 			- Ends the session, the keypad is used again
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- The recording and report are kept
+  */
+void Replay_Stop(void);
+
+/**=============================================
+  * @Fn				- Replay_Get_Recording
+  * @brief 			- Returns the last recording
+  * @param [in] 	- None
+  * @param [out] 	- pLength: Bytes of the recording
+  * @retval 		- Recording, can be passed to Replay_Play_Start once the recording stopped
+  * Note			- None
+  */
+const uint8 *Replay_Get_Recording(uint16 *pLength);
+
+/**=============================================
+  * @Fn				- Replay_Get_Report
+  * @brief 			- Reads the results of the session
+  * @param [in] 	- None
+  * @param [out] 	- pReport: Pointer to the results
+  * @retval 		- None
+  * Note			- None
+  */
+void Replay_Get_Report(replay_report_t *pReport);
+
+/**=============================================
+  * @Fn				- Replay_Key
+  * @brief 			- Records the key of the keypad, or replaces it with the replayed key due now
+  * @param [in] 	- key: Key returned by keypad_Scan, F if none or if the keypad was not scanned
+  * @retval 		- Key to be posted, F if none
+  * Note			- To be called from the 1 ms system tick, use the REPLAY_KEY macro
+  */
+uint8 Replay_Key(uint8 key);
+
+/**=============================================
+  * @Fn				- Replay_Posted
+  * @brief 			- Timestamps a posted key or counts it as dropped
+  * @param [in] 	- status: Status of Events_Post @ref EVENTS_STATUS_define
+  * @retval 		- None
+  * Note			- To be called right after the key is posted, use the REPLAY_POSTED macro
+  */
+void Replay_Posted(uint8 status);
+
+/**=============================================
+  * @Fn				- Replay_Handled
+  * @brief 			- Measures the latency of the key the main loop just handled
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- To be called by the main loop after the handler of an EVENT_KEY, use the REPLAY_HANDLED macro
+  */
+void Replay_Handled(void);
+
+#endif /* REPLAY_H_ */
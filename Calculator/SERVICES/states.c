@@ -0,0 +1,166 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : states.c 			                         	     */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "states.h"
+
+/* Keys of the events after the digits, indexed by event - EV_KEY_PLUS */
+static const uint8 HSM_Operation_Keys[hsm_key_events_max - EV_KEY_PLUS] = {'+', '-', 'x', '/', '=', 'C'};
+
+static uint8 HSM_Changed;		// An action or entry hook ran since HSM_Take_Changed
+
+/**=============================================
+  * @Fn				- HSM_Enter
+  * @brief 			- Makes a state the current state and runs its entry hook
+  * @param [in] 	- hsm: State machine
+  * @param [in] 	- state: State to be entered
+  * @retval 		- None
+  * Note			- None
+  */
+static void HSM_Enter(hsm_t *hsm, hsm_state_t state){
+	hsm->current = state;
+	HSM_Changed = 1;
+	TRACE_STATE(hsm->machine->trace_source, state);
+	if(NULL != hsm->machine->states[state].entry){
+		hsm->machine->states[state].entry();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- HSM_Transit
+  * @brief 			- Action of a transition that only changes the state
+  * @param [in] 	- event: Dispatched event
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- None
+  */
+hsm_state_t HSM_Transit(hsm_event_t event){
+	return HSM_TABLE_NEXT;
+}
+
+/**=============================================
+  * @Fn				- HSM_Start
+  * @brief 			- Enters the initial state of a stopped state machine
+  * @param [in] 	- hsm: State machine
+  * @retval 		- None
+  * Note			- Does nothing if the machine is already running
+  */
+void HSM_Start(hsm_t *hsm){
+	if(HSM_NO_STATE == hsm->current){
+		HSM_Enter(hsm, hsm->machine->initial);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- HSM_Resume
+  * @brief 			- Puts a machine back in a state it was in before a warm restart
+  * @param [in] 	- hsm: State machine
+  * @param [in] 	- state: State to be resumed, less than states_num
+  * @retval 		- None
+  * Note			- The entry hook does not run, what it set up is restored by the caller
+  */
+void HSM_Resume(hsm_t *hsm, hsm_state_t state){
+	hsm->current = state;
+	TRACE_STATE(hsm->machine->trace_source, state);
+}
+
+/**=============================================
+  * @Fn				- HSM_Dispatch
+  * @brief 			- Runs the transition of the current state for an event
+  * @param [in] 	- hsm: State machine, started if it is stopped
+  * @param [in] 	- event: Event to be dispatched, less than events_num
+  * @retval 		- None
+  * Note			- One table lookup per level, events a state leaves are looked up in its parent
+  * 				  The action runs in the source state, then the exit hook of the source and the entry hook
+  * 				  of the target run. A transition to the same state runs both hooks, HSM_INTERNAL runs none
+  */
+void HSM_Dispatch(hsm_t *hsm, hsm_event_t event){
+	const hsm_machine_t *machine = hsm->machine;
+	const hsm_transition_t *transition = NULL;
+	hsm_state_t state, target;
+
+	HSM_Start(hsm);
+	state = hsm->current;
+	while(HSM_NO_STATE != state){
+		transition = &machine->table[(state * machine->events_num) + event];
+		if(NULL != transition->action){
+			break;
+		}
+		else{
+			state = machine->states[state].parent;
+		}
+	}
+	if(HSM_NO_STATE == state){
+		/* No state handles the event */
+		return;
+	}
+	else{ /* Do Nothing */ }
+
+	HSM_Changed = 1;
+	target = transition->action(event);
+	target = (HSM_TABLE_NEXT == target) ? transition->next : target;
+	if(HSM_INTERNAL != target){
+		if(NULL != machine->states[hsm->current].exit){
+			machine->states[hsm->current].exit();
+		}
+		else{ /* Do Nothing */ }
+		if(HSM_NO_STATE != target){
+			HSM_Enter(hsm, target);
+		}
+		else{
+			/* Stopped, the initial state is entered again on the next start */
+			hsm->current = HSM_NO_STATE;
+			TRACE_STATE(machine->trace_source, HSM_NO_STATE);
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- HSM_Key_Event
+  * @brief 			- Converts a key of the keypad to an event
+  * @param [in] 	- key: Key returned by keypad_Get_Pressed_Key
+  * @retval 		- Event @ref hsm_key_event_t, hsm_key_events_max if no key is pressed
+  * Note			- None
+  */
+hsm_event_t HSM_Key_Event(uint8 key){
+	hsm_event_t event = EV_KEY_PLUS;
+	if(10 > key){
+		return key;
+	}
+	else{ /* Do Nothing */ }
+	while((hsm_key_events_max != event) && (key != HSM_Operation_Keys[event - EV_KEY_PLUS])){
+		event++;
+	}
+	return event;
+}
+
+/**=============================================
+  * @Fn				- HSM_Event_Key
+  * @brief 			- Converts an event back to the key of the keypad
+  * @param [in] 	- event: Event @ref hsm_key_event_t
+  * @retval 		- Key as returned by keypad_Get_Pressed_Key
+  * Note			- None
+  */
+uint8 HSM_Event_Key(hsm_event_t event){
+	return (EV_KEY_PLUS > event) ? event : HSM_Operation_Keys[event - EV_KEY_PLUS];
+}
+
+/**=============================================
+  * @Fn				- HSM_Take_Changed
+  * @brief 			- Tells if a machine ran an action or entered a state since the last call
+  * @param [in] 	- None
+  * @retval 		- 1 if the working set of the running mode may have changed
+  * Note			- Clears the flag, events no state handles leave it as it is
+  */
+uint8 HSM_Take_Changed(void){
+	uint8 changed = HSM_Changed;
+	HSM_Changed = 0;
+	return changed;
+}
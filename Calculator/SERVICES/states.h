@@ -9,7 +9,145 @@
 #ifndef STATES_H_
 #define STATES_H_
 
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Platform_Types.h"
+#include "trace.h"
+#include <stddef.h>
+
 #define STATE_DEF(_VA_ARGS_)	void ST_##_VA_ARGS_(void)
 #define STATE_CALL(_VA_ARGS_)	ST_##_VA_ARGS_
 
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref HSM_TARGETS_define
+#define HSM_NO_STATE		0xFF	// Parent of a top state, or a machine that is stopped and enters its initial state again
+#define HSM_INTERNAL		0xFE	// Stay in the current state without running exit and entry hooks
+#define HSM_TABLE_NEXT		0xFD	// Returned by an action to take the next state written in the table
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef uint8 hsm_state_t;
+typedef uint8 hsm_event_t;
+
+/* Events of the keypad keys, digits keep their value */
+typedef enum{
+	EV_KEY_0, EV_KEY_1, EV_KEY_2, EV_KEY_3, EV_KEY_4,
+	EV_KEY_5, EV_KEY_6, EV_KEY_7, EV_KEY_8, EV_KEY_9,
+	EV_KEY_PLUS,
+	EV_KEY_MINUS,
+	EV_KEY_MULTIPLY,
+	EV_KEY_DIVIDE,
+	EV_KEY_EQUAL,
+	EV_KEY_CLEAR,
+	hsm_key_events_max
+}hsm_key_event_t;
+
+/* Action of a transition, returns the next state, HSM_TABLE_NEXT or HSM_INTERNAL @ref HSM_TARGETS_define */
+typedef hsm_state_t (*hsm_action_t)(hsm_event_t event);
+
+typedef struct{
+	hsm_action_t action;	// NULL if the state does not handle the event and leaves it to its parent
+	hsm_state_t next;		// Next state, HSM_INTERNAL or HSM_NO_STATE @ref HSM_TARGETS_define
+}hsm_transition_t;
+
+typedef struct{
+	hsm_state_t parent;		// State handling the events this state leaves, HSM_NO_STATE for a top state
+	void (*entry)(void);	// Called after the state is entered, may be NULL
+	void (*exit)(void);		// Called before the state is left, may be NULL
+}hsm_state_info_t;
+
+/* Constant description of a state machine, kept in flash */
+typedef struct{
+	const hsm_transition_t *table;		// states_num rows of events_num transitions
+	const hsm_state_info_t *states;		// Parent and hooks of every state
+	uint8 states_num;
+	uint8 events_num;
+	hsm_state_t initial;
+	uint8 trace_source;					// Source of the state records @ref TRACE_SOURCE_define
+}hsm_machine_t;
+
+/* Running state machine, kept in RAM */
+typedef struct{
+	const hsm_machine_t *machine;
+	hsm_state_t current;				// HSM_NO_STATE until the machine is started
+}hsm_t;
+
+/*
+ * =============================================
+ * APIs Supported by "states"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- HSM_Transit
+  * @brief 			- Action of a transition that only changes the state
+  * @param [in] 	- event: Dispatched event
+  * @retval 		- HSM_TABLE_NEXT
+  * Note			- None
+  */
+hsm_state_t HSM_Transit(hsm_event_t event);
+
+/**=============================================
+  * @Fn				- HSM_Start
+  * @brief 			- Enters the initial state of a stopped state machine
+  * @param [in] 	- hsm: State machine
+  * @retval 		- None
+  * Note			- Does nothing if the machine is already running
+  */
+void HSM_Start(hsm_t *hsm);
+
+/**=============================================
+  * @Fn				- HSM_Resume
+  * @brief 			- Puts a machine back in a state it was in before a warm restart
+  * @param [in] 	- hsm: State machine
+  * @param [in] 	- state: State to be resumed, less than states_num
+  * @retval 		- None
+  * Note			- The entry hook does not run, what it set up is restored by the caller
+  */
+void HSM_Resume(hsm_t *hsm, hsm_state_t state);
+
+/**=============================================
+  * @Fn				- HSM_Dispatch
+  * @brief 			- Runs the transition of the current state for an event
+  * @param [in] 	- hsm: State machine, started if it is stopped
+  * @param [in] 	- event: Event to be dispatched, less than events_num
+  * @retval 		- None
+  * Note			- One table lookup per level, events a state leaves are looked up in its parent
+  * 				  The action runs in the source state, then the exit hook of the source and the entry hook
+  * 				  of the target run. A transition to the same state runs both hooks, HSM_INTERNAL runs none
+  */
+void HSM_Dispatch(hsm_t *hsm, hsm_event_t event);
+
+/**=============================================
+  * @Fn				- HSM_Key_Event
+  * @brief 			- Converts a key of the keypad to an event
+  * @param [in] 	- key: Key returned by keypad_Get_Pressed_Key
+  * @retval 		- Event @ref hsm_key_event_t, hsm_key_events_max if no key is pressed
+  * Note			- None
+  */
+hsm_event_t HSM_Key_Event(uint8 key);
+
+/**=============================================
+  * @Fn				- HSM_Event_Key
+  * @brief 			- Converts an event back to the key of the keypad
+  * @param [in] 	- event: Event @ref hsm_key_event_t
+  * @retval 		- Key as returned by keypad_Get_Pressed_Key
+  * Note			- None
+  */
+uint8 HSM_Event_Key(hsm_event_t event);
+
+/**=============================================
+  * @Fn				- HSM_Take_Changed
+  * @brief 			- Tells if a machine ran an action or entered a state since the last call
+  * @param [in] 	- None
+  * @retval 		- 1 if the working set of the running mode may have changed
+  * Note			- Clears the flag, events no state handles leave it as it is
+  */
+uint8 HSM_Take_Changed(void);
+
 #endif /* STATES_H_ */
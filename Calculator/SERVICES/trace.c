@@ -0,0 +1,122 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : trace.c 			                         	     	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "trace.h"
+
+#define TRACE_BUFFER_MASK	(TRACE_BUFFER_RECORDS - 1)
+
+/* Records from Trace_Tail are sent, the first Trace_Sending of them are being sent now */
+static trace_record_t Trace_Buffer[TRACE_BUFFER_RECORDS];
+static uint16 Trace_Head;
+static uint16 Trace_Tail;
+static uint16 Trace_Count;
+static uint16 Trace_Sending;
+static uint16 Trace_Lost;
+
+static void Trace_Drain(void);
+
+/**=============================================
+  * @Fn				- Trace_Sent
+  * @brief 			- Frees the sent records and sends the next ones
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Called from the UART interrupt
+  */
+static void Trace_Sent(void){
+	Trace_Tail = (Trace_Tail + Trace_Sending) & TRACE_BUFFER_MASK;
+	Trace_Count -= Trace_Sending;
+	Trace_Sending = 0;
+	Trace_Drain();
+}
+
+/**=============================================
+  * @Fn				- Trace_Drain
+  * @brief 			- Sends the records up to the end of the buffer if the UART is free
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- Records are sent straight from the buffer, the rest follow when they are sent
+  */
+static void Trace_Drain(void){
+	uint16 records;
+	if((0 == Trace_Sending) && (0 != Trace_Count)){
+		records = TRACE_BUFFER_RECORDS - Trace_Tail;
+		records = (Trace_Count < records) ? Trace_Count : records;
+		if(UART_OK == MCAL_UART_Send_Async((const uint8*)&Trace_Buffer[Trace_Tail], records * sizeof(trace_record_t), Trace_Sent)){
+			Trace_Sending = records;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Trace_Put
+  * @brief 			- Writes a record at the head of the buffer
+  * @param [in] 	- id: Record id @ref TRACE_ID_define
+  * @param [in] 	- arg: Argument of the record
+  * @param [in] 	- time_ms: System tick of the record
+  * @retval 		- None
+  * Note			- Must be called inside a critical section and the buffer must have room
+  */
+static void Trace_Put(uint8 id, uint16 arg, uint32 time_ms){
+	trace_record_t *pRecord = &Trace_Buffer[Trace_Head];
+	pRecord->sync = TRACE_SYNC;
+	pRecord->id = id;
+	pRecord->arg = arg;
+	pRecord->time_ms = time_ms;
+	Trace_Head = (Trace_Head + 1) & TRACE_BUFFER_MASK;
+	Trace_Count++;
+}
+
+/**=============================================
+  * @Fn				- Trace_Init
+  * @brief 			- Initializes the UART the records are sent over and records the boot
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void Trace_Init(void){
+	UART_config_t uart_cfg;
+	uart_cfg.baud_rate = TRACE_BAUD_RATE;
+	uart_cfg.stop_bits = UART_STOP_BITS_1;
+	/* Checked against UART_BAUD_MAX when built */
+	(void)MCAL_UART_Init(&uart_cfg);
+	TRACE(TRACE_ID_BOOT, 0);
+}
+
+/**=============================================
+  * @Fn				- Trace_Record
+  * @brief 			- Adds a record to the RAM buffer, the UART sends it in the background
+  * @param [in] 	- id: Record id @ref TRACE_ID_define
+  * @param [in] 	- arg: Argument of the record
+  * @retval 		- None
+  * Note			- May be called from an interrupt below priority 0, use the TRACE macro so it can be removed from the build
+  * 				  If the buffer is full the record is dropped, a TRACE_ID_LOST record tells how many were dropped
+  */
+void Trace_Record(uint8 id, uint16 arg){
+	uint32 basepri;
+	uint32 time_ms = MCAL_STK_Get_Tick();
+	NVIC_CRITICAL_ENTER(basepri);
+	if((0 != Trace_Lost) && ((TRACE_BUFFER_RECORDS - 1) > Trace_Count)){
+		/* Room for the lost record and this one */
+		Trace_Put(TRACE_ID_LOST, Trace_Lost, time_ms);
+		Trace_Lost = 0;
+	}
+	else{ /* Do Nothing */ }
+
+	if((0 == Trace_Lost) && (TRACE_BUFFER_RECORDS > Trace_Count)){
+		Trace_Put(id, arg, time_ms);
+		Trace_Drain();
+	}
+	else if(0xFFFF != Trace_Lost){
+		Trace_Lost++;
+	}
+	else{ /* Do Nothing */ }
+	NVIC_CRITICAL_EXIT(basepri);
+}
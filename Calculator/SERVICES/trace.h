@@ -0,0 +1,100 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Calculator  	                             			 */
+/* File          : trace.h 			                         	     	 */
+/* Date          : Oct 19, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef TRACE_H_
+#define TRACE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Platform_Types.h"
+#include "systick_driver.h"
+#include "uart_driver.h"
+#include "nvic_driver.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE			1			// 0 removes every TRACE call from the build
+#endif
+#define TRACE_BUFFER_RECORDS	64			// Power of two, 8 bytes each
+#define TRACE_BAUD_RATE			115200UL
+
+#if TRACE_BAUD_RATE > UART_BAUD_MAX
+#error "TRACE_BAUD_RATE is above UART_BAUD_MAX, MCAL_UART_Init would refuse it"
+#endif
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define TRACE_SYNC				0xA5U		// First byte of every record, lets the decoder find the record boundaries
+
+// @ref TRACE_ID_define
+/* The host decoder keeps the text of the records, the argument of each record is described here */
+#define TRACE_ID_BOOT			0x01U		// "boot", arg: 0
+#define TRACE_ID_KEY			0x02U		// "key %k", arg: key as returned by keypad_Scan
+#define TRACE_ID_STATE			0x03U		// "%s state %u", arg: source @ref TRACE_SOURCE_define << 8 | state, 0xFF if stopped
+#define TRACE_ID_MODE			0x04U		// "mode %u selected", arg: mode @ref user_selection_t
+#define TRACE_ID_LOST			0x05U		// "%u records lost", arg: records dropped before this one
+#define TRACE_ID_STACK			0x06U		// "stack past its limit, %u bytes used", arg: stack bytes in use
+#define TRACE_ID_RESUME			0x07U		// "resumed in %u ms", arg: milliseconds from reset to the restored screen
+
+// @ref TRACE_SOURCE_define
+#define TRACE_SRC_MAIN			0x00U
+#define TRACE_SRC_CALCULATOR	0x01U
+#define TRACE_SRC_NUMBERING		0x02U
+#define TRACE_SRC_STATISTICS	0x03U
+#define TRACE_SRC_NUMBER_THEORY	0x04U
+
+#if TRACE_ENABLE == 1
+#define TRACE(_ID_, _ARG_)		Trace_Record((_ID_), (_ARG_))
+#else
+#define TRACE(_ID_, _ARG_)
+#endif
+#define TRACE_STATE(_SRC_, _STATE_)	TRACE(TRACE_ID_STATE, (((uint16)(_SRC_)) << 8) | (_STATE_))
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+
+/* Sent as it is kept in RAM, little endian */
+typedef struct{
+	uint8  sync;		// TRACE_SYNC
+	uint8  id;			// @ref TRACE_ID_define
+	uint16 arg;
+	uint32 time_ms;		// System tick when the record was taken
+}trace_record_t;
+
+/*
+ * =============================================
+ * APIs Supported by "trace"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Trace_Init
+  * @brief 			- Initializes the UART the records are sent over and records the boot
+  * @param [in] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void Trace_Init(void);
+
+/**=============================================
+  * @Fn				- Trace_Record
+  * @brief 			- Adds a record to the RAM buffer, the UART sends it in the background
+  * @param [in] 	- id: Record id @ref TRACE_ID_define
+  * @param [in] 	- arg: Argument of the record
+  * @retval 		- None
+  * Note			- May be called from an interrupt below priority 0, use the TRACE macro so it can be removed from the build
+  * 				  If the buffer is full the record is dropped, a TRACE_ID_LOST record tells how many were dropped
+  */
+void Trace_Record(uint8 id, uint16 arg);
+
+#endif /* TRACE_H_ */
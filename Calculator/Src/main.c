@@ -13,16 +13,449 @@ static void (*pfMain_State_Handler)(void) = NULL;
 static void (*pfMain_User_Selection)(void) = NULL;
 static main_states_t main_state_id;
 static user_selection_t user_selection_flag = USER_UNDEFINED;
+static uint8 main_scan_count; // Milliseconds since the last keypad scan
+static uint8 main_release_scans; // Scans keypad_Scan still needs to release the last key after the keypad went idle
+static uint32 main_mode_record; // Address of the last saved mode record, 0 if there is none
+static main_boot_time_t main_boot_time;
+static uint8 main_boot_screen_shown; // 1 once the first screen that takes keys was shown
+static main_retained_t main_retained SECTION_NOINIT;
+static main_retain_stats_t main_retain_stats;
+static uint32 main_build_hash; // FNV-1a of MAIN_BUILD_STAMP, seeds the checksum of the retained record
+#if REPLAY_ENABLE == 1
+static main_retained_t main_replay_start; // Mode, state and LCD the recording started from, magic and checksum are not used
+static uint8 main_replay_arena[ARENA_SIZE]; // Working set the recording started with
+#endif
+#if LATENCY_ENABLE == 1
+static uint8 main_latency_class; // Class of keys shown by MAIN_DIAGNOSTICS @ref LATENCY_CLASS_define
+
+/* Names of the classes of keys, indexed by @ref LATENCY_CLASS_define */
+static const char *const main_latency_names[LATENCY_CLASSES] = {"Dig", "Op", "=", "C"};
+
+/* Bars of 1 to 8 rows, one per bin of the histogram */
+static const uint8 main_bar_glyphs[LCD_GLYPH_ROWS][LCD_GLYPH_ROWS] = {
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F},
+		{0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F},
+		{0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F},
+		{0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F},
+		{0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F},
+		{0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F},
+		{0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}
+};
+#endif
+
+/* Runs every millisecond from the system tick, kept in SRAM, what it calls stays in flash */
+static void main_tick(void) SECTION_RAMFUNC;
+static void main_retain_save(void);
 
 int main(void)
 {
 	/* Initial state is MAIN_INIT */
 	pfMain_State_Handler = STATE_CALL(MAIN_INIT);
 	pfMain_User_Selection = STATE_CALL(MAIN_SELECTION);
+	Events_Post(EVENT_CONTINUE, 0);
 	while(1){
-		pfMain_State_Handler();
+		/* Sleep until something happens, then pass it to the current state */
+		Events_Wait();
+		if(EVENT_SERIAL == Events_Current()->type){
+			/* Serial requests are answered whatever the mode */
+			Console_Process();
+		}
+		else if(EVENT_KEY == Events_Current()->type){
+			LATENCY_KEY_START(Events_Key());
+			pfMain_State_Handler();
+			REPLAY_HANDLED();
+		}
+		else{
+			pfMain_State_Handler();
+		}
+		LATENCY_EVENT_DONE();
+		main_retain_save();
+	}
+}
+
+/**=============================================
+  * @Fn				- main_tick
+  * @brief 			- Called by the 1 ms system tick, checks the stack, counts the event timers and scans the keypad
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Runs in interrupt context, a newly pressed key is posted as EVENT_KEY
+  * 				  While keys are replayed they take the place of the keypad
+  * 				  keypad_Scan only runs while a key is down and for the scans it needs to release it
+  */
+static void main_tick(void){
+	uint8 key = 'F';
+	uint8 status;
+	uint8 down;
+	MEM_STACK_CHECK();
+	Events_Tick();
+	main_scan_count++;
+	if(KEYPAD_SCAN_PERIOD_MS <= main_scan_count){
+		main_scan_count = 0;
+		KEYPAD_ANY_DOWN(down);
+		if(1 == down){
+			main_release_scans = KEYPAD_RELEASE_SCANS;
+			key = keypad_Scan();
+		}
+		else if(0 != main_release_scans){
+			main_release_scans--;
+			key = keypad_Scan();
+		}
+		else{ /* Do Nothing, the keypad is idle and the last key was released */ }
+	}
+	else{ /* Do Nothing */ }
+
+	key = REPLAY_KEY(key);
+	if('F' != key){
+		status = Events_Post(EVENT_KEY, key);
+		REPLAY_POSTED(status);
+		LATENCY_KEY_DOWN(status);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- main_set_state
+  * @brief 			- Keeps the id of the running main state and traces state changes
+  * @param [in] 	- state: Running state @ref main_states_t
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void main_set_state(main_states_t state){
+	if(state != main_state_id){
+		TRACE_STATE(TRACE_SRC_MAIN, state);
+	}
+	else{ /* Do Nothing */ }
+	main_state_id = state;
+}
+
+/**=============================================
+  * @Fn				- main_load_mode
+  * @brief 			- Reads the mode saved in the settings page of the flash memory
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Saved mode @ref user_selection_t, USER_UNDEFINED if there is none
+  * Note			- Records are appended to the page, the last programmed one is the current one
+  */
+static user_selection_t main_load_mode(void){
+	uint32 address = MAIN_SETTINGS_PAGE;
+	uint16 record;
+	main_mode_record = 0;
+	while((address < (MAIN_SETTINGS_PAGE + FLASH_PAGE_SIZE)) && (FLASH_ERASED_HALF_WORD != *((const vuint16_t*)address))){
+		main_mode_record = address;
+		address += 2;
+	}
+	if(0 == main_mode_record){
+		return USER_UNDEFINED;
+	}
+	else{ /* Do Nothing */ }
+	record = *((const vuint16_t*)main_mode_record);
+	if((MAIN_MODE_RECORD_TAG == (record & MAIN_MODE_RECORD_MASK)) &&
+			(USER_CALCULATOR <= (record & 0xFF)) && (USER_NUMBER_THEORY >= (record & 0xFF))){
+		return (record & 0xFF);
+	}
+	else{
+		return USER_UNDEFINED;
+	}
+}
+
+/**=============================================
+  * @Fn				- main_save_mode
+  * @brief 			- Saves the selected mode in the settings page of the flash memory
+  * @param [in] 	- mode: Selected mode @ref user_selection_t
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Nothing is written if the mode did not change, the page is erased only once it is full
+  */
+static void main_save_mode(user_selection_t mode){
+	uint16 record = MAIN_MODE_RECORD_TAG | mode;
+	uint32 address = (0 == main_mode_record) ? MAIN_SETTINGS_PAGE : (main_mode_record + 2);
+	if((0 != main_mode_record) && (record == *((const vuint16_t*)main_mode_record))){
+		return;
+	}
+	else{ /* Do Nothing */ }
+
+	MCAL_FLASH_Unlock();
+	if(((MAIN_SETTINGS_PAGE + FLASH_PAGE_SIZE) <= address) || (FLASH_OK != MCAL_FLASH_Write_Half_Word(address, record))){
+		/* Page is full or holds something else, start it again */
+		address = MAIN_SETTINGS_PAGE;
+		if((FLASH_OK != MCAL_FLASH_Erase_Page(MAIN_SETTINGS_PAGE)) || (FLASH_OK != MCAL_FLASH_Write_Half_Word(address, record))){
+			address = 0;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+	MCAL_FLASH_Lock();
+	main_mode_record = address;
+}
+
+/**=============================================
+  * @Fn				- main_start_mode
+  * @brief 			- Passes control to a mode
+  * @param [in] 	- mode: Mode to be started @ref user_selection_t
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+static void main_start_mode(user_selection_t mode){
+	TRACE(TRACE_ID_MODE, mode);
+	user_selection_flag = mode;
+	LCD_Send_Command(LCD_CLEAR_DISPLAY);
+	pfMain_State_Handler = STATE_CALL(MAIN_RUNNING);
+	/* Let the selected mode show its first screen */
+	Events_Post(EVENT_CONTINUE, 0);
+}
+
+/**=============================================
+  * @Fn				- main_boot_screen_done
+  * @brief 			- Takes the boot time at the first screen that takes keys
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Only the first call after reset counts
+  */
+static void main_boot_screen_done(void){
+	if(0 == main_boot_screen_shown){
+		main_boot_screen_shown = 1;
+		main_boot_time.first_screen_ms = MCAL_STK_Get_Tick();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- main_retain_hash
+  * @brief 			- Adds bytes to an FNV-1a hash
+  * @param [in] 	- hash: Hash of the bytes before
+  * @param [in] 	- pBytes: Bytes to be added
+  * @param [in] 	- length: Number of bytes
+  * @retval 		- Hash with the bytes added
+  * Note			- None
+  */
+static uint32 main_retain_hash(uint32 hash, const uint8 *pBytes, uint16 length){
+	uint16 index;
+	for(index = 0; index < length; index++){
+		hash = (hash ^ pBytes[index]) * 16777619UL;
+	}
+	return hash;
+}
+
+/**=============================================
+  * @Fn				- main_retain_checksum
+  * @brief 			- Calculates the checksum of the retained record and the arena
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Checksum, FNV-1a over the bytes, started from the hash of the build stamp
+  * Note			- A record written by another build never matches
+  */
+static uint32 main_retain_checksum(void){
+	uint32 hash = main_retain_hash(main_build_hash, (const uint8*)&main_retained, offsetof(main_retained_t, checksum));
+	return main_retain_hash(hash, Arena_Get_Memory(), ARENA_SIZE);
+}
+
+/**=============================================
+  * @Fn				- main_get_running
+  * @brief 			- Reads the running mode and the state of its machine
+  * @param [in] 	- None
+  * @param [out] 	- pMode: Running mode @ref user_selection_t, USER_UNDEFINED if no mode is running
+  * @retval 		- State of the calculator or numbering machine, HSM_NO_STATE for the other modes
+  * Note			- None
+  */
+static hsm_state_t main_get_running(user_selection_t *pMode){
+	hsm_state_t state = HSM_NO_STATE;
+	*pMode = USER_UNDEFINED;
+	if(STATE_CALL(MAIN_RUNNING) == pfMain_State_Handler){
+		*pMode = user_selection_flag;
+		if(USER_CALCULATOR == user_selection_flag){
+			state = Calculator_Get_State();
+		}
+		else if(USER_NUMBERING == user_selection_flag){
+			state = Numbering_Get_State();
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+	return state;
+}
+
+/**=============================================
+  * @Fn				- main_retain_save
+  * @brief 			- Saves the running mode, its state and the LCD in the retained record
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called after every event, the working set of the mode is already in the arena
+  * 				  Only written if the mode or its state changed, or an action of its machine ran or the LCD
+  * 				  changed while a mode with a working set runs. The time taken is kept in main_retain_stats
+  */
+static void main_retain_save(void){
+	user_selection_t mode;
+	hsm_state_t state = main_get_running(&mode);
+	uint32 start;
+	uint8 changed;
+
+	/* Both flags are taken, so each one covers the events since the last save */
+	changed = HSM_Take_Changed();
+	changed |= LCD_Take_Changed();
+	if((mode == main_retained.mode) && (state == main_retained.mode_state) &&
+			((MAIN_RETAIN_MAGIC ^ main_build_hash) == main_retained.magic) && ((HSM_NO_STATE == state) || (0 == changed))){
+		main_retain_stats.skipped++;
+		return;
+	}
+	else{ /* Do Nothing */ }
+	start = MCAL_STK_Get_Cycles();
+	main_retained.magic = MAIN_RETAIN_MAGIC ^ main_build_hash;
+	main_retained.mode = mode;
+	main_retained.mode_state = state;
+	LCD_Get_State(&main_retained.lcd);
+	main_retained.checksum = main_retain_checksum();
+	main_retain_stats.last_cycles = MCAL_STK_Get_Cycles() - start;
+	main_retain_stats.max_cycles = (main_retain_stats.last_cycles > main_retain_stats.max_cycles) ?
+			main_retain_stats.last_cycles : main_retain_stats.max_cycles;
+	main_retain_stats.saves++;
+}
+
+/**=============================================
+  * @Fn				- main_retain_valid
+  * @brief 			- Checks if the retained record survived the reset
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- 1 if a mode can be resumed, 0 after a cold boot
+  * Note			- Only a watchdog, power down or brown-out reset resumes @ref MAIN_RESUME_RESETS,
+  * 				  the reset button and a software reset start cold
+  */
+static uint8 main_retain_valid(void){
+	uint8 mode = main_retained.mode;
+	uint8 state = main_retained.mode_state;
+	if(0 == (main_retain_stats.reset_flags & MAIN_RESUME_RESETS)){
+		return 0;
+	}
+	else if(((MAIN_RETAIN_MAGIC ^ main_build_hash) != main_retained.magic) || (main_retain_checksum() != main_retained.checksum) ||
+			(USER_CALCULATOR > mode) || (USER_NUMBER_THEORY < mode)){
+		return 0;
+	}
+	else if(HSM_NO_STATE == state){
+		return 1;
+	}
+	else if(USER_CALCULATOR == mode){
+		return (calculator_states_max > state) ? 1 : 0;
+	}
+	else if(USER_NUMBERING == mode){
+		return (numbering_states_max > state) ? 1 : 0;
+	}
+	else{
+		return 0;
+	}
+}
+
+/**=============================================
+  * @Fn				- main_resume
+  * @brief 			- Runs the mode of a record again
+  * @param [in] 	- pRecord: Mode, state and LCD to be resumed, the working set is already in the arena
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Calculator and numbering get their working set and screen back, the other modes start again
+  * 				  The LCD must be blank, after LCD_Init or a clear
+  */
+static void main_resume(const main_retained_t *pRecord){
+	user_selection_t mode = pRecord->mode;
+	hsm_state_t state = pRecord->mode_state;
+	if(HSM_NO_STATE != state){
+		LCD_Restore_State(&pRecord->lcd);
+		if(USER_CALCULATOR == mode){
+			Calculator_Resume(state);
+		}
+		else{
+			Numbering_Resume(state);
+		}
+		user_selection_flag = mode;
+		pfMain_State_Handler = STATE_CALL(MAIN_RUNNING);
+	}
+	else{
+		main_start_mode(mode);
+	}
+}
+
+#if REPLAY_ENABLE == 1
+/**=============================================
+  * @Fn				- main_replay_mark
+  * @brief 			- Keeps the mode, its state, the LCD and the arena the recording starts from
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Called once MAIN_INIT chose between the modes screen, the last used mode and a warm restart
+  */
+static void main_replay_mark(void){
+	user_selection_t mode;
+	main_replay_start.mode_state = main_get_running(&mode);
+	main_replay_start.mode = mode;
+	LCD_Get_State(&main_replay_start.lcd);
+	memcpy(main_replay_arena, Arena_Get_Memory(), ARENA_SIZE);
+}
 
+/**=============================================
+  * @Fn				- main_replay_play
+  * @brief 			- Goes back to the mode and state the recording started from and replays the recording
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- To be called from the main loop, the running mode is left as if 'C' was pressed twice
+  */
+void main_replay_play(void){
+	const uint8 *pRecording;
+	uint16 length;
+	Replay_Stop();
+	Calculator_Stop();
+	Numbering_Stop();
+	Statistics_Stop();
+	Number_Theory_Stop();
+	USER_RESET_FLAG = 0;
+	Arena_Reset();
+	Events_Timer_Stop();
+	Events_Display_Hold(0);
+	LCD_Send_Command(LCD_CLEAR_DISPLAY);
+	/* The welcome screen is shown again if the recording started on it */
+	main_state_id = MAIN_INIT;
+	if(USER_UNDEFINED == main_replay_start.mode){
+		pfMain_State_Handler = STATE_CALL(MAIN_SELECTION);
+		Events_Post(EVENT_CONTINUE, 0);
+	}
+	else{
+		if(HSM_NO_STATE != main_replay_start.mode_state){
+			/* The mode takes its working set back from the arena */
+			memcpy(Arena_Resume(ARENA_SIZE), main_replay_arena, ARENA_SIZE);
+		}
+		else{ /* Do Nothing */ }
+		main_resume(&main_replay_start);
 	}
+	pRecording = Replay_Get_Recording(&length);
+	Replay_Play_Start(pRecording, length);
+}
+#endif
+
+/**=============================================
+  * @Fn				- main_get_boot_time
+  * @brief 			- Reads how long the last boot took
+  * @param [in] 	- None
+  * @param [out] 	- pBoot: Pointer to the boot times
+  * @retval 		- None
+  * Note			- Times are counted from the start of the system tick in MAIN_INIT
+  */
+void main_get_boot_time(main_boot_time_t *pBoot){
+	*pBoot = main_boot_time;
+}
+
+/**=============================================
+  * @Fn				- main_get_retain_stats
+  * @brief 			- Reads how often and how long the retained record was saved
+  * @param [in] 	- None
+  * @param [out] 	- pStats: Pointer to the statistics
+  * @retval 		- None
+  * Note			- None
+  */
+void main_get_retain_stats(main_retain_stats_t *pStats){
+	*pStats = main_retain_stats;
 }
 
 /**=============================================
@@ -45,24 +478,64 @@ void clock_init(){
   * @param [out] 	- None
   * @retval 		- None
   * Note			- This function will be called in MAIN_INIT state
+  * 				- The last used mode is started at once, the welcome screen is only shown if there is none
+  * 				- After a warm restart the running mode and its screen are restored instead
   */
 STATE_DEF(MAIN_INIT){
+	user_selection_t saved_mode;
+	uint8 resume;
+
 	/* State Name */
 	main_state_id = MAIN_INIT;
 
 	/* State Action */
-	/* Initialize peripherals */
+	/* Initialize peripherals, everything before LCD_Init runs during the LCD power on time */
+	MCAL_VECT_Init();
+	MCAL_NVIC_Set_Priority_Grouping(NVIC_PRIGROUP_16_PREEMPT);
+	MCAL_NVIC_Set_System_Priority(NVIC_SYSTEM_SYSTICK, MAIN_TICK_PRIORITY, 0);
+	MCAL_NVIC_Set_Priority(DMA1_CHANNEL2_IRQ, MAIN_UART_PRIORITY, 0);
+	MCAL_NVIC_Set_Priority(DMA1_CHANNEL3_IRQ, MAIN_UART_PRIORITY, 0);
+	MCAL_NVIC_Set_Priority(USART3_IRQ, MAIN_UART_PRIORITY, 0);
 	clock_init();
-	LCD_Init();
+	MCAL_STK_Tick_Init();
+	Trace_Init();
+#if CONSOLE_ENABLE == 1
+	Console_Init();
+#endif
 	keypad_init();
+	MCAL_STK_SetCallback(main_tick);
+	REPLAY_BOOT();
+	/* Keys are queued from now on */
+	main_boot_time.first_key_ms = MCAL_STK_Get_Tick();
+	main_retain_stats.reset_flags = RCC->CSR;
+	RCC->CSR |= RCC_CSR_RMVF;
+	main_build_hash = main_retain_hash(2166136261UL, (const uint8*)MAIN_BUILD_STAMP, sizeof(MAIN_BUILD_STAMP) - 1);
+	resume = main_retain_valid();
+	saved_mode = main_load_mode();
+	LCD_Init();
 
 	/* State transition */
-	pfMain_State_Handler = STATE_CALL(MAIN_SELECTION);
+	if(1 == resume){
+		/* Warm restart, the mode goes on where it was */
+		main_resume(&main_retained);
+		main_boot_time.resume_ms = MCAL_STK_Get_Tick();
+		TRACE(TRACE_ID_RESUME, (uint16)main_boot_time.resume_ms);
+	}
+	else if(USER_UNDEFINED != saved_mode){
+		main_start_mode(saved_mode);
+	}
+	else{
+		pfMain_State_Handler = STATE_CALL(MAIN_SELECTION);
+		Events_Post(EVENT_CONTINUE, 0);
+	}
+#if REPLAY_ENABLE == 1
+	main_replay_mark();
+#endif
 }
 
 /**=============================================
   * @Fn				- MAIN_SELECTION
-  * @brief 			- This function asks the user to choose between calculator mode and numbering systems mode
+  * @brief 			- This function shows the welcome screen, then asks the user to choose between calculator, numbering systems, statistics and number theory modes
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
@@ -70,35 +543,66 @@ STATE_DEF(MAIN_INIT){
   */
 STATE_DEF(MAIN_SELECTION){
 	/* State Name */
-	main_state_id = MAIN_SELECTION;
-
-	/* State Action */
-	/* Ask the user to check between calculator mode and numbering system mode */
-	uint8 pressed_key = 0;
-	LCD_Send_Command(LCD_CLEAR_DISPLAY);
-	LCD_Send_string_Pos((uint8*)"<<Calculator>>", LCD_FIRST_ROW, 2);
-	LCD_Send_string_Pos((uint8*)"Select calc mode", LCD_SECOND_ROW, 0);
-	MCAL_STK_Delay1ms(2500);
-	LCD_Send_Command(LCD_CLEAR_DISPLAY);
-	LCD_Send_string_Pos((uint8*)"1:Calculator", LCD_FIRST_ROW, 1);
-	LCD_Send_string_Pos((uint8*)"2:Numbering Mode", LCD_SECOND_ROW, 1);
+	if(MAIN_SELECTION != main_state_id){
+		main_set_state(MAIN_SELECTION);
+		LCD_Send_Command(LCD_CLEAR_DISPLAY);
+		LCD_Send_string_Pos((uint8*)"<<Calculator>>", LCD_FIRST_ROW, 2);
+		LCD_Send_string_Pos((uint8*)"Select calc mode", LCD_SECOND_ROW, 1);
+		Events_Display_Hold(MAIN_SPLASH_MS);
+		return;
+	}
+	else{ /* Do Nothing */ }
 
 	/* Event Check */
-	/* POLL untill user presses 1 or 2 */
-	while((1 != pressed_key) && (2 != pressed_key)){
-		pressed_key = keypad_Get_Pressed_Key();
+	uint8 pressed_key = Events_Key();
+	if((USER_CALCULATOR <= pressed_key) && (USER_NUMBER_THEORY >= pressed_key)){
+		/* A mode key skips the welcome screen and selects the mode */
+		Events_Display_Hold(0);
+		main_save_mode(pressed_key);
+		main_start_mode(pressed_key);
 	}
+	else if(('F' != pressed_key) || (EVENT_DISPLAY_DONE == Events_Current()->type)){
+		/* Show the modes once the welcome screen was shown long enough, any other key skips it */
+		Events_Display_Hold(0);
+		LCD_Send_Command(LCD_CLEAR_DISPLAY);
+		LCD_Send_string_Pos((uint8*)"1:Calc 2:Number", LCD_FIRST_ROW, 1);
+		LCD_Send_string_Pos((uint8*)"3:Stats 4:NumThy", LCD_SECOND_ROW, 1);
+		main_boot_screen_done();
+		pfMain_State_Handler = STATE_CALL(MAIN_MENU);
+	}
+	else{ /* Do Nothing */ }
+}
 
-	user_selection_flag = pressed_key;
-
-	LCD_Send_Command(LCD_CLEAR_DISPLAY);
+/**=============================================
+  * @Fn				- MAIN_MENU
+  * @brief 			- This function waits for the user to press 1, 2, 3 or 4 to select a mode
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in MAIN_MENU state
+  */
+STATE_DEF(MAIN_MENU){
+	/* State Name */
+	main_set_state(MAIN_MENU);
 
-	pfMain_State_Handler = STATE_CALL(MAIN_RUNNING);
+	/* Event Check */
+	uint8 pressed_key = Events_Key();
+	if((USER_CALCULATOR <= pressed_key) && (USER_NUMBER_THEORY >= pressed_key)){
+		main_save_mode(pressed_key);
+		main_start_mode(pressed_key);
+	}
+#if LATENCY_ENABLE == 1
+	else if(MAIN_DIAGNOSTICS_KEY == pressed_key){
+		pfMain_State_Handler = STATE_CALL(MAIN_DIAGNOSTICS);
+		Events_Post(EVENT_CONTINUE, 0);
+	}
+#endif
+	else{ /* Do Nothing */ }
 }
 
 /**=============================================
   * @Fn				- MAIN_RUNNING
-  * @brief 			- This function will pass control to either calculator mode or numbering system mode
+  * @brief 			- This function will pass control to calculator, numbering system, statistics or number theory mode
   * @param [in] 	- None
   * @param [out] 	- None
   * @retval 		- None
@@ -106,7 +610,7 @@ STATE_DEF(MAIN_SELECTION){
   */
 STATE_DEF(MAIN_RUNNING){
 	/* State Name */
-	main_state_id = MAIN_RUNNING;
+	main_set_state(MAIN_RUNNING);
 
 	/* State Action */
 	if(USER_CALCULATOR == user_selection_flag){
@@ -115,14 +619,118 @@ STATE_DEF(MAIN_RUNNING){
 	else if(USER_NUMBERING == user_selection_flag){
 		pf_Numbering_State_Handler();
 	}
+	else if(USER_STATISTICS == user_selection_flag){
+		pfStatistics_State_Handler();
+	}
+	else if(USER_NUMBER_THEORY == user_selection_flag){
+		pfNumber_Theory_State_Handler();
+	}
 	else{
 		pfMain_State_Handler = STATE_CALL(MAIN_SELECTION);
+		Events_Post(EVENT_CONTINUE, 0);
 	}
+	main_boot_screen_done();
 
 	/* Event Check */
 	/* If user wants to reset, go back to selection state */
 	if(1 == USER_RESET_FLAG){
 		USER_RESET_FLAG = 0;
+		/* Working sets of the mode are freed, the next mode starts with the whole arena */
+		Arena_Reset();
+		Events_Timer_Stop();
+		pfMain_State_Handler = STATE_CALL(MAIN_SELECTION);
+		Events_Post(EVENT_CONTINUE, 0);
+	}
+}
+
+#if LATENCY_ENABLE == 1
+/**=============================================
+  * @Fn				- main_show_latency
+  * @brief 			- Draws the latency histogram of the selected class of keys
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- First row: class, keys measured and the slowest one in ms, second row: one bar per bin
+  * 				  Only the changed characters are written, so it can be drawn again after every key
+  */
+static void main_show_latency(void){
+	latency_histogram_t histogram;
+	uint8 line[LCD_DISPLAY_COLS + 1];
+	uint8 number[11];
+	uint8 *pText;
+	uint8 glyphs[LCD_GLYPH_ROWS];
+	uint16 peak = 0;
+	uint8 bin, length;
+	Latency_Get_Histogram(main_latency_class, &histogram);
+
+	memset(line, ' ', LCD_DISPLAY_COLS);
+	line[LCD_DISPLAY_COLS] = '\0';
+	memcpy(line, main_latency_names[main_latency_class], strlen(main_latency_names[main_latency_class]));
+	line[4] = 'n';
+	pText = Conv_Render_Decimal(histogram.count, &number[10]);
+	memcpy(&line[5], pText, &number[10] - pText);
+	pText = Conv_Render_Decimal(histogram.max_us / 1000UL, &number[10]);
+	length = &number[10] - pText;
+	memcpy(&line[LCD_DISPLAY_COLS - 2 - length], pText, length);
+	line[LCD_DISPLAY_COLS - 2] = 'm';
+	line[LCD_DISPLAY_COLS - 1] = 's';
+	LCD_Update_String_Pos(line, LCD_FIRST_ROW, 1);
+
+	for(bin = 0; bin < LCD_GLYPH_ROWS; bin++){
+		glyphs[bin] = LCD_Create_Char(main_bar_glyphs[bin]);
+	}
+	for(bin = 0; bin < LATENCY_BINS; bin++){
+		peak = (histogram.bins[bin] > peak) ? histogram.bins[bin] : peak;
+	}
+	for(bin = 0; (bin < LATENCY_BINS) && (bin < LCD_DISPLAY_COLS); bin++){
+		if(0 == histogram.bins[bin]){
+			line[bin] = ' ';
+		}
+		else{
+			/* Rounded up, so a bin with any key shows at least one row */
+			line[bin] = glyphs[((((uint32)histogram.bins[bin] * LCD_GLYPH_ROWS) + peak - 1) / peak) - 1];
+		}
+	}
+	line[bin] = '\0';
+	LCD_Update_String_Pos(line, LCD_SECOND_ROW, 1);
+}
+
+/**=============================================
+  * @Fn				- MAIN_DIAGNOSTICS
+  * @brief 			- This function shows the key to screen latency histogram of one class of keys at a time
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- This function will be called in MAIN_DIAGNOSTICS state
+  * 				- + and - select the class, C goes back to the modes, any other key draws it again
+  */
+STATE_DEF(MAIN_DIAGNOSTICS){
+	uint8 pressed_key;
+
+	/* State Name */
+	if(MAIN_DIAGNOSTICS != main_state_id){
+		main_set_state(MAIN_DIAGNOSTICS);
+		main_latency_class = LATENCY_DIGIT;
+		LCD_Send_Command(LCD_CLEAR_DISPLAY);
+		main_show_latency();
+		return;
+	}
+	else{ /* Do Nothing */ }
+
+	/* Event Check */
+	pressed_key = Events_Key();
+	if('C' == pressed_key){
 		pfMain_State_Handler = STATE_CALL(MAIN_SELECTION);
+		Events_Post(EVENT_CONTINUE, 0);
+		return;
+	}
+	else if('+' == pressed_key){
+		main_latency_class = (main_latency_class + 1) % LATENCY_CLASSES;
+	}
+	else if('-' == pressed_key){
+		main_latency_class = (main_latency_class + LATENCY_CLASSES - 1) % LATENCY_CLASSES;
 	}
+	else{ /* Do Nothing */ }
+	main_show_latency();
 }
+#endif
@@ -22,12 +22,20 @@
 
 /* Includes */
 #include <errno.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /**
  * Pointer to the current high watermark of the heap usage
  */
-static uint8_t *__sbrk_heap_end = NULL;
+uint8_t *__sbrk_heap_end = NULL;
+
+/**
+ * Highest heap end so far, calls and failed calls of _sbrk, read by the memory usage service
+ */
+uint8_t *__sbrk_heap_peak = NULL;
+uint32_t __sbrk_calls = 0;
+uint32_t __sbrk_failures = 0;
 
 /**
  * @brief _sbrk() allocates memory to the newlib heap and is used by malloc
@@ -59,6 +67,8 @@ void *_sbrk(ptrdiff_t incr)
   const uint8_t *max_heap = (uint8_t *)stack_limit;
   uint8_t *prev_heap_end;
 
+  __sbrk_calls++;
+
   /* Initialize heap end at first call */
   if (NULL == __sbrk_heap_end)
   {
@@ -68,12 +78,17 @@ void *_sbrk(ptrdiff_t incr)
   /* Protect heap from growing into the reserved MSP stack */
   if (__sbrk_heap_end + incr > max_heap)
   {
+    __sbrk_failures++;
     errno = ENOMEM;
     return (void *)-1;
   }
 
   prev_heap_end = __sbrk_heap_end;
   __sbrk_heap_end += incr;
+  if (__sbrk_heap_end > __sbrk_heap_peak)
+  {
+    __sbrk_heap_peak = __sbrk_heap_end;
+  }
 
   return (void *)prev_heap_end;
 }
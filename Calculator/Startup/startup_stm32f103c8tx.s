@@ -91,6 +91,21 @@ LoopFillZerobss:
   cmp r2, r4
   bcc FillZerobss
 
+/* Paint the heap and stack with MEM_PAINT_PATTERN of memory_usage.h, the words left
+   unchanged tell how deep the stack went */
+  ldr r2, =_end
+  mov r4, sp
+  ldr r3, =0xDEADBEEF
+  b LoopPaintStack
+
+PaintStack:
+  str  r3, [r2]
+  adds r2, r2, #4
+
+LoopPaintStack:
+  cmp r2, r4
+  bcc PaintStack
+
 /* Call static constructors */
   bl __libc_init_array
 /* Call the application's entry point.*/